@@ -5,11 +5,13 @@
 #include <vector>
 #include <algorithm>
 #include <numeric>
+#include <limits>
 
 //--- Parser includes -----------------------------------------------------------------------------
 #include "muParserBase.h"
 #include "muParserMath.h"
 #include "muParserDef.h"
+#include "muParserNumScan.h"
 
 
 MUP_NAMESPACE_START
@@ -56,46 +58,46 @@ MUP_NAMESPACE_START
       if (!details::value_traits<TValue>::IsInteger())
       {
         // trigonometric functions
-        ParserBase<TValue, TString>::DefineFun( _SL("sin"),   MathImpl<TValue, TString>::Sin, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("cos"),   MathImpl<TValue, TString>::Cos, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("tan"),   MathImpl<TValue, TString>::Tan, 1);
+        ParserBase<TValue, TString>::DefineFun( _SL("sin"),   MathImpl<TValue, TString>::Sin, 1, VecMathImpl<TValue, TString>::Sin);
+        ParserBase<TValue, TString>::DefineFun( _SL("cos"),   MathImpl<TValue, TString>::Cos, 1, VecMathImpl<TValue, TString>::Cos);
+        ParserBase<TValue, TString>::DefineFun( _SL("tan"),   MathImpl<TValue, TString>::Tan, 1, VecMathImpl<TValue, TString>::Tan);
       
         // arcus functions
-        ParserBase<TValue, TString>::DefineFun( _SL("asin"),  MathImpl<TValue, TString>::ASin,  1);
-        ParserBase<TValue, TString>::DefineFun( _SL("acos"),  MathImpl<TValue, TString>::ACos,  1);
-        ParserBase<TValue, TString>::DefineFun( _SL("atan"),  MathImpl<TValue, TString>::ATan,  1);
-        ParserBase<TValue, TString>::DefineFun( _SL("atan2"), MathImpl<TValue, TString>::ATan2, 2);
+        ParserBase<TValue, TString>::DefineFun( _SL("asin"),  MathImpl<TValue, TString>::ASin,  1, VecMathImpl<TValue, TString>::ASin);
+        ParserBase<TValue, TString>::DefineFun( _SL("acos"),  MathImpl<TValue, TString>::ACos,  1, VecMathImpl<TValue, TString>::ACos);
+        ParserBase<TValue, TString>::DefineFun( _SL("atan"),  MathImpl<TValue, TString>::ATan,  1, VecMathImpl<TValue, TString>::ATan);
+        ParserBase<TValue, TString>::DefineFun( _SL("atan2"), MathImpl<TValue, TString>::ATan2, 2, VecMathImpl<TValue, TString>::ATan2);
       
         // hyperbolic functions
-        ParserBase<TValue, TString>::DefineFun( _SL("sinh"),  MathImpl<TValue, TString>::Sinh, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("cosh"),  MathImpl<TValue, TString>::Cosh, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("tanh"),  MathImpl<TValue, TString>::Tanh, 1);
+        ParserBase<TValue, TString>::DefineFun( _SL("sinh"),  MathImpl<TValue, TString>::Sinh, 1, VecMathImpl<TValue, TString>::Sinh);
+        ParserBase<TValue, TString>::DefineFun( _SL("cosh"),  MathImpl<TValue, TString>::Cosh, 1, VecMathImpl<TValue, TString>::Cosh);
+        ParserBase<TValue, TString>::DefineFun( _SL("tanh"),  MathImpl<TValue, TString>::Tanh, 1, VecMathImpl<TValue, TString>::Tanh);
       
         // arcus hyperbolic functions
-        ParserBase<TValue, TString>::DefineFun( _SL("asinh"), MathImpl<TValue, TString>::ASinh, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("acosh"), MathImpl<TValue, TString>::ACosh, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("atanh"), MathImpl<TValue, TString>::ATanh, 1);
+        ParserBase<TValue, TString>::DefineFun( _SL("asinh"), MathImpl<TValue, TString>::ASinh, 1, VecMathImpl<TValue, TString>::ASinh);
+        ParserBase<TValue, TString>::DefineFun( _SL("acosh"), MathImpl<TValue, TString>::ACosh, 1, VecMathImpl<TValue, TString>::ACosh);
+        ParserBase<TValue, TString>::DefineFun( _SL("atanh"), MathImpl<TValue, TString>::ATanh, 1, VecMathImpl<TValue, TString>::ATanh);
       
         // Logarithm functions
-        ParserBase<TValue, TString>::DefineFun( _SL("log2"),  MathImpl<TValue, TString>::Log2,  1);
-        ParserBase<TValue, TString>::DefineFun( _SL("log10"), MathImpl<TValue, TString>::Log10, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("log"),   MathImpl<TValue, TString>::Log,   1);
-        ParserBase<TValue, TString>::DefineFun( _SL("ln"),    MathImpl<TValue, TString>::Log,   1);
+        ParserBase<TValue, TString>::DefineFun( _SL("log2"),  MathImpl<TValue, TString>::Log2,  1, VecMathImpl<TValue, TString>::Log2);
+        ParserBase<TValue, TString>::DefineFun( _SL("log10"), MathImpl<TValue, TString>::Log10, 1, VecMathImpl<TValue, TString>::Log10);
+        ParserBase<TValue, TString>::DefineFun( _SL("log"),   MathImpl<TValue, TString>::Log,   1, VecMathImpl<TValue, TString>::Log);
+        ParserBase<TValue, TString>::DefineFun( _SL("ln"),    MathImpl<TValue, TString>::Log,   1, VecMathImpl<TValue, TString>::Log);
 
         // misc
-        ParserBase<TValue, TString>::DefineFun( _SL("exp"),   MathImpl<TValue, TString>::Exp,  1);
-        ParserBase<TValue, TString>::DefineFun( _SL("sqrt"),  MathImpl<TValue, TString>::Sqrt, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("sign"),  MathImpl<TValue, TString>::Sign, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("rint"),  MathImpl<TValue, TString>::Rint, 1);
-        ParserBase<TValue, TString>::DefineFun( _SL("avg"),   MathImpl<TValue, TString>::Avg, -1);
+        ParserBase<TValue, TString>::DefineFun( _SL("exp"),   MathImpl<TValue, TString>::Exp,  1, VecMathImpl<TValue, TString>::Exp);
+        ParserBase<TValue, TString>::DefineFun( _SL("sqrt"),  MathImpl<TValue, TString>::Sqrt, 1, VecMathImpl<TValue, TString>::Sqrt);
+        ParserBase<TValue, TString>::DefineFun( _SL("sign"),  MathImpl<TValue, TString>::Sign, 1, VecMathImpl<TValue, TString>::Sign);
+        ParserBase<TValue, TString>::DefineFun( _SL("rint"),  MathImpl<TValue, TString>::Rint, 1, VecMathImpl<TValue, TString>::Rint);
+        ParserBase<TValue, TString>::DefineFun( _SL("avg"),   MathImpl<TValue, TString>::Avg, -1, VecMathImpl<TValue, TString>::Avg);
       }
 
-      ParserBase<TValue, TString>::DefineFun( _SL("abs"),   MathImpl<TValue, TString>::Abs,  1);
+      ParserBase<TValue, TString>::DefineFun( _SL("abs"),   MathImpl<TValue, TString>::Abs,  1, VecMathImpl<TValue, TString>::Abs);
       
       // Functions with variable number of arguments
-      ParserBase<TValue, TString>::DefineFun( _SL("sum"),   MathImpl<TValue, TString>::Sum, -1);
-      ParserBase<TValue, TString>::DefineFun( _SL("min"),   MathImpl<TValue, TString>::Min, -1);
-      ParserBase<TValue, TString>::DefineFun( _SL("max"),   MathImpl<TValue, TString>::Max, -1);
+      ParserBase<TValue, TString>::DefineFun( _SL("sum"),   MathImpl<TValue, TString>::Sum, -1, VecMathImpl<TValue, TString>::Sum);
+      ParserBase<TValue, TString>::DefineFun( _SL("min"),   MathImpl<TValue, TString>::Min, -1, VecMathImpl<TValue, TString>::Min);
+      ParserBase<TValue, TString>::DefineFun( _SL("max"),   MathImpl<TValue, TString>::Max, -1, VecMathImpl<TValue, TString>::Max);
     }
 
     //---------------------------------------------------------------------------------------------
@@ -111,27 +113,27 @@ MUP_NAMESPACE_START
     //---------------------------------------------------------------------------------------------
     void InitOprt() 
     {
-      ParserBase<TValue, TString>::DefineInfixOprt( _SL("-"), MathImpl<TValue, TString>::UnaryMinus);
-      ParserBase<TValue, TString>::DefineInfixOprt( _SL("+"), MathImpl<TValue, TString>::UnaryPlus);
+      ParserBase<TValue, TString>::DefineInfixOprt( _SL("-"), MathImpl<TValue, TString>::UnaryMinus, prINFIX, VecMathImpl<TValue, TString>::UnaryMinus);
+      ParserBase<TValue, TString>::DefineInfixOprt( _SL("+"), MathImpl<TValue, TString>::UnaryPlus, prINFIX, VecMathImpl<TValue, TString>::UnaryPlus);
 
-      ParserBase<TValue, TString>::DefineOprt( _SL("&&"), MathImpl<TValue, TString>::And,       prLOGIC);
-      ParserBase<TValue, TString>::DefineOprt( _SL("||"), MathImpl<TValue, TString>::Or,        prLOGIC);
+      ParserBase<TValue, TString>::DefineOprt( _SL("&&"), MathImpl<TValue, TString>::And,       prLOGIC, oaLEFT, VecMathImpl<TValue, TString>::And);
+      ParserBase<TValue, TString>::DefineOprt( _SL("||"), MathImpl<TValue, TString>::Or,        prLOGIC, oaLEFT, VecMathImpl<TValue, TString>::Or);
 
-      ParserBase<TValue, TString>::DefineOprt( _SL("<"),  MathImpl<TValue, TString>::Less,      prCMP);
-      ParserBase<TValue, TString>::DefineOprt( _SL(">"),  MathImpl<TValue, TString>::Greater,   prCMP);
-      ParserBase<TValue, TString>::DefineOprt( _SL("<="), MathImpl<TValue, TString>::LessEq,    prCMP);
-      ParserBase<TValue, TString>::DefineOprt( _SL(">="), MathImpl<TValue, TString>::GreaterEq, prCMP);
-      ParserBase<TValue, TString>::DefineOprt( _SL("=="), MathImpl<TValue, TString>::Equal,     prCMP);
-      ParserBase<TValue, TString>::DefineOprt( _SL("!="), MathImpl<TValue, TString>::NotEqual,  prCMP);
+      ParserBase<TValue, TString>::DefineOprt( _SL("<"),  MathImpl<TValue, TString>::Less,      prCMP, oaLEFT, VecMathImpl<TValue, TString>::Less);
+      ParserBase<TValue, TString>::DefineOprt( _SL(">"),  MathImpl<TValue, TString>::Greater,   prCMP, oaLEFT, VecMathImpl<TValue, TString>::Greater);
+      ParserBase<TValue, TString>::DefineOprt( _SL("<="), MathImpl<TValue, TString>::LessEq,    prCMP, oaLEFT, VecMathImpl<TValue, TString>::LessEq);
+      ParserBase<TValue, TString>::DefineOprt( _SL(">="), MathImpl<TValue, TString>::GreaterEq, prCMP, oaLEFT, VecMathImpl<TValue, TString>::GreaterEq);
+      ParserBase<TValue, TString>::DefineOprt( _SL("=="), MathImpl<TValue, TString>::Equal,     prCMP, oaLEFT, VecMathImpl<TValue, TString>::Equal);
+      ParserBase<TValue, TString>::DefineOprt( _SL("!="), MathImpl<TValue, TString>::NotEqual,  prCMP, oaLEFT, VecMathImpl<TValue, TString>::NotEqual);
 
-      ParserBase<TValue, TString>::DefineOprt( _SL("+"), MathImpl<TValue, TString>::Add, prADD_SUB);
-      ParserBase<TValue, TString>::DefineOprt( _SL("-"), MathImpl<TValue, TString>::Sub, prADD_SUB);
-      ParserBase<TValue, TString>::DefineOprt( _SL("*"), MathImpl<TValue, TString>::Mul, prMUL_DIV, oaRIGHT);
+      ParserBase<TValue, TString>::DefineOprt( _SL("+"), MathImpl<TValue, TString>::Add, prADD_SUB, oaLEFT, VecMathImpl<TValue, TString>::Add);
+      ParserBase<TValue, TString>::DefineOprt( _SL("-"), MathImpl<TValue, TString>::Sub, prADD_SUB, oaLEFT, VecMathImpl<TValue, TString>::Sub);
+      ParserBase<TValue, TString>::DefineOprt( _SL("*"), MathImpl<TValue, TString>::Mul, prMUL_DIV, oaRIGHT, VecMathImpl<TValue, TString>::Mul);
 
       if (!details::value_traits<TValue>::IsInteger())
       {
-        ParserBase<TValue, TString>::DefineOprt( _SL("/"), MathImpl<TValue, TString>::Div, prMUL_DIV);
-        ParserBase<TValue, TString>::DefineOprt( _SL("^"), MathImpl<TValue, TString>::Pow, prPOW, oaRIGHT);
+        ParserBase<TValue, TString>::DefineOprt( _SL("/"), MathImpl<TValue, TString>::Div, prMUL_DIV, oaLEFT, VecMathImpl<TValue, TString>::Div);
+        ParserBase<TValue, TString>::DefineOprt( _SL("^"), MathImpl<TValue, TString>::Pow, prPOW, oaRIGHT, VecMathImpl<TValue, TString>::Pow);
       }
     }
 
@@ -142,16 +144,11 @@ MUP_NAMESPACE_START
     {
       TValue fVal(0);
 
-      typename ParserBase<TValue, TString>::stringstream_type stream(a_szExpr);
-
-      stream.seekg(0);
-      stream >> fVal;
-      typename ParserBase<TValue, TString>::stringstream_type::pos_type iEnd = stream.tellg(); // Position after reading
-
-      if (iEnd==(typename ParserBase<TValue, TString>::stringstream_type::pos_type)-1)
+      int nLen = NumScanner<TValue, typename TString::value_type>::ScanFloat(a_szExpr, fVal);
+      if (nLen==0)
         return 0;
 
-      *a_iPos += (int)iEnd;
+      *a_iPos += nLen;
       *a_fVal = fVal;
       return 1;
     }
@@ -163,31 +160,22 @@ MUP_NAMESPACE_START
         \param [in/out] a_iPos Pointer to an interger value holding the current parsing 
                position in the expression.
         \param [out] a_fVal Pointer to the position where the detected value shall be stored.
+        \throw ParserError if the value does not fit into TValue.
     */
     static int IsIntVal(const typename TString::value_type* a_szExpr, int *a_iPos, TValue *a_fVal)
     {
-      TString buf(a_szExpr);
-      std::size_t pos = buf.find_first_not_of(_SL("0123456789"));
+      unsigned long long nVal(0);
+      bool bOverflow(false);
 
-      if (pos==std::string::npos)
+      int nLen = NumScanner<TValue, typename TString::value_type>::ScanInt(a_szExpr, 10, GetMaxInt(), nVal, bOverflow);
+      if (nLen==0)
         return 0;
 
-      stringstream_type stream( buf.substr(0, pos ) );
-      int iVal(0);
-
-      stream >> iVal;
-      if (stream.fail())
-        return 0;
-      
-      typename stringstream_type::pos_type iEnd = stream.tellg();   // Position after reading
-      if (stream.fail())
-        iEnd = stream.str().length();  
-
-      if (iEnd==(typename stringstream_type::pos_type)-1)
-        return 0;
+      if (bOverflow)
+        throw ParserError<TString>(_SL("Integer conversion error (overflow)."));
 
-      *a_iPos += (int)iEnd;
-      *a_fVal = (TValue)iVal;
+      *a_iPos += nLen;
+      *a_fVal = (TValue)nVal;
       return 1;
     }
 
@@ -199,29 +187,40 @@ MUP_NAMESPACE_START
                position in the expression.
         \param [out] a_fVal Pointer to the position where the detected value shall be stored.
 
-      Hey values must be prefixed with "0x" in order to be detected properly.
+      Hey values must be prefixed with "0x" in order to be detected properly. Like binary 
+      values they are read as unsigned and may not exceed its range.
     */
     static int IsHexVal(const typename TString::value_type* a_szExpr, int *a_iPos, TValue *a_fVal)
     {
       if (a_szExpr[1]==0 || (a_szExpr[0]!='0' || a_szExpr[1]!='x') ) 
         return 0;
 
-      unsigned iVal(0);
+      unsigned long long nVal(0);
+      bool bOverflow(false);
 
-      // New code based on streams for UNICODE compliance:
-      typename stringstream_type::pos_type nPos(0);
-      stringstream_type ss(a_szExpr + 2);
-      ss >> std::hex >> iVal;
-      nPos = ss.tellg();
+      int nLen = NumScanner<TValue, typename TString::value_type>::ScanInt(a_szExpr + 2, 16, std::numeric_limits<unsigned>::max(), nVal, bOverflow);
+      if (nLen==0)
+        return 0;
 
-      if (nPos==(typename stringstream_type::pos_type)0)
-        return 1;
+      if (bOverflow)
+        throw ParserError<TString>(_SL("Hexadecimal to integer conversion error (overflow)."));
 
-      *a_iPos += (int)(2 + nPos);
-      *a_fVal = (TValue)iVal;
+      *a_iPos += 2 + nLen;
+      *a_fVal = (TValue)(unsigned)nVal;
       return 1;
     }
 
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the largest decimal integer literal allowed. */
+    static unsigned long long GetMaxInt()
+    {
+      // only meaningful for integral value types, IsIntVal is not used otherwise
+      if (!std::numeric_limits<TValue>::is_integer)
+        return std::numeric_limits<unsigned long long>::max();
+
+      return (unsigned long long)std::numeric_limits<TValue>::max();
+    }
+
     //---------------------------------------------------------------------------------------------
     static int IsBinVal(const typename TString::value_type* a_szExpr, int *a_iPos, TValue *a_fVal)
     {
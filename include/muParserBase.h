@@ -3,18 +3,31 @@
 
 //--- Standard includes ------------------------------------------------------------------------
 #include <cmath>
+#include <algorithm>
 #include <string>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <locale>
+#include <utility>
+#include <type_traits>
 
 //--- Parser includes --------------------------------------------------------------------------
 #include "muParserDef.h"
 #include "muParserTokenReader.h"
 #include "muParserBytecode.h"
+#include "muParserRegCode.h"
+#include "muParserJit.h"
+#include "muParserCompiled.h"
 #include "muParserError.h"
 #include "muParserStack.h"
+#include "muParserSimd.h"
+#include "muParserThreadPool.h"
+#include "muParserExprCache.h"
+#include "muParserStats.h"
+#include "muParserExplain.h"
+#include "muParserSerialize.h"
+#include "muPrecompiledEngines.h"
 
 
 MUP_NAMESPACE_START
@@ -32,10 +45,14 @@ class ParserBase
   typedef TValue (ParserBase::*ParseFunction)();
 
   typedef Token<TValue, TString> token_type;
+  typedef ParserByteCode<TValue, TString> bytecode_type;
+  typedef typename bytecode_type::SInstr instr_type;
+  typedef ParseFunction (*select_type)(const instr_type*);
   typedef ParserTokenReader<TValue, TString> token_reader_type;
   typedef TValue* (*facfun_type)(const typename TString::value_type*, void*);
   typedef int (*identfun_type)(const typename TString::value_type *sExpr, int *nPos, TValue *fVal);
   typedef void (*fun_type)(TValue*, int narg);
+  typedef void (*vfun_type)(TValue *const *args, TValue *out, int narg, std::size_t n);
   typedef std::basic_stringstream<typename TString::value_type,
                                   std::char_traits<typename TString::value_type>,
                                   std::allocator<typename TString::value_type> > stringstream_type;
@@ -60,6 +77,8 @@ class ParserBase
     ParserBase()
       :m_pParseFormula(&ParserBase::ParseString)
       ,m_vRPN()
+      ,m_vRegCode()
+      ,m_Jit()
       ,m_pTokenReader()
       ,m_FunDef()
       ,m_PostOprtDef()
@@ -67,12 +86,19 @@ class ParserBase
       ,m_OprtDef()
       ,m_ConstDef()
       ,m_VarDef()
+      ,m_VarStride()
+      ,m_pExprCache(nullptr)
+      ,m_pStats(nullptr)
+      ,m_pExprStats(nullptr)
+      ,m_pStatsEngine(nullptr)
+      ,m_nCompileStart(0)
       ,m_vStackBuffer()
+      ,m_vBulkBuffer()
+      ,m_vBulkSlots()
       ,m_nFinalResultIdx(0)
       ,m_nEngineID(0)
     {
       InitTokenReader();
-      InitPrecompiledEngined();
     }
 
     //---------------------------------------------------------------------------------------------
@@ -81,6 +107,8 @@ class ParserBase
     ParserBase(const ParserBase &a_Parser)
       :m_pParseFormula(&ParserBase::ParseString)
       ,m_vRPN()
+      ,m_vRegCode()
+      ,m_Jit()
       ,m_pTokenReader()
       ,m_FunDef()
       ,m_PostOprtDef()
@@ -88,9 +116,14 @@ class ParserBase
       ,m_OprtDef()
       ,m_ConstDef()
       ,m_VarDef()
+      ,m_VarStride()
+      ,m_pExprCache(nullptr)
+      ,m_pStats(nullptr)
+      ,m_pExprStats(nullptr)
+      ,m_pStatsEngine(nullptr)
+      ,m_nCompileStart(0)
     {
       m_pTokenReader.reset(new token_reader_type(this));
-      InitPrecompiledEngined();
       Assign(a_Parser);
     }
 
@@ -124,6 +157,397 @@ class ParserBase
       return (this->*m_pParseFormula)(); 
     }
 
+    //---------------------------------------------------------------------------------------------
+    /** \brief Evaluate the expression using a stack owned by the caller.
+        \param a_pStack Pointer to an array of at least GetMaxStackSize() values.
+        \param a_nStackSize Number of values in a_pStack.
+        \throw ParserError if the stack is too small.
+
+      Once the expression is compiled neither this function nor Eval() allocate memory. Use 
+      GetMaxStackSize() to compile the expression and size the stack up front. The stack is 
+      only used during the call, the parser keeps no reference to it.
+    */
+    TValue EvalWithStack(TValue *a_pStack, std::size_t a_nStackSize)
+    {
+      if (a_nStackSize < GetMaxStackSize())
+      {
+        stringstream_type ss;
+        ss << m_vRPN.GetMaxStackSize();
+        Error(ecSTACK_TOO_SMALL, -1, ss.str());
+      }
+
+      TValue *pStack = m_pStack;
+      m_pStack = a_pStack;
+      try
+      {
+        TValue fVal = (this->*m_pParseFormula)();
+        m_pStack = pStack;
+        return fVal;
+      }
+      catch(...)
+      {
+        m_pStack = pStack;
+        throw;
+      }
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the number of values needed by EvalWithStack.
+
+      The expression is compiled if this has not been done yet.
+    */
+    std::size_t GetMaxStackSize()
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+      {
+        CreateRPN();
+        AssignOptimizedEngine();
+      }
+
+      return m_vRPN.GetMaxStackSize();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Evaluate the expression for a range of rows.
+        \param a_pResults Pointer to an array receiving one result per row.
+        \param a_nRows Number of rows to evaluate.
+
+      Variables defined with a stride read the value a_pVar[i*stride] for row i, variables 
+      without a stride keep the same value for all rows. The bytecode is executed once per block 
+      of MUP_BULK_SIZE rows instead of once per row. If the expression contains multiple comma 
+      separated subexpressions only the result of the last one is stored.
+    */
+    void Eval(TValue *a_pResults, std::size_t a_nRows)
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+      {
+        CreateRPN();
+        AssignOptimizedEngine();
+      }
+
+      ParseCmdCodeBulk(a_pResults, 0, a_nRows, m_vBulkBuffer, m_vBulkSlots);
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Evaluate the expression for a range of rows using all hardware threads.
+        \param a_pResults Pointer to an array receiving one result per row.
+        \param a_nRows Number of rows to evaluate.
+        \param a_bDeterministic If true side effects of the expression occur in row order.
+
+      The rows are split into chunks sized by MUP_PARALLEL_CHUNK_BYTES which are evaluated by 
+      the threads of ParserThreadPool::Instance(). Each thread uses its own bulk stack, chunks 
+      start at multiples of MUP_BULK_SIZE so every row is computed exactly as by 
+      Eval(a_pResults, a_nRows).
+
+      Callbacks without a vectorized version are called concurrently in an unspecified order 
+      and must be thread safe. Pass a_bDeterministic in order to evaluate expressions calling 
+      such callbacks sequentially. Expressions assigning to variables without a stride are 
+      always evaluated sequentially. Callbacks must not start a parallel evaluation themselves.
+    */
+    void EvalParallel(TValue *a_pResults, std::size_t a_nRows, bool a_bDeterministic = false)
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+      {
+        CreateRPN();
+        AssignOptimizedEngine();
+      }
+
+      // Rows per chunk, each row reads the strided variables and writes a result
+      std::size_t nRowBytes = sizeof(TValue);
+      bool bSequential = false;
+      for (const instr_type *pTok = m_vRPN.GetBase(); pTok->Cmd!=cmEND; ++pTok)
+      {
+        if (pTok->Cmd==cmVAL_EX && pTok->Val.stride!=0)
+          nRowBytes += sizeof(TValue);
+        else if (pTok->Cmd==cmASSIGN && pTok->Oprt.stride!=0)
+          nRowBytes += sizeof(TValue);
+        else if (pTok->Cmd==cmASSIGN)
+          bSequential = true;
+        else if (pTok->Cmd==cmFUNC && pTok->Fun.vptr==nullptr && a_bDeterministic)
+          bSequential = true;
+      }
+
+      const std::size_t nChunk = std::max<std::size_t>(1, MUP_PARALLEL_CHUNK_BYTES / (nRowBytes * MUP_BULK_SIZE)) * MUP_BULK_SIZE,
+                        nChunks = (a_nRows + nChunk - 1) / nChunk;
+
+      ParserThreadPool &pool = ParserThreadPool::Instance();
+      if (bSequential || nChunks<2 || pool.GetNumThreads()<2)
+      {
+        ParseCmdCodeBulk(a_pResults, 0, a_nRows, m_vBulkBuffer, m_vBulkSlots);
+        return;
+      }
+
+      std::vector<std::vector<TValue> > vBuffer(pool.GetNumThreads());
+      std::vector<std::vector<TValue*> > vSlots(pool.GetNumThreads());
+      pool.Run(nChunks, [&](std::size_t nTask, unsigned nWorker)
+               {
+                 const std::size_t nBegin = nTask * nChunk;
+                 ParseCmdCodeBulk(a_pResults, 
+                                  nBegin, 
+                                  std::min(nBegin + nChunk, a_nRows), 
+                                  vBuffer[nWorker], 
+                                  vSlots[nWorker]);
+               });
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the compiled form of the expression.
+
+      The result does not depend on the parser, it stays valid if the parser is modified or
+      destroyed. It can be evaluated by several threads at the same time, each thread using
+      its own CompiledExpression::Context.
+    */
+    CompiledExpression<TValue, TString> Compile()
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+      {
+        CreateRPN();
+        AssignOptimizedEngine();
+      }
+
+      if (m_pStats==nullptr)
+        return CompiledExpression<TValue, TString>(m_vRPN, m_nFinalResultIdx, m_VarDef);
+
+      return CompiledExpression<TValue, TString>(m_vRPN, m_nFinalResultIdx, m_VarDef, m_pStats,
+                                                 ParserExprCache<TValue, TString>::Normalize(m_pTokenReader->GetExpr()),
+                                                 GetEngine(), GetEngineFallback());
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns how the expression is evaluated.
+
+      The plan lists the final instructions, the rewrites of the optimizer, the engine and 
+      an estimate of the cost of an evaluation, see ParserExplain. The expression is compiled 
+      if needed.
+    */
+    ParserExplain<TValue, TString> Explain()
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+      {
+        CreateRPN();
+        AssignOptimizedEngine();
+      }
+
+      return ParserExplain<TValue, TString>(m_vRPN, 
+                                            ParserExprCache<TValue, TString>::Normalize(m_pTokenReader->GetExpr()), 
+                                            m_nFinalResultIdx, 
+                                            m_VarDef,
+                                            GetEngine(), 
+                                            GetEngineName(), 
+                                            GetEngineFallback());
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Append the bytecode of the expression to a memory block.
+        \param a_vBlob Receives the serialized bytecode.
+
+      Variables and callbacks are stored by name, constants including the user defined ones
+      are stored by value. Several expressions can be stored one after another in the same 
+      block and be loaded in the same order with LoadByteCode.
+    */
+    void SaveByteCode(std::vector<unsigned char> &a_vBlob)
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+      {
+        CreateRPN();
+        AssignOptimizedEngine();
+      }
+
+      ParserBlobWriter<TString> writer(a_vBlob);
+      const std::size_t nStart = writer.GetPos();
+
+      writer.Write((std::uint32_t)s_nBlobMagic);
+      writer.Write((std::uint32_t)s_nBlobVersion);
+      writer.Write((std::uint8_t)sizeof(TValue));
+      writer.Write((std::uint8_t)sizeof(typename TString::value_type));
+      const std::size_t nSizePos = writer.GetPos();
+      writer.Write((std::uint64_t)0); // size of the record, known at the end
+
+      writer.WriteString(m_pTokenReader->GetExpr());
+      writer.Write((std::int32_t)m_nFinalResultIdx);
+      writer.Write((std::uint32_t)m_vRPN.GetMaxStackSize());
+      writer.Write((std::int32_t)m_vRPN.GetEngineID());
+      writer.Write((std::uint32_t)m_vRPN.GetSize());
+
+      const instr_type *pBase = m_vRPN.GetBase();
+      for (std::size_t i=0; i<m_vRPN.GetSize(); ++i)
+      {
+        const instr_type &instr = pBase[i];
+        writer.Write((std::uint8_t)instr.Cmd);
+        writer.WriteString(m_vRPN.GetIdent(i));
+
+        switch(instr.Cmd)
+        {
+        case cmVAL_EX:
+             writer.WriteString((instr.IsConst()) ? TString() : GetVarName(instr.Val.ptr));
+             writer.Write(instr.Val.mul);
+             writer.Write(instr.Val.fixed);
+             break;
+
+        case cmASSIGN:
+             writer.WriteString(GetVarName(instr.Oprt.ptr));
+             break;
+
+        case cmFUNC:
+             {
+               // Callbacks of the optimizer are stored by index, all others by name
+               const int iFun = bytecode_type::GetInternalFunIdx(instr.Fun.ptr);
+               if (iFun>=0)
+               {
+                 writer.Write((std::uint8_t)s_nNumCallbackDefs);
+                 writer.Write((std::uint16_t)iFun);
+               }
+               else
+               {
+                 TString sName;
+                 const int iDefs = GetCallbackName(instr.Fun.ptr, sName);
+                 if (iDefs<0)
+                   Error(ecINVALID_BYTECODE, -1, m_vRPN.GetIdent(i));
+
+                 writer.Write((std::uint8_t)iDefs);
+                 writer.WriteString(sName);
+               }
+
+               writer.Write((std::int32_t)instr.Fun.argc);
+             }
+             break;
+
+        default:
+             break;
+        }
+      }
+
+      writer.WriteAt(nSizePos, (std::uint64_t)(writer.GetPos() - nStart));
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Load bytecode stored by SaveByteCode.
+        \param a_pData Start of the bytecode, e.g. in a memory mapped file.
+        \param a_nSize Number of bytes available at a_pData.
+        \return The number of bytes read, i.e. the offset of the next expression in the block.
+        \throw ParserError with the code ecINVALID_BYTECODE if the data is damaged or refers 
+               to variables or callbacks not defined in this parser.
+
+      The expression is replaced by the loaded one without parsing it. Variables and callbacks 
+      are bound to the definitions of this parser by name, variables use their current stride.
+    */
+    std::size_t LoadByteCode(const void *a_pData, std::size_t a_nSize)
+    {
+      if (m_pStats)
+        m_nCompileStart = ParserStatsRegistry<TString>::ReadCycles();
+
+      ParserBlobReader<TString> reader(a_pData, a_nSize);
+
+      if (reader.template Read<std::uint32_t>()!=s_nBlobMagic || 
+          reader.template Read<std::uint32_t>()!=s_nBlobVersion ||
+          reader.template Read<std::uint8_t>()!=sizeof(TValue) ||
+          reader.template Read<std::uint8_t>()!=sizeof(typename TString::value_type))
+      {
+        Error(ecINVALID_BYTECODE, -1, _SL("unknown format"));
+      }
+
+      const std::uint64_t nRecordSize = reader.template Read<std::uint64_t>();
+      const TString sExpr = reader.ReadString();
+      const int nFinalResultIdx = reader.template Read<std::int32_t>();
+      const std::size_t nMaxStackSize = reader.template Read<std::uint32_t>();
+      reader.template Read<std::int32_t>();  // The engine ID depends on MUP_PRECOMPILED_MAX_LEN, it is recomputed
+      const std::size_t nInstr = reader.template Read<std::uint32_t>();
+
+      std::vector<instr_type> vCode;
+      std::vector<TString> vIdent;
+      int nDepth = 0;
+      bool bValid = nInstr>0;
+
+      for (std::size_t i=0; i<nInstr && bValid; ++i)
+      {
+        instr_type instr = instr_type();
+        instr.Cmd = (ECmdCode)reader.template Read<std::uint8_t>();
+        vIdent.push_back(reader.ReadString());
+
+        switch(instr.Cmd)
+        {
+        case cmVAL_EX:
+             {
+               const TString sName = reader.ReadString();
+               instr.Val.ptr   = (sName.length()) ? FindVar(sName, instr.Val.stride) : &g_NullValue;
+               instr.Val.mul   = reader.template Read<TValue>();
+               instr.Val.fixed = reader.template Read<TValue>();
+               ++nDepth;
+             }
+             break;
+
+        case cmASSIGN:
+             instr.Oprt.ptr = FindVar(reader.ReadString(), instr.Oprt.stride);
+             bValid = nDepth>=2;
+             --nDepth;
+             break;
+
+        case cmFUNC:
+             {
+               const int iDefs = reader.template Read<std::uint8_t>();
+               if (iDefs==s_nNumCallbackDefs)
+               {
+                 const int iFun = reader.template Read<std::uint16_t>();
+                 bValid = iFun<bytecode_type::GetNumInternalFun();
+                 if (bValid)
+                   bytecode_type::GetInternalFun(iFun, instr.Fun.ptr, instr.Fun.vptr);
+
+                 instr.Fun.argc = -1;
+               }
+               else if (iDefs<s_nNumCallbackDefs)
+               {
+                 const TString sName = reader.ReadString();
+                 const std::map<TString, token_type> &defs = *GetCallbackDefs(iDefs);
+                 auto item = defs.find(sName);
+                 if (item==defs.end())
+                   Error(ecINVALID_BYTECODE, -1, sName);
+
+                 instr.Fun = item->second.Fun;
+               }
+               else
+               {
+                 bValid = false;
+               }
+
+               const int argc = reader.template Read<std::int32_t>();
+               bValid = bValid && argc>=0 && argc<=nDepth && (instr.Fun.argc<0 || instr.Fun.argc==argc);
+               instr.Fun.argc = argc;
+               nDepth -= argc - 1;
+             }
+             break;
+
+        case cmEND:
+             bValid = i + 1==nInstr;
+             break;
+
+        default:
+             bValid = false;
+             break;
+        }
+
+        bValid = bValid && nDepth < (int)nMaxStackSize;
+        vCode.push_back(instr);
+      }
+
+      if (!bValid || 
+          vCode.back().Cmd!=cmEND || 
+          nFinalResultIdx<1 || 
+          nDepth!=nFinalResultIdx || 
+          reader.GetPos()!=nRecordSize)
+      {
+        Error(ecINVALID_BYTECODE, -1, sExpr);
+      }
+
+      m_pTokenReader->SetFormula(sExpr);
+      ReInit();
+      m_vRPN.SetCode(vCode, vIdent, nMaxStackSize);
+      m_nFinalResultIdx = nFinalResultIdx;
+      CompileRPN();
+      AssignOptimizedEngine();
+
+      return reader.GetPos();
+    }
+
     //---------------------------------------------------------------------------------------------
     /** \brief Sets a new expression.
         \param a_sExpr a string containing the expression.
@@ -135,6 +559,108 @@ class ParserBase
       ReInit();
     }
 
+    //---------------------------------------------------------------------------------------------
+    /** \brief Attach a bytecode cache to the parser.
+        \param a_pCache The cache or nullptr in order to detach the current cache.
+
+      Before parsing an expression the parser looks it up in the cache, expressions not found
+      are parsed and stored in the cache. Only parsers with identical definitions share the
+      cached bytecode. The cache is not owned by the parser and must outlive it, it may be 
+      attached to any number of parsers used by different threads.
+    */
+    void SetExprCache(ParserExprCache<TValue, TString> *a_pCache)
+    {
+      m_pExprCache = a_pCache;
+      ReInit();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Enable or disable the bytecode optimizer.
+
+      With the optimizer disabled the bytecode is a plain translation of the expression. 
+      This is mostly useful for testing and debugging, the results are the same.
+    */
+    void EnableOptimizer(bool a_bIsOn = true)
+    {
+      m_vRPN.EnableOptimizer(a_bIsOn);
+      ReInit();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    bool IsOptimizerEnabled() const
+    {
+      return m_vRPN.IsOptimizerEnabled();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Attach a statistics registry to the parser.
+        \param a_pRegistry The registry or nullptr in order to stop recording statistics.
+
+      The parser records the compilations and evaluations of its expressions in the registry, 
+      see ParserStatsRegistry. The registry is not owned by the parser and must outlive it, it 
+      may be attached to any number of parsers used by different threads.
+    */
+    void SetStatsRegistry(ParserStatsRegistry<TString> *a_pRegistry)
+    {
+      m_pStats = a_pRegistry;
+      ReInit();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the engine evaluating the expression, enPARSE_STRING if it is not compiled. */
+    EEngine GetEngine() const
+    {
+      const ParseFunction pEngine = (m_pParseFormula==&ParserBase::ParseStats) ? m_pStatsEngine : m_pParseFormula;
+      const int nEngineID = m_vRPN.GetEngineID();
+
+      if (pEngine==&ParserBase::ParseString)
+        return enPARSE_STRING;
+      else if (pEngine==&ParserBase::ParseCmdCode)
+        return enCMD_CODE;
+      else if (pEngine==&ParserBase::ParseRegCode)
+        return enREG_CODE;
+      else if (pEngine==&ParserBase::ParseJit)
+        return enJIT;
+      else if (nEngineID>=0 && nEngineID<s_nNumPrecompiledEngines &&
+               pEngine==GetPrecompiledEngines(std::make_index_sequence<s_nNumPrecompiledEngines>())[nEngineID])
+        return enPRECOMPILED;
+      else
+        return enSPECIALIZED;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the name of the function evaluating the expression.
+
+      This is "ParseString" as long as the expression is not compiled. Precompiled engines are
+      reported as "PrecompiledExpr_<engine ID>".
+    */
+    std::string GetEngineName() const
+    {
+      const EEngine eEngine = GetEngine();
+      if (eEngine==enPRECOMPILED)
+        return std::string(details::GetEngineName(eEngine)) + "_" + std::to_string(m_vRPN.GetEngineID());
+      else
+        return details::GetEngineName(eEngine);
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the reason why the compiled expression has no precompiled engine.
+
+      The result is efNONE if there is one, even if the expression is evaluated by a 
+      specialized engine or the JIT backend.
+    */
+    EEngineFallback GetEngineFallback() const
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+        return efNONE;
+      else if (m_nFinalResultIdx!=1)
+        return efMULTIPLE_RESULTS;
+      else if (m_vRPN.GetEngineID()>=s_nNumPrecompiledEngines)
+        return efTOO_LONG;
+      else
+        return m_vRPN.GetEngineFallback();
+    }
+
     //---------------------------------------------------------------------------------------------
     void SetVarFactory(facfun_type a_pFactory, void *pUserData = nullptr)
     {
@@ -148,7 +674,17 @@ class ParserBase
     }
 
     //---------------------------------------------------------------------------------------------
-    void DefineVar(const TString &a_sName, TValue *a_pVar)
+    /** \brief Define a parser variable.
+        \param a_sName Name of the variable.
+        \param a_pVar Pointer to the variable or to the first row of a column of values.
+        \param a_nStride Distance between two successive rows of the column in elements of 
+                         TValue. Only used by the bulk evaluation, a stride of zero binds all 
+                         rows to the same value.
+
+      Redefining an existing variable rebinds it, the bytecode of the current expression is 
+      patched instead of being recreated.
+    */
+    void DefineVar(const TString &a_sName, TValue *a_pVar, std::size_t a_nStride = 0)
     {
       if (a_pVar==0)
         Error(ecINVALID_VAR_PTR);
@@ -157,59 +693,112 @@ class ParserBase
       if (m_ConstDef.find(a_sName)!=m_ConstDef.end())
         Error(ecNAME_CONFLICT);
 
+      auto item = m_VarDef.find(a_sName);
+      if (item!=m_VarDef.end())
+      {
+        RebindVar(item, a_pVar, a_nStride);
+        return;
+      }
+
       CheckName(a_sName, c_sNameChars);
       m_VarDef[a_sName] = a_pVar;
+
+      if (a_nStride!=0)
+        m_VarStride[a_sName] = a_nStride;
+      else
+        m_VarStride.erase(a_sName);
+
+      m_pTokenReader->InvalidateSymbols();
       ReInit();
     }
 
     //---------------------------------------------------------------------------------------------
+    /** \brief Define a parser constant.
+
+      Constants are folded into the bytecode. Changing the value of a constant only requires
+      parsing the current expression again if it uses the constant.
+    */
     void DefineConst(const TString &a_sName, TValue a_fVal)
     {
       CheckName(a_sName, c_sNameChars);
+
+      auto item = m_ConstDef.find(a_sName);
+      if (item!=m_ConstDef.end())
+      {
+        if (item->second==a_fVal)
+          return;
+
+        item->second = a_fVal;
+        if (IsSymbolUsed(a_sName))
+          ReInit();
+
+        return;
+      }
+
       m_ConstDef[a_sName] = a_fVal;
+      m_pTokenReader->InvalidateSymbols();
       ReInit();
     }
 
     //---------------------------------------------------------------------------------------------
+    /** \brief Define a binary operator.
+
+      \param a_pVFun Optional version of the callback working on many values at once. If present
+                     it is used by the bulk evaluation instead of calling a_pFun for every row.
+    */
     void DefineOprt(const TString &a_sName, 
                     fun_type a_pFun, 
                     unsigned a_iPrec=0, 
-                    EOprtAssociativity a_eAssociativity = oaLEFT)
+                    EOprtAssociativity a_eAssociativity = oaLEFT,
+                    vfun_type a_pVFun = nullptr)
     {
       token_type tok;
-      tok.SetFun(cmOPRT_BIN, a_pFun, 2, a_eAssociativity, a_iPrec, a_sName);
+      tok.SetFun(cmOPRT_BIN, a_pFun, 2, a_eAssociativity, a_iPrec, a_sName, a_pVFun);
       AddCallback(a_sName, tok, m_OprtDef, c_sOprtChars);
     }
 
     //---------------------------------------------------------------------------------------------
-    void DefineFun(const TString &a_sName, fun_type a_pFun, int argc)
+    /** \brief Define a function.
+
+      \param a_pVFun Optional version of the callback working on many values at once. If present
+                     it is used by the bulk evaluation instead of calling a_pFun for every row.
+    */
+    void DefineFun(const TString &a_sName, fun_type a_pFun, int argc, vfun_type a_pVFun = nullptr)
     {
       token_type tok;
-      tok.SetFun(cmFUNC, a_pFun, argc, oaNONE, 0, a_sName);
+      tok.SetFun(cmFUNC, a_pFun, argc, oaNONE, 0, a_sName, a_pVFun);
       AddCallback(a_sName, tok, m_FunDef, c_sNameChars );
     }
 
     //---------------------------------------------------------------------------------------------
-    void DefinePostfixOprt(const TString &a_sName, fun_type a_pFun)
+    void DefinePostfixOprt(const TString &a_sName, fun_type a_pFun, vfun_type a_pVFun = nullptr)
     {
       token_type tok;
-      tok.SetFun(cmOPRT_POSTFIX, a_pFun, 1, oaNONE, prPOSTFIX, a_sName);
+      tok.SetFun(cmOPRT_POSTFIX, a_pFun, 1, oaNONE, prPOSTFIX, a_sName, a_pVFun);
       AddCallback(a_sName, tok, m_PostOprtDef, c_sOprtChars);
     }
 
     //---------------------------------------------------------------------------------------------
-    void DefineInfixOprt(const TString &a_sName, fun_type a_pFun, int a_iPrec=prINFIX)
+    void DefineInfixOprt(const TString &a_sName, fun_type a_pFun, int a_iPrec=prINFIX, vfun_type a_pVFun = nullptr)
     {
       token_type tok;
-      tok.SetFun(cmOPRT_INFIX, a_pFun, 1, oaNONE, a_iPrec, a_sName);
+      tok.SetFun(cmOPRT_INFIX, a_pFun, 1, oaNONE, a_iPrec, a_sName, a_pVFun);
       AddCallback(a_sName, tok, m_InfixOprtDef, c_sInfixOprtChars);
     }
 
     //---------------------------------------------------------------------------------------------
     void ClearVar()
     {
+      // The bytecode stays valid if the expression does not use any variable
+      bool bUsed = m_pParseFormula!=&ParserBase::ParseString && 
+                   (!m_pTokenReader->IsAtEnd() || m_pTokenReader->GetUsedVar().size()!=0);
+
       m_VarDef.clear();
-      ReInit();
+      m_VarStride.clear();
+      m_pTokenReader->InvalidateSymbols();
+
+      if (bUsed)
+        ReInit();
     }
 
     //---------------------------------------------------------------------------------------------
@@ -218,8 +807,14 @@ class ParserBase
       auto item = m_VarDef.find(a_strVarName);
       if (item!=m_VarDef.end())
       {
+        bool bUsed = IsSymbolUsed(a_strVarName);
+
         m_VarDef.erase(item);
-        ReInit();
+        m_VarStride.erase(a_strVarName);
+        m_pTokenReader->InvalidateSymbols();
+
+        if (bUsed)
+          ReInit();
       }
     }
 
@@ -235,7 +830,7 @@ class ParserBase
       try
       {
         m_pTokenReader->IgnoreUndefVar(true);
-        CreateRPN(); // try to create bytecode, but don't use it for any further calculations since it
+        ParseRPN();  // try to create bytecode, but don't use it for any further calculations since it
                      // may contain references to nonexisting variables.
         m_pParseFormula = &ParserBase::ParseString;
         m_pTokenReader->IgnoreUndefVar(false);
@@ -338,9 +933,12 @@ class ParserBase
 
       m_ConstDef        = a_Parser.m_ConstDef;         // Copy user define constants
       m_VarDef          = a_Parser.m_VarDef;           // Copy user defined variables
-      m_vStackBuffer    = a_Parser.m_vStackBuffer;
+      m_VarStride       = a_Parser.m_VarStride;
+      m_pExprCache      = a_Parser.m_pExprCache;
+      m_pStats          = a_Parser.m_pStats;
       m_nFinalResultIdx = a_Parser.m_nFinalResultIdx;
       m_pTokenReader.reset(a_Parser.m_pTokenReader->Clone(this));
+      m_vRPN.EnableOptimizer(a_Parser.m_vRPN.IsOptimizerEnabled());
 
       // Copy function and operator callbacks
       m_FunDef = a_Parser.m_FunDef;             // Copy function definitions
@@ -349,6 +947,86 @@ class ParserBase
       m_OprtDef = a_Parser.m_OprtDef;           // binary operators
     }
 
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns false if the current bytecode does not depend on a variable or constant.
+    
+      The answer is only certain for bytecode created by the token reader, bytecode taken from
+      the cache or loaded from a file is assumed to depend on all symbols.
+    */
+    bool IsSymbolUsed(const TString &a_sName) const
+    {
+      if (m_pParseFormula==&ParserBase::ParseString)
+        return false;
+
+      if (!m_pTokenReader->IsAtEnd())
+        return true;
+
+      return m_pTokenReader->GetUsedVar().count(a_sName)!=0 || m_pTokenReader->IsUsedConst(a_sName);
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Bind an existing variable to a new address without parsing the expression again.
+
+      The bytecode refers to variables by their address. If another variable used by the
+      expression shares the old address the instructions can not be told apart and the
+      expression is parsed again.
+    */
+    void RebindVar(typename std::map<TString, TValue*>::iterator a_itVar, TValue *a_pVar, std::size_t a_nStride)
+    {
+      const TString &sName = a_itVar->first;
+      TValue *pOld = a_itVar->second;
+
+      auto stride = m_VarStride.find(sName);
+      std::size_t nOldStride = (stride!=m_VarStride.end()) ? stride->second : 0;
+      if (pOld==a_pVar && nOldStride==a_nStride)
+        return;
+
+      bool bUsed = IsSymbolUsed(sName);
+      bool bShared = false;
+      if (bUsed)
+      {
+        // Only variables used by the expression matter if they are known
+        if (m_pTokenReader->IsAtEnd())
+        {
+          const std::map<TString, TValue*> &vUsed = m_pTokenReader->GetUsedVar();
+          for (auto var = vUsed.begin(); var!=vUsed.end() && !bShared; ++var)
+          {
+            auto def = m_VarDef.find(var->first);
+            bShared = var->first!=sName && def!=m_VarDef.end() && def->second==pOld;
+          }
+        }
+        else
+        {
+          for (auto var = m_VarDef.begin(); var!=m_VarDef.end() && !bShared; ++var)
+            bShared = var!=a_itVar && var->second==pOld;
+        }
+      }
+
+      a_itVar->second = a_pVar;
+      if (nOldStride!=a_nStride)
+      {
+        if (a_nStride!=0)
+          m_VarStride[sName] = a_nStride;
+        else
+          m_VarStride.erase(stride);
+
+        m_pTokenReader->InvalidateSymbols();
+      }
+
+      if (!bUsed)
+        return;
+
+      if (bShared)
+      {
+        ReInit();
+        return;
+      }
+
+      // The register code and the machine code contain copies of the addresses
+      m_vRPN.RebindVar(pOld, a_pVar, a_nStride);
+      CompileRPN();
+    }
+
     //---------------------------------------------------------------------------------------------
     void InitTokenReader()
     {
@@ -359,7 +1037,10 @@ class ParserBase
     void ReInit() const
     {
       m_pParseFormula = &ParserBase::ParseString;
+      m_pExprStats = nullptr;
       m_vRPN.Clear();
+      m_vRegCode.Clear();
+      m_Jit.Clear();
       m_pTokenReader->ReInit();
     }
 
@@ -400,6 +1081,7 @@ class ParserBase
       }
 
       a_Storage[a_sName] = tok;
+      m_pTokenReader->InvalidateSymbols();
       ReInit();
     }
 
@@ -459,6 +1141,7 @@ class ParserBase
             Error(ecUNEXPECTED_OPERATOR, -1, _SL("="));
                       
           optTok.Oprt.ptr = valTok2.Val.ptr;
+          optTok.Oprt.stride = valTok2.Val.stride;
           m_vRPN.AddAssignOp(optTok);
         }
 
@@ -517,14 +1200,158 @@ class ParserBase
     {
       switch (tok.Cmd)
       {
-      case cmASSIGN:
+      case cmASSIGN:   return oaLEFT;  // the token carries no function data
       case cmOPRT_BIN: return tok.Fun.asoc;
       default:         return oaNONE;
       }  
     }
 
-    //---------------------------------------------------------------------------
+    //---------------------------------------------------------------------------------------------
+    /** \brief Create the bytecode of the expression, use the cached bytecode if available. */
     void CreateRPN() const
+    {
+      if (m_pStats)
+        m_nCompileStart = ParserStatsRegistry<TString>::ReadCycles();
+
+      if (m_pExprCache==nullptr)
+      {
+        ParseRPN();
+        CompileRPN();
+        return;
+      }
+
+      const std::uint64_t nFingerprint = GetFingerprint();
+
+      ReInit();
+      if (!m_pExprCache->Find(m_pTokenReader->GetExpr(), nFingerprint, m_vRPN, m_nFinalResultIdx))
+      {
+        ParseRPN();
+
+        // Variables created by a variable factory change the definitions
+        if (GetFingerprint()==nFingerprint)
+          m_pExprCache->Insert(m_pTokenReader->GetExpr(), nFingerprint, m_vRPN, m_nFinalResultIdx);
+      }
+
+      CompileRPN();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the definitions of the callbacks of a type, 0 to s_nNumCallbackDefs-1. */
+    const std::map<TString, token_type>* GetCallbackDefs(int a_iDefs) const
+    {
+      const std::map<TString, token_type> *pDefs[s_nNumCallbackDefs] = { &m_FunDef, &m_OprtDef, &m_InfixOprtDef, &m_PostOprtDef };
+      return pDefs[a_iDefs];
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Find the name of a callback.
+        \return The type of the definition containing the callback or -1 if it is not defined.
+    */
+    int GetCallbackName(fun_type a_pFun, TString &a_sName) const
+    {
+      for (int i=0; i<s_nNumCallbackDefs; ++i)
+      {
+        const std::map<TString, token_type> &defs = *GetCallbackDefs(i);
+        for (auto item = defs.begin(); item!=defs.end(); ++item)
+        {
+          if (item->second.Fun.ptr==a_pFun)
+          {
+            a_sName = item->first;
+            return i;
+          }
+        }
+      }
+
+      return -1;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the name of a variable given its address. */
+    TString GetVarName(const TValue *a_pVar) const
+    {
+      for (auto item = m_VarDef.begin(); item!=m_VarDef.end(); ++item)
+      {
+        if (item->second==a_pVar)
+          return item->first;
+      }
+
+      Error(ecINVALID_BYTECODE);
+      return TString();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the address and stride of a variable given its name. */
+    TValue* FindVar(const TString &a_sName, std::size_t &a_nStride) const
+    {
+      auto item = m_VarDef.find(a_sName);
+      if (item==m_VarDef.end())
+        Error(ecINVALID_BYTECODE, -1, a_sName);
+
+      auto stride = m_VarStride.find(a_sName);
+      a_nStride = (stride!=m_VarStride.end()) ? stride->second : 0;
+      return item->second;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns a hash of all definitions affecting the bytecode of an expression. */
+    std::uint64_t GetFingerprint() const
+    {
+      typedef ParserExprCache<TValue, TString> cache_type;
+      std::uint64_t nHash = cache_type::HashSeed();
+
+      const std::map<TString, token_type> *pFunMaps[] = { &m_FunDef, &m_PostOprtDef, &m_InfixOprtDef, &m_OprtDef };
+      for (std::size_t i=0; i<sizeof(pFunMaps)/sizeof(pFunMaps[0]); ++i)
+      {
+        nHash = cache_type::Hash(nHash, &i, sizeof(i));
+        for (auto item = pFunMaps[i]->begin(); item!=pFunMaps[i]->end(); ++item)
+        {
+          const typename token_type::SFunDef &fun = item->second.Fun;
+          nHash = cache_type::Hash(nHash, item->first.data(), item->first.length() * sizeof(item->first[0]));
+          nHash = cache_type::Hash(nHash, &item->second.Cmd, sizeof(item->second.Cmd));
+          nHash = cache_type::Hash(nHash, &fun.ptr, sizeof(fun.ptr));
+          nHash = cache_type::Hash(nHash, &fun.vptr, sizeof(fun.vptr));
+          nHash = cache_type::Hash(nHash, &fun.argc, sizeof(fun.argc));
+          nHash = cache_type::Hash(nHash, &fun.prec, sizeof(fun.prec));
+          nHash = cache_type::Hash(nHash, &fun.asoc, sizeof(fun.asoc));
+        }
+      }
+
+      for (auto item = m_ConstDef.begin(); item!=m_ConstDef.end(); ++item)
+      {
+        nHash = cache_type::Hash(nHash, item->first.data(), item->first.length() * sizeof(item->first[0]));
+        nHash = cache_type::Hash(nHash, &item->second, sizeof(item->second));
+      }
+
+      for (auto item = m_VarDef.begin(); item!=m_VarDef.end(); ++item)
+      {
+        nHash = cache_type::Hash(nHash, item->first.data(), item->first.length() * sizeof(item->first[0]));
+        nHash = cache_type::Hash(nHash, &item->second, sizeof(item->second));
+      }
+
+      for (auto item = m_VarStride.begin(); item!=m_VarStride.end(); ++item)
+      {
+        nHash = cache_type::Hash(nHash, item->first.data(), item->first.length() * sizeof(item->first[0]));
+        nHash = cache_type::Hash(nHash, &item->second, sizeof(item->second));
+      }
+
+      const std::list<identfun_type> &vIdent = m_pTokenReader->GetValIdent();
+      for (auto item = vIdent.begin(); item!=vIdent.end(); ++item)
+        nHash = cache_type::Hash(nHash, &*item, sizeof(*item));
+
+      const facfun_type pFactory = m_pTokenReader->GetVarFactory();
+      const void *pFactoryData = m_pTokenReader->GetVarFactoryData();
+      const typename TString::value_type cArgSep = m_pTokenReader->GetArgSep();
+      const bool bOptimizer = m_vRPN.IsOptimizerEnabled();
+      nHash = cache_type::Hash(nHash, &pFactory, sizeof(pFactory));
+      nHash = cache_type::Hash(nHash, &pFactoryData, sizeof(pFactoryData));
+      nHash = cache_type::Hash(nHash, &cArgSep, sizeof(cArgSep));
+      nHash = cache_type::Hash(nHash, &bOptimizer, sizeof(bOptimizer));
+      return nHash;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Parse the expression and create its finalized bytecode. */
+    void ParseRPN() const
     {
       if (!m_pTokenReader->GetExpr().length())
         Error(ecUNEXPECTED_EOF, 0);
@@ -680,14 +1507,27 @@ class ParserBase
       if (stVal.size()==0)
         Error(ecEMPTY_EXPRESSION);
 
+      m_vRPN.Finalize();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Set up the evaluation of the finalized bytecode. */
+    void CompileRPN() const
+    {
       m_vStackBuffer.resize(m_vRPN.GetMaxStackSize());
-      m_pRPN   = m_vRPN.GetBase();
       m_pStack = &m_vStackBuffer[0];
-      m_vRPN.Finalize();
+      m_pRPN   = m_vRPN.GetBase();
+
+      if (m_vRPN.IsOptimizerEnabled())
+      {
+        m_vRegCode.Compile(m_vRPN);
+        m_Jit.Compile(m_vRPN, m_nFinalResultIdx);
+      }
 
       if (ParserBase::g_DbgDumpCmdCode)
       {
         m_vRPN.AsciiDump();
+        m_vRegCode.AsciiDump();
       }
     }
 
@@ -706,14 +1546,62 @@ class ParserBase
 
       // nEngineID < 0                         - nicht optimierbar
       // nEngineID >= s_nNumPrecompiledEngines - theoretisch optimierbar, praktisch zu lang
-      if (nEngineID<0 || nEngineID>=s_nNumPrecompiledEngines)
+      // m_nFinalResultIdx != 1                - mehrere Ergebnisse, die Engines liefern nur Stack[1]
+      //
+      // Short arithmetic expressions made of builtin operators only are evaluated by a 
+      // specialized engine. All other bytecode is evaluated by the machine code of the JIT
+      // backend if available, else by the engine matching its shape.
+      // Without a precompiled engine the register code is used. With the optimizer disabled
+      // the stack based bytecode is interpreted as it is.
+      ParseFunction pSpecialized = nullptr;
+      if (m_nFinalResultIdx==1 && m_vRPN.GetSize() <= 2 * MUP_SPECIALIZED_MAX_OPS + 2)
+        pSpecialized = SelectSpecializedEngine<0, 0>(m_vRPN.GetBase());
+
+      if (pSpecialized)
       {
-        m_pParseFormula = &ParserBase::ParseCmdCode;
+        m_pParseFormula = pSpecialized;
+      }
+      else if (m_Jit.IsCompiled())
+      {
+        m_pParseFormula = &ParserBase::ParseJit;
+      }
+      else if (nEngineID<0 || nEngineID>=s_nNumPrecompiledEngines || m_nFinalResultIdx!=1)
+      {
+        m_pParseFormula = (m_vRegCode.GetSize()) ? &ParserBase::ParseRegCode : &ParserBase::ParseCmdCode;
       }
       else
       {
-        m_pParseFormula = m_pPrecompiledEngines[nEngineID];
+        m_pParseFormula = GetPrecompiledEngines(std::make_index_sequence<s_nNumPrecompiledEngines>())[nEngineID];
       }
+
+      if (m_pStats)
+      {
+        m_pStatsEngine = m_pParseFormula;
+        m_pParseFormula = &ParserBase::ParseStats;
+        AcquireExprStats();
+        ParserStatsRegistry<TString>::RecordCompile(*m_pExprStats, ParserStatsRegistry<TString>::ReadCycles() - m_nCompileStart);
+      }
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Get the statistics record of the expression for the calling thread. */
+    void AcquireExprStats() const
+    {
+      m_pExprStats = m_pStats->Acquire(ParserExprCache<TValue, TString>::Normalize(m_pTokenReader->GetExpr()));
+      ParserStatsRegistry<TString>::RecordEngine(*m_pExprStats, GetEngine(), m_vRPN.GetEngineID(), GetEngineFallback());
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Engine counting the evaluations of the engine m_pStatsEngine. */
+    TValue ParseStats()
+    {
+      if (m_pExprStats->Thread!=std::this_thread::get_id())
+        AcquireExprStats();
+
+      const std::uint64_t nStart = ParserStatsRegistry<TString>::ReadCycles();
+      TValue fVal = (this->*m_pStatsEngine)();
+      ParserStatsRegistry<TString>::RecordEval(*m_pExprStats, ParserStatsRegistry<TString>::ReadCycles() - nStart);
+      return fVal;
     }
 
     //---------------------------------------------------------------------------------------------
@@ -726,7 +1614,7 @@ class ParserBase
 
       register int sidx(0);
 
-      for (const token_type *pTok = m_vRPN.GetBase(); pTok->Cmd!=cmEND; ++pTok)
+      for (const instr_type *pTok = m_vRPN.GetBase(); pTok->Cmd!=cmEND; ++pTok)
       {
         switch (pTok->Cmd)
         {
@@ -736,7 +1624,7 @@ class ParserBase
 
         case  cmVAL_EX: 
               pVal = &(pTok->Val);
-              Stack[++sidx] = *pVal->ptr + pVal->fixed;
+              Stack[++sidx] = *pVal->ptr * pVal->mul + pVal->fixed;
               continue;
 
         case  cmFUNC:
@@ -756,287 +1644,339 @@ class ParserBase
       return Stack[m_nFinalResultIdx];  
     }
 
-  #define SXO_INIT   \
-          int sidx = 0;
+    //---------------------------------------------------------------------------------------------
+    /** \brief Evaluation by the machine code of the JIT backend. */
+    TValue ParseJit()
+    {
+      return m_Jit.Exec(m_pStack);
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Interpreter of the register code.
 
-  #define SXO_VAL(TOK,IDX) \
-          m_pStack[++sidx] = (TOK[IDX])->Val.fixed + *(TOK[IDX])->Val.ptr;  \
+      The registers are the slots of the evaluation stack. If MUP_COMPUTED_GOTO is defined 
+      each handler jumps directly to the handler of the next instruction. The handler 
+      addresses are stored in the instructions the first time the code is executed.
+    */
+    TValue ParseRegCode()
+    {
+      typedef typename ParserRegCode<TValue, TString>::SInstr reg_instr_type;
+
+      TValue *Reg = m_pStack;
+      const reg_instr_type *pCode = m_vRegCode.GetBase();
+
+  #define RC_DST   Reg[pCode->Dst]
+  #define RC_SRC   Reg[pCode->Src]
+  #define RC_VAL   (*pCode->Val.ptr * pCode->Val.mul + pCode->Val.fixed)
+  #define RC_CONST pCode->Val.fixed
+
+  #if defined(MUP_COMPUTED_GOTO)
+    #define RC_CASE(CODE) L_##CODE:
+    #define RC_NEXT       goto *(++pCode)->Handler
+
+      // must be in the order of ERegCode
+      static const void *const s_pHandler[] = 
+      { 
+        &&L_rcLOAD,   &&L_rcLOAD_VAR, &&L_rcLOAD_CONST, 
+        &&L_rcADD_RR, &&L_rcADD_RV,   &&L_rcADD_VR,     &&L_rcADD_RK, &&L_rcADD_KR,
+        &&L_rcSUB_RR, &&L_rcSUB_RV,   &&L_rcSUB_VR,     &&L_rcSUB_RK, &&L_rcSUB_KR,
+        &&L_rcMUL_RR, &&L_rcMUL_RV,   &&L_rcMUL_VR,     &&L_rcMUL_RK, &&L_rcMUL_KR,
+        &&L_rcDIV_RR, &&L_rcDIV_RV,   &&L_rcDIV_VR,     &&L_rcDIV_RK, &&L_rcDIV_KR,
+        &&L_rcNEG,    &&L_rcSIN,      &&L_rcCOS,        &&L_rcTAN,    &&L_rcSQRT, 
+        &&L_rcEXP,    &&L_rcLOG,      &&L_rcABS,
+        &&L_rcCALL,   &&L_rcASSIGN,   &&L_rcEND 
+      };
+      static_assert(sizeof(s_pHandler)/sizeof(s_pHandler[0])==rcEND+1, "handler table does not match ERegCode");
+
+      if (!m_vRegCode.IsLinked())
+        m_vRegCode.Link(s_pHandler);
+
+      goto *pCode->Handler;
+      {
+  #else
+    #define RC_CASE(CODE) case CODE:
+    #define RC_NEXT       continue
 
-  #define SXO_FUN(TOK,IDX) \
-          {                                                         \
-            const typename token_type::SFunDef &fun = (TOK[IDX])->Fun;   \
-            (*fun.ptr)(&m_pStack[sidx -= fun.argc - 1], fun.argc);  \
-          }
+      for (;; ++pCode)
+      {
+        switch (pCode->Cmd)
+        {
+  #endif
 
-  #define SXO_RET   \
-        return m_pStack[1];
+        RC_CASE(rcLOAD)       RC_DST = RC_VAL;   RC_NEXT;
+        RC_CASE(rcLOAD_VAR)   RC_DST = *pCode->Val.ptr; RC_NEXT;
+        RC_CASE(rcLOAD_CONST) RC_DST = RC_CONST; RC_NEXT;
+
+        RC_CASE(rcADD_RR) RC_DST += RC_SRC;            RC_NEXT;
+        RC_CASE(rcADD_RV) RC_DST += RC_VAL;            RC_NEXT;
+        RC_CASE(rcADD_VR) RC_DST  = RC_VAL + RC_SRC;   RC_NEXT;
+        RC_CASE(rcADD_RK) RC_DST += RC_CONST;          RC_NEXT;
+        RC_CASE(rcADD_KR) RC_DST  = RC_CONST + RC_SRC; RC_NEXT;
+
+        RC_CASE(rcSUB_RR) RC_DST -= RC_SRC;            RC_NEXT;
+        RC_CASE(rcSUB_RV) RC_DST -= RC_VAL;            RC_NEXT;
+        RC_CASE(rcSUB_VR) RC_DST  = RC_VAL - RC_SRC;   RC_NEXT;
+        RC_CASE(rcSUB_RK) RC_DST -= RC_CONST;          RC_NEXT;
+        RC_CASE(rcSUB_KR) RC_DST  = RC_CONST - RC_SRC; RC_NEXT;
+
+        RC_CASE(rcMUL_RR) RC_DST *= RC_SRC;            RC_NEXT;
+        RC_CASE(rcMUL_RV) RC_DST *= RC_VAL;            RC_NEXT;
+        RC_CASE(rcMUL_VR) RC_DST  = RC_VAL * RC_SRC;   RC_NEXT;
+        RC_CASE(rcMUL_RK) RC_DST *= RC_CONST;          RC_NEXT;
+        RC_CASE(rcMUL_KR) RC_DST  = RC_CONST * RC_SRC; RC_NEXT;
+
+        RC_CASE(rcDIV_RR) RC_DST /= RC_SRC;            RC_NEXT;
+        RC_CASE(rcDIV_RV) RC_DST /= RC_VAL;            RC_NEXT;
+        RC_CASE(rcDIV_VR) RC_DST  = RC_VAL / RC_SRC;   RC_NEXT;
+        RC_CASE(rcDIV_RK) RC_DST /= RC_CONST;          RC_NEXT;
+        RC_CASE(rcDIV_KR) RC_DST  = RC_CONST / RC_SRC; RC_NEXT;
+
+        // builtin functions are called directly, this allows inlining them
+        RC_CASE(rcNEG)  MathImpl<TValue, TString>::UnaryMinus(&RC_DST, 1); RC_NEXT;
+        RC_CASE(rcSIN)  MathImpl<TValue, TString>::Sin(&RC_DST, 1);  RC_NEXT;
+        RC_CASE(rcCOS)  MathImpl<TValue, TString>::Cos(&RC_DST, 1);  RC_NEXT;
+        RC_CASE(rcTAN)  MathImpl<TValue, TString>::Tan(&RC_DST, 1);  RC_NEXT;
+        RC_CASE(rcSQRT) MathImpl<TValue, TString>::Sqrt(&RC_DST, 1); RC_NEXT;
+        RC_CASE(rcEXP)  MathImpl<TValue, TString>::Exp(&RC_DST, 1);  RC_NEXT;
+        RC_CASE(rcLOG)  MathImpl<TValue, TString>::Log(&RC_DST, 1);  RC_NEXT;
+        RC_CASE(rcABS)  MathImpl<TValue, TString>::Abs(&RC_DST, 1);  RC_NEXT;
+
+        RC_CASE(rcCALL)   
+              (*pCode->Fun.ptr)(&RC_DST, pCode->Fun.argc); 
+              RC_NEXT;
+
+        RC_CASE(rcASSIGN) 
+              RC_DST = *pCode->Var = RC_SRC; 
+              RC_NEXT;
+
+        RC_CASE(rcEND)
+              return Reg[m_nFinalResultIdx];
+
+  #if !defined(MUP_COMPUTED_GOTO)
+        default:
+              Error(ecINTERNAL_ERROR, 2);
+              return 0;
+        } // switch
+  #endif
+      }
 
-#define ParseFunc1(What, OP1)                  \
-    TValue PrecompiledExpr_##What()               \
-    {                                          \
-      SXO_INIT                                 \
-      SXO_##OP1(&m_pRPN,0)                     \
-      SXO_RET                                  \
+  #undef RC_DST
+  #undef RC_SRC
+  #undef RC_VAL
+  #undef RC_CONST
+  #undef RC_CASE
+  #undef RC_NEXT
     }
 
-  #define ParseFunc2(What, OP1, OP2)           \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_RET                                \
-      }
+    //---------------------------------------------------------------------------------------------
+    /** \brief Bulk evaluation engine.
 
-  #define ParseFunc3(What, OP1, OP2, OP3)      \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_RET                                \
-      }
+      Executes the bytecode once per block of MUP_BULK_SIZE rows. Each stack slot holds the values
+      of all rows of the current block, slot i starts at Stack[i*MUP_BULK_SIZE]. Variable loads 
+      and assignments work on all lanes of a slot at once using the vector kernels of SimdLanes.
+      Callbacks with a vectorized version are called once per block, all other callbacks are 
+      invoked row by row with their arguments gathered into a separate buffer.
 
-  #define ParseFunc4(What, OP1, OP2, OP3, OP4) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_RET                                \
-      }
+      Evaluates the rows a_nBegin ... a_nEnd-1 using a_vBuffer and a_vSlots as stack, the 
+      function does not modify the parser and can be called concurrently with separate stacks.
+    */
+    void ParseCmdCodeBulk(TValue *a_pResults, 
+                          std::size_t a_nBegin, 
+                          std::size_t a_nEnd, 
+                          std::vector<TValue> &a_vBuffer, 
+                          std::vector<TValue*> &a_vSlots) const
+    {
+      typedef SimdLanes<TValue> lanes_type;
 
-#define ParseFunc5(What, OP1, OP2, OP3, OP4, OP5) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_RET                                \
-      }
+      const std::size_t nSlots = m_vRPN.GetMaxStackSize();
+      a_vBuffer.resize(nSlots * (MUP_BULK_SIZE + 1));
+      a_vSlots.resize(nSlots);
 
-#define ParseFunc6(What, OP1, OP2, OP3, OP4, OP5, OP6) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_RET                                \
-      }
+      TValue *Stack = &a_vBuffer[0],
+             *Args  = &a_vBuffer[nSlots * MUP_BULK_SIZE];
 
-#define ParseFunc7(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_RET                                \
-      }
+      // Vectorized callbacks receive their arguments as an array of slot pointers
+      for (std::size_t i=0; i<nSlots; ++i)
+        a_vSlots[i] = &Stack[i*MUP_BULK_SIZE];
 
-#define ParseFunc8(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_RET                                \
-      }
+      for (std::size_t nRow=a_nBegin; nRow<a_nEnd; nRow+=MUP_BULK_SIZE)
+      {
+        const std::size_t nLanes = std::min<std::size_t>(MUP_BULK_SIZE, a_nEnd - nRow);
+        int sidx(0);
 
-#define ParseFunc9(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_RET                                \
-      }
+        for (const instr_type *pTok = m_vRPN.GetBase(); pTok->Cmd!=cmEND; ++pTok)
+        {
+          switch (pTok->Cmd)
+          {
+          case  cmASSIGN: 
+                {
+                  --sidx;
+                  TValue *pRes = &Stack[sidx*MUP_BULK_SIZE];
+                  const TValue *pVal = pRes + MUP_BULK_SIZE;
+                  const std::size_t nStride = pTok->Oprt.stride;
+                  lanes_type::Assign(pTok->Oprt.ptr + nRow*nStride, nStride, pRes, pVal, nLanes);
+                }
+                continue;
+
+          case  cmVAL_EX: 
+                {
+                  const typename token_type::SValDef &val = pTok->Val;
+                  lanes_type::Load(&Stack[++sidx*MUP_BULK_SIZE], 
+                                   val.ptr + nRow*val.stride, 
+                                   val.stride, 
+                                   val.mul, 
+                                   val.fixed, 
+                                   nLanes);
+                }
+                continue;
+
+          case  cmFUNC:
+                { 
+                  const typename token_type::SFunDef &fun = pTok->Fun;
+                  sidx -= fun.argc - 1;
+                  TValue *pArg = &Stack[sidx*MUP_BULK_SIZE];
+
+                  if (fun.vptr)
+                  {
+                    (*fun.vptr)(&a_vSlots[sidx], pArg, fun.argc, nLanes);
+                    continue;
+                  }
 
-#define ParseFunc10(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_RET                                \
-      }
+                  for (std::size_t i=0; i<nLanes; ++i)
+                  {
+                    for (int k=0; k<fun.argc; ++k)
+                      Args[k] = pArg[k*MUP_BULK_SIZE + i];
+
+                    (*fun.ptr)(Args, fun.argc);
+                    pArg[i] = Args[0];
+                  }
+                }
+                continue;
+      
+          default:
+                Error(ecINTERNAL_ERROR, 2);
+          } // switch CmdCode
+        } // for all bytecode tokens
+
+        const TValue *pRes = &Stack[m_nFinalResultIdx*MUP_BULK_SIZE];
+        for (std::size_t i=0; i<nLanes; ++i)
+          a_pResults[nRow + i] = pRes[i];
+      } // for all blocks
+    }
 
-#define ParseFunc11(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10, OP11) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_##OP11(&m_pRPN,10)                 \
-        SXO_RET                                \
-      }
+    //---------------------------------------------------------------------------------------------
+    /** \brief Precompiled engine for the bytecode shape with the engine ID NID. */
+    template<unsigned NID>
+    TValue PrecompiledExpr()
+    {
+      int sidx = 0;
+      PrecompiledShape<TValue, instr_type, details::EngineShape(NID)>::Exec(m_pRPN, m_pStack, sidx);
+      return m_pStack[1];
+    }
 
-#define ParseFunc12(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10, OP11, OP12) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_##OP11(&m_pRPN,10)                 \
-        SXO_##OP12(&m_pRPN,11)                 \
-        SXO_RET                                \
-      }
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the table of all precompiled engines indexed by engine ID. 
+    
+      The table is a constant shared by all parsers of the same type, it is initialized at 
+      compile time and not copied into the parser objects.
+    */
+    template<std::size_t... NID>
+    static const ParseFunction* GetPrecompiledEngines(std::index_sequence<NID...>)
+    {
+      static constexpr ParseFunction s_pEngines[] = { &ParserBase::template PrecompiledExpr<NID>... };
+      return s_pEngines;
+    }
 
-#define ParseFunc13(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10, OP11, OP12, OP13) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_##OP11(&m_pRPN,10)                 \
-        SXO_##OP12(&m_pRPN,11)                 \
-        SXO_##OP13(&m_pRPN,12)                 \
-        SXO_RET                                \
-      }
+    //---------------------------------------------------------------------------------------------
+    /** \brief Specialized engine for bytecode made of the inline operators NOps. */
+    template<int... NOps>
+    TValue SpecializedExpr()
+    {
+      TValue stack[MUP_SPECIALIZED_MAX_OPS + 2];
+      SpecializedShape<TValue, instr_type, 0, NOps...>::Exec(m_pRPN, stack);
+      return stack[1];
+    }
 
-#define ParseFunc14(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10, OP11, OP12, OP13, OP14) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_##OP11(&m_pRPN,10)                 \
-        SXO_##OP12(&m_pRPN,11)                 \
-        SXO_##OP13(&m_pRPN,12)                 \
-        SXO_##OP14(&m_pRPN,13)                 \
-        SXO_RET                                \
-      }
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the specialized engine for the instructions starting at a_pInstr.
+    
+      NOps are the inline operators of the preceding instructions. They leave NDepth values on 
+      the stack and count as NWeight operators. Returns nullptr if there is no specialized 
+      engine for the bytecode.
+    */
+    template<int NDepth, int NWeight, int... NOps>
+    static ParseFunction SelectSpecializedEngine(const instr_type *a_pInstr)
+    {
+      EInlineOp eOp = bytecode_type::GetInlineOp(*a_pInstr);
+      if (eOp==ioNONE)
+        return nullptr;
 
-#define ParseFunc15(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10, OP11, OP12, OP13, OP14, OP15) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_##OP11(&m_pRPN,10)                 \
-        SXO_##OP12(&m_pRPN,11)                 \
-        SXO_##OP13(&m_pRPN,12)                 \
-        SXO_##OP14(&m_pRPN,13)                 \
-        SXO_##OP15(&m_pRPN,14)                 \
-        SXO_RET                                \
-      }
+      if (eOp==ioEND)
+        return SpecializedEngine<NDepth==1, NOps...>::Get();
 
-#define ParseFunc16(What, OP1, OP2, OP3, OP4, OP5, OP6, OP7, OP8, OP9, OP10, OP11, OP12, OP13, OP14, OP15, OP16) \
-      TValue PrecompiledExpr_##What()             \
-      {                                        \
-        SXO_INIT                               \
-        SXO_##OP1(&m_pRPN,0)                   \
-        SXO_##OP2(&m_pRPN,1)                   \
-        SXO_##OP3(&m_pRPN,2)                   \
-        SXO_##OP4(&m_pRPN,3)                   \
-        SXO_##OP5(&m_pRPN,4)                   \
-        SXO_##OP6(&m_pRPN,5)                   \
-        SXO_##OP7(&m_pRPN,6)                   \
-        SXO_##OP8(&m_pRPN,7)                   \
-        SXO_##OP9(&m_pRPN,8)                   \
-        SXO_##OP10(&m_pRPN,9)                  \
-        SXO_##OP11(&m_pRPN,10)                 \
-        SXO_##OP12(&m_pRPN,11)                 \
-        SXO_##OP13(&m_pRPN,12)                 \
-        SXO_##OP14(&m_pRPN,13)                 \
-        SXO_##OP15(&m_pRPN,14)                 \
-        SXO_##OP16(&m_pRPN,15)                 \
-        SXO_RET                                \
-      }
+      static const select_type s_pSelect[] = 
+      {
+        GetNextSelector<ioVAL,    NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioADD,    NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioSUB,    NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioMUL,    NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioDIV,    NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_AA, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_AS, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_MA, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_AM, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_MM, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_DD, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_MD, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_DM, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_DA, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_AD, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_DS, NDepth, NWeight, NOps...>(),
+        GetNextSelector<ioFUN_SD, NDepth, NWeight, NOps...>()
+      };
+      static_assert(sizeof(s_pSelect)/sizeof(s_pSelect[0])==ioEND, "Selector table does not match EInlineOp");
+
+      select_type pNext = s_pSelect[eOp];
+      return (pNext) ? pNext(a_pInstr + 1) : nullptr;
+    }
 
-#include "muPrecompiledEngines.h"
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the selector for the instructions following the inline operator NOp. 
+    
+      Only selectors for valid bytecode are instantiated, the others are replaced by nullptr.
+    */
+    template<int NOp, int NDepth, int NWeight, int... NOps>
+    static constexpr select_type GetNextSelector()
+    {
+      typedef typename InlineOp<TValue, NOp>::template Next<NDepth, NWeight> next_type;
+      return SpecializedSelector<next_type::valid, next_type, NOps..., NOp>::Get();
+    }
+
+    //---------------------------------------------------------------------------------------------
+    template<bool bValid, typename TNext, int... NOps>
+    struct SpecializedSelector
+    {
+      static constexpr select_type Get() { return nullptr; }
+    };
+
+    template<typename TNext, int... NOps>
+    struct SpecializedSelector<true, TNext, NOps...>
+    {
+      static constexpr select_type Get() { return &ParserBase::template SelectSpecializedEngine<TNext::depth, TNext::weight, NOps...>; }
+    };
 
-    #undef ParseFunc1
-    #undef ParseFunc2
-    #undef ParseFunc3
-    #undef ParseFunc4
-    #undef ParseFunc5
-    #undef ParseFunc6
-    #undef ParseFunc7
-    #undef ParseFunc8
-    #undef ParseFunc9
-    #undef ParseFunc10
-    #undef ParseFunc11
-    #undef ParseFunc12
-    #undef SXO_VAL
-    #undef SXO_FUN
-    #undef SXO_INIT
-    #undef SXO_RET
+    //---------------------------------------------------------------------------------------------
+    template<bool bComplete, int... NOps>
+    struct SpecializedEngine
+    {
+      static constexpr ParseFunction Get() { return nullptr; }
+    };
+
+    template<int... NOps>
+    struct SpecializedEngine<true, NOps...>
+    {
+      static constexpr ParseFunction Get() { return &ParserBase::template SpecializedExpr<NOps...>; }
+    };
 
     //---------------------------------------------------------------------------------------------
     void CheckName(const TString &a_sName,
@@ -1102,6 +2042,8 @@ class ParserBase
 
     mutable ParseFunction  m_pParseFormula;
     mutable ParserByteCode<TValue, TString> m_vRPN;
+    mutable ParserRegCode<TValue, TString> m_vRegCode;  ///< Register form of m_vRPN, empty if the optimizer is disabled
+    mutable ParserJit<TValue, TString> m_Jit;            ///< Machine code of m_vRPN (MUP_USE_JIT only)
 
     std::unique_ptr<token_reader_type> m_pTokenReader;
 
@@ -1111,12 +2053,26 @@ class ParserBase
     std::map<TString, token_type>  m_OprtDef;
     std::map<TString, TValue>   m_ConstDef;
     std::map<TString, TValue*>  m_VarDef;
-
-    mutable const token_type *m_pRPN;
+    std::map<TString, std::size_t> m_VarStride; ///< Strides of variables bound to a column of values
+    ParserExprCache<TValue, TString> *m_pExprCache;  ///< Optional bytecode cache, not owned by the parser
+    ParserStatsRegistry<TString> *m_pStats;          ///< Optional statistics registry, not owned by the parser
+    mutable typename ParserStatsRegistry<TString>::SExprStats *m_pExprStats;  ///< Statistics of the expression for the evaluating thread
+    mutable ParseFunction m_pStatsEngine;            ///< Engine called by ParseStats
+    mutable std::uint64_t m_nCompileStart;           ///< Cycle counter at the start of the compilation
+
+    mutable const instr_type *m_pRPN;
     mutable TValue *m_pStack;
     mutable std::vector<TValue> m_vStackBuffer;
+    mutable std::vector<TValue> m_vBulkBuffer;  ///< Stack of the bulk evaluation, MUP_BULK_SIZE values per slot
+    mutable std::vector<TValue*> m_vBulkSlots;  ///< Start of each slot in m_vBulkBuffer
     mutable int m_nFinalResultIdx;
     mutable int m_nEngineID;
+
+    static_assert(MUP_PRECOMPILED_MAX_LEN>=1 && MUP_PRECOMPILED_MAX_LEN<=24, "MUP_PRECOMPILED_MAX_LEN must be in the range [1, 24]");
+    static const int s_nNumPrecompiledEngines = 1 << (MUP_PRECOMPILED_MAX_LEN - 1);
+    static const int s_nNumCallbackDefs = 4;                 ///< Function, binary, infix and postfix operator definitions
+    static const std::uint32_t s_nBlobMagic = 0x4250554d;    ///< "MUPB" in serialized bytecode
+    static const std::uint32_t s_nBlobVersion = 1;
 };
 
   template<typename TValue, typename TString>
@@ -26,6 +26,7 @@
 #define MU_PARSER_BYTECODE_H
 
 #include <vector>
+#include <algorithm>
 
 #include "muParserDef.h"
 #include "muParserStack.h"
@@ -50,11 +51,13 @@ MUP_NAMESPACE_START
                                       std::char_traits<typename TString::value_type>,  
                                       std::allocator<typename TString::value_type> > stringstream_type;
       typedef void (*fun_type)(TValue*, int narg);
+      typedef void (*vfun_type)(TValue *const *args, TValue *out, int narg, std::size_t n);
+      typedef MathImpl<TValue, TString> math_type;
+      typedef VecMathImpl<TValue, TString> vmath_type;
 
       unsigned m_iStackPos;
-      int m_nFoldableValues;
       std::size_t m_iMaxStackSize;
-      rpn_type  m_vRPN;
+      rpn_type  m_vRPN;                   ///< Tokens, only used until the bytecode is finalized
       bool m_bEnableOptimizer;
 
       //-------------------------------------------------------------------------------------------
@@ -86,13 +89,40 @@ MUP_NAMESPACE_START
 
   public:
 
+      //-------------------------------------------------------------------------------------------
+      /** \brief A single instruction of the finalized bytecode.
+
+        This is the part of a token needed for evaluation. Identifiers are kept in a separate
+        table so that the instructions of longer expressions still fit into the L1 cache.
+      */
+      struct SInstr
+      {
+        ECmdCode Cmd;
+
+        union
+        {
+          typename token_type::SValDef Val;
+          typename token_type::SFunDef Fun;
+          typename token_type::SOprtDef Oprt;
+        };
+
+        bool IsConst() const
+        {
+          return Cmd==cmVAL_EX && Val.ptr==&ParserBase<TValue, TString>::g_NullValue;
+        }
+      };
+
       //-------------------------------------------------------------------------------------------
       ParserByteCode()
         :m_iStackPos(0)
         ,m_iMaxStackSize(0)
         ,m_vRPN()
         ,m_bEnableOptimizer(true)
+        ,m_vCode()
+        ,m_vIdent()
         ,m_nEngineID(-1)
+        ,m_eEngineFallback(efSHAPE)
+        ,m_nOptimized()
       {
         m_vRPN.reserve(50);
       }
@@ -118,7 +148,31 @@ MUP_NAMESPACE_START
 
         m_iStackPos = a_ByteCode.m_iStackPos;
         m_vRPN = a_ByteCode.m_vRPN;
+        m_vCode = a_ByteCode.m_vCode;
+        m_vIdent = a_ByteCode.m_vIdent;
         m_iMaxStackSize = a_ByteCode.m_iMaxStackSize;
+        m_bEnableOptimizer = a_ByteCode.m_bEnableOptimizer;
+        m_nEngineID = a_ByteCode.m_nEngineID;
+        m_eEngineFallback = a_ByteCode.m_eEngineFallback;
+        std::copy(a_ByteCode.m_nOptimized, a_ByteCode.m_nOptimized + opCOUNT, m_nOptimized);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Enable or disable the bytecode optimizer.
+
+        The optimizer folds constant subexpressions, merges values into variable tokens and 
+        replaces frequent operator sequences with fused callbacks. Takes effect the next time 
+        bytecode is created.
+      */
+      void EnableOptimizer(bool bStat)
+      {
+        m_bEnableOptimizer = bStat;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      bool IsOptimizerEnabled() const
+      {
+        return m_bEnableOptimizer;
       }
 
       //-------------------------------------------------------------------------------------------
@@ -164,13 +218,15 @@ MUP_NAMESPACE_START
           bOptimized = TryConstantFolding(tok);
           if (!bOptimized)
           {
+            // Builtin operators are identified by their callback, user defined operators 
+            // may use the same names
             if (tok.Cmd==cmOPRT_BIN)
             {
-              if ( tok.Ident==_SL("+") || tok.Ident==_SL("-"))
+              if (tok.Fun.ptr==&math_type::Add || tok.Fun.ptr==&math_type::Sub)
                 bOptimized = TryOptimizeAddSub(tok);
-              else if (tok.Ident==_SL("*"))
+              else if (tok.Fun.ptr==&math_type::Mul)
                 bOptimized = TryOptimizeMul(tok);
-              else if (tok.Ident==_SL("^"))
+              else if (tok.Fun.ptr==&math_type::Pow)
                 bOptimized = TryOptimizePow(tok);
             }
           }
@@ -190,6 +246,10 @@ MUP_NAMESPACE_START
       }
 
       //-------------------------------------------------------------------------------------------
+      /** \brief Apply the final optimizations and create the instructions used for evaluation.
+      
+        The tokens are not needed afterwards and will be released.
+      */
       void Finalize()
       {
         Substitute();
@@ -199,51 +259,21 @@ MUP_NAMESPACE_START
         tok.Cmd = cmEND;
         m_vRPN.push_back(tok);
 
-        unsigned nEngineBits = 0;
-
-        for (std::size_t i=0; i<m_vRPN.size(); ++i)
-        {
-          token_type &tok = m_vRPN[i];
+        m_nEngineID = ComputeEngineID(m_vRPN, m_eEngineFallback);
 
-          switch(tok.Cmd)
-          {
-          case cmVAL_EX:  nEngineBits = nEngineBits << 1;
-                          nEngineBits |= 1;
-                          break;
-
-          case cmFUNC:    if (i==0)
-                          {
-                            // RPN fngt mit funktion an, wird nicht optimiert: z.B. "rnd()+1"
-                            m_nEngineID = -1;
-                            return;
-                          }
-                          else
-                          {
-                            nEngineBits = nEngineBits << 1;
-                          }
-          case cmEND:     break;
-
-          default:        m_nEngineID = -1;
-                          return;
-          }
-        }
-
-        if (nEngineBits!=0 && ((nEngineBits & 1)==0 || (nEngineBits==1)))
-        {
-            m_nEngineID = (int)(nEngineBits/2);
-        }
-        else
-        {
-            m_nEngineID = -1;
-        }
+        Encode(m_vRPN, m_vCode, m_vIdent);
+        rpn_type().swap(m_vRPN);
       }
 
       //-------------------------------------------------------------------------------------------
       void Clear()
       {
         m_vRPN.clear();
+        m_vCode.clear();
+        m_vIdent.clear();
         m_iStackPos     = 0;
         m_iMaxStackSize = 0;
+        std::fill(m_nOptimized, m_nOptimized + opCOUNT, 0u);
       }
 
       //-------------------------------------------------------------------------------------------
@@ -253,18 +283,27 @@ MUP_NAMESPACE_START
       }
 
       //-------------------------------------------------------------------------------------------
+      /** \brief Returns the number of instructions including the end marker. */
       std::size_t GetSize() const
       {
-        return m_vRPN.size();
+        return m_vCode.size();
       }
 
       //-------------------------------------------------------------------------------------------
-      const token_type* GetBase() const
+      /** \brief Returns the instructions of the finalized bytecode. */
+      const SInstr* GetBase() const
       {
-        if (m_vRPN.size()==0)
+        if (m_vCode.size()==0)
           throw ParserError<TString>(ecINTERNAL_ERROR);
         else
-          return &m_vRPN[0];
+          return &m_vCode[0];
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the identifier of an instruction. */
+      const TString& GetIdent(std::size_t a_iInstr) const
+      {
+        return m_vIdent[a_iInstr];
       }
 
       //-------------------------------------------------------------------------------------------
@@ -273,20 +312,169 @@ MUP_NAMESPACE_START
           return m_nEngineID;
       }
 
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns how often the optimizer applied a rewrite to the expression.
+
+        Bytecode set by SetCode was not created by the optimizer, all counts are zero.
+      */
+      unsigned GetNumOptimized(EOptimization a_eOpt) const
+      {
+          return m_nOptimized[a_eOpt];
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the reason why no precompiled engine exists, efNONE if there is one. */
+      EEngineFallback GetEngineFallback() const
+      {
+          return m_eEngineFallback;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Replace the bytecode with finalized instructions, e.g. loaded from a file.
+          \param a_vCode The instructions including the end marker.
+          \param a_vIdent The identifiers of the instructions.
+          \param a_nMaxStackSize The stack size needed by the instructions.
+      */
+      void SetCode(const std::vector<SInstr> &a_vCode, 
+                   const std::vector<TString> &a_vIdent, 
+                   std::size_t a_nMaxStackSize)
+      {
+        Clear();
+        m_vCode  = a_vCode;
+        m_vIdent = a_vIdent;
+        m_iMaxStackSize = a_nMaxStackSize - 1;
+        m_nEngineID = ComputeEngineID(m_vCode, m_eEngineFallback);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Change the address of a variable in the finalized bytecode.
+          \param a_pOld The current address of the variable.
+          \param a_pNew The new address.
+          \param a_nStride The new stride of the variable.
+          \return The number of instructions changed.
+
+        Instructions are patched in place, the shape of the bytecode and thus its engine stays
+        the same. The caller must make sure that no other variable shares the old address.
+      */
+      int RebindVar(const TValue *a_pOld, TValue *a_pNew, std::size_t a_nStride)
+      {
+        int nChanged = 0;
+        for (std::size_t i=0; i<m_vCode.size(); ++i)
+        {
+          SInstr &instr = m_vCode[i];
+          if (instr.Cmd==cmVAL_EX && instr.Val.ptr==a_pOld)
+          {
+            instr.Val.ptr = a_pNew;
+            instr.Val.stride = a_nStride;
+            ++nChanged;
+          }
+          else if (instr.Cmd==cmASSIGN && instr.Oprt.ptr==a_pOld)
+          {
+            instr.Oprt.ptr = a_pNew;
+            instr.Oprt.stride = a_nStride;
+            ++nChanged;
+          }
+        }
+
+        return nChanged;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the number of callbacks created by the optimizer. */
+      static int GetNumInternalFun()
+      {
+        return s_nNumInternalFun;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the index of a callback created by the optimizer or -1. */
+      static int GetInternalFunIdx(fun_type a_pFun)
+      {
+        for (int i=0; i<GetNumInternalFun(); ++i)
+        {
+          if (c_InternalFun[i].ptr==a_pFun)
+            return i;
+        }
+
+        return -1;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns a callback created by the optimizer and its vectorized version. */
+      static void GetInternalFun(int a_iFun, fun_type &a_pFun, vfun_type &a_pVFun)
+      {
+        a_pFun  = c_InternalFun[a_iFun].ptr;
+        a_pVFun = c_InternalFun[a_iFun].vptr;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns how a specialized engine evaluates an instruction.
+      
+        Only the builtin arithmetic operators and the fused operators created by the optimizer
+        can be evaluated inline. User defined operators are identified by their callback 
+        and yield ioNONE even if they use the same name.
+      */
+      static EInlineOp GetInlineOp(const SInstr &a_Instr)
+      {
+        switch(a_Instr.Cmd)
+        {
+        case cmVAL_EX: return ioVAL;
+        case cmEND:    return ioEND;
+        case cmFUNC:   break;
+        default:       return ioNONE;
+        }
+
+        fun_type pFun = a_Instr.Fun.ptr;
+        if (a_Instr.Fun.argc==2)
+        {
+          if (pFun==math_type::Add) return ioADD;
+          if (pFun==math_type::Sub) return ioSUB;
+          if (pFun==math_type::Mul) return ioMUL;
+          if (pFun==math_type::Div) return ioDIV;
+        }
+        else if (a_Instr.Fun.argc==3)
+        {
+          if (pFun==FUN_AA) return ioFUN_AA;
+          if (pFun==FUN_AS) return ioFUN_AS;
+          if (pFun==FUN_MA) return ioFUN_MA;
+          if (pFun==FUN_AM) return ioFUN_AM;
+          if (pFun==FUN_MM) return ioFUN_MM;
+          if (pFun==FUN_DD) return ioFUN_DD;
+          if (pFun==FUN_MD) return ioFUN_MD;
+          if (pFun==FUN_DM) return ioFUN_DM;
+          if (pFun==FUN_DA) return ioFUN_DA;
+          if (pFun==FUN_AD) return ioFUN_AD;
+          if (pFun==FUN_DS) return ioFUN_DS;
+          if (pFun==FUN_SD) return ioFUN_SD;
+        }
+
+        return ioNONE;
+      }
+
       //-------------------------------------------------------------------------------------------
       void AsciiDump()
       {
-        if (!m_vRPN.size()) 
+        // Before finalization the tokens created so far are dumped
+        std::vector<SInstr> vTmpCode;
+        std::vector<TString> vTmpIdent;
+        if (!m_vCode.size() && m_vRPN.size())
+          Encode(m_vRPN, vTmpCode, vTmpIdent);
+
+        const std::vector<SInstr> &vCode = (m_vCode.size()) ? m_vCode : vTmpCode;
+        const std::vector<TString> &vIdent = (m_vCode.size()) ? m_vIdent : vTmpIdent;
+
+        if (!vCode.size()) 
         {
           _OUT << _SL("No bytecode available\n");
           return;
         }
 
+        const int nSize = (int)vCode.size() - ((vCode.back().Cmd==cmEND) ? 1 : 0);
         TString sEngineBits;
 
         if (m_nEngineID>0)
         {
-          for (int i=m_vRPN.size()-2; i>=0; --i)
+          for (int i=nSize-1; i>=0; --i)
           {
             sEngineBits += (m_nEngineID & 1<<i) ? 'V' : 'C';
           }
@@ -297,44 +485,56 @@ MUP_NAMESPACE_START
         }
 
         _OUT << _SL("Engine ID:") << std::dec << m_nEngineID << _SL(";  Code: ") << sEngineBits;
-        _OUT << _SL(";  Number of tokens:") << (int)m_vRPN.size()-1 << _SL("\n");
-        for (std::size_t i=0; i<m_vRPN.size() && m_vRPN[i].Cmd!=cmEND; ++i)
+        _OUT << _SL(";  Number of tokens:") << nSize << _SL("\n");
+
+        int nStackPos = 0;
+        for (int i=0; i<nSize; ++i)
         {
-          _OUT << std::dec << i << _SL(" : ") << m_vRPN[i].StackPos << _SL("\t");
+          const SInstr &instr = vCode[i];
+          switch (instr.Cmd)
+          {
+          case  cmVAL_EX: ++nStackPos; break;
+          case  cmFUNC:   nStackPos -= instr.Fun.argc - 1; break;
+          case  cmASSIGN: --nStackPos; break;
+          default:        break;
+          }
+
+          _OUT << std::dec << i << _SL(" : ") << nStackPos << _SL("\t");
 
-          switch (m_vRPN[i].Cmd)
+          switch (instr.Cmd)
           {
           case  cmVAL_EX:
                 _OUT << _SL("VAL \t");
                
-                if (m_vRPN[i].Val.ptr==&ParserBase<TValue, TString>::g_NullValue)
+                if (instr.IsConst())
                 {
                   _OUT << _SL("[ADDR: &ParserBase::g_NullValue]");
                 }
                 else
                 {
-                  _OUT << _SL("[ADDR: 0x") << std::hex << m_vRPN[i].Val.ptr << _SL("]");
-                  _OUT << _SL("[IDENT:")   << m_vRPN[i].Ident << _SL("]"); 
+                  _OUT << _SL("[ADDR: 0x") << std::hex << instr.Val.ptr << _SL("]");
+                  _OUT << _SL("[IDENT:")   << vIdent[i] << _SL("]"); 
+                  _OUT << _SL("[MUL:")     << std::dec << instr.Val.mul << _SL("]"); 
                 }
 
-                _OUT << _SL("[CON:")  << m_vRPN[i].Val.fixed << _SL("]\n");
+                _OUT << _SL("[CON:")  << std::dec << instr.Val.fixed << _SL("]\n");
                 break;
 
           case  cmFUNC:
                 _OUT << _SL("CALL\t");
-                _OUT << _SL("[IDENT:")   << m_vRPN[i].Ident << _SL("]"); 
-                _OUT << _SL("[ARG:")     << std::dec << m_vRPN[i].Fun.argc << _SL("]"); 
-                _OUT << _SL("[ADDR: 0x") << std::hex << m_vRPN[i].Fun.ptr  << _SL("]"); 
+                _OUT << _SL("[IDENT:")   << vIdent[i] << _SL("]"); 
+                _OUT << _SL("[ARG:")     << std::dec << instr.Fun.argc << _SL("]"); 
+                _OUT << _SL("[ADDR: 0x") << std::hex << instr.Fun.ptr  << _SL("]"); 
                 _OUT << _SL("\n");
                 break;
 
           case  cmASSIGN: 
                 _OUT << _SL("ASSIGN\t");
-                _OUT << _SL("[ADDR: 0x") << m_vRPN[i].Oprt.ptr << _SL("]\n"); 
+                _OUT << _SL("[ADDR: 0x") << instr.Oprt.ptr << _SL("]\n"); 
                 break; 
 
           default:
-                _OUT << _SL("(unknown code: ") << m_vRPN[i].Cmd << _SL(")\n"); 
+                _OUT << _SL("(unknown code: ") << instr.Cmd << _SL(")\n"); 
                 break;
           } // switch cmdCode
         } // while bytecode
@@ -344,236 +544,295 @@ MUP_NAMESPACE_START
 
   private:
 
+      /** \brief A callback used by the optimizer. */
+      struct SInternalFun
+      {
+        fun_type ptr;
+        vfun_type vptr;
+      };
+
+      static const int s_nNumInternalFun = 22;
+      static const SInternalFun c_InternalFun[s_nNumInternalFun];  ///< Callbacks of the optimizer, indexed for serialization
+
+      std::vector<SInstr> m_vCode;        ///< Instructions of the finalized bytecode
+      std::vector<TString> m_vIdent;      ///< Identifiers of the instructions (debug dump only)
       int m_nEngineID;
+      EEngineFallback m_eEngineFallback;  ///< Reason why m_nEngineID is -1
+      unsigned m_nOptimized[opCOUNT];     ///< Number of rewrites applied by the optimizer
 
       //-------------------------------------------------------------------------------------------
-      bool TryOptimizeAddSub(token_type & /*tok*/)
+      /** \brief Returns the ID of the precompiled engine matching the tokens or instructions 
+                 or -1.
+      */
+      template<typename TItem>
+      static int ComputeEngineID(const std::vector<TItem> &a_vCode, EEngineFallback &a_eFallback)
       {
-        return false;
-/*
-        std::size_t sz = m_vRPN.size();
+        // The bits of longer bytecode would overflow
+        a_eFallback = efTOO_LONG;
+        if (a_vCode.size() - 1 > MUP_PRECOMPILED_MAX_LEN)
+          return -1;
 
-        // 0.) Transform minus operations into an addition of a negative value. This will make 
-        //     further optimization easier since i only have to deal with additions.
-        if (sz>=1 && m_vRPN[sz-1].Cmd == cmVAL_EX && tok.Cmd == cmOPRT_BIN && tok.Ident==_SL("-") ) 
+        unsigned nEngineBits = 0;
+        int nValues = 0;
+
+        for (std::size_t i=0; i<a_vCode.size(); ++i)
         {
-          // change sign of the last value
-          if (m_vRPN[sz-1].Val.mul!=0)
-            m_vRPN[sz-1].Val.mul *= -1;
-          
-          if (m_vRPN[sz-1].Val.fixed!=0)
-            m_vRPN[sz-1].Val.fixed *= -1;
-          
-          // transform the subtraction into an addition
-          tok.Fun.ptr = MathImpl<TValue, TString>::Add;
-          tok.Ident = _SL("+");
-
-          // maybe there is another addition directly in front?
-          if (sz>=2 && m_vRPN[sz-2].Cmd==cmFUNC && m_vRPN[sz-2].Ident==_SL("+") && m_vRPN[sz-1].Cmd==cmVAL_EX)
+          const TItem &tok = a_vCode[i];
+
+          switch(tok.Cmd)
           {
-            token_type t1 = m_vRPN[sz-1];
-            token_type t2 = m_vRPN[sz-2];
-            RemoveTok();
-            RemoveTok();
+          case cmVAL_EX:  nEngineBits = nEngineBits << 1;
+                          nEngineBits |= 1;
+                          ++nValues;
+                          break;
 
-            AddVal(t1);
-            AddFun(t2);
+          case cmFUNC:    if (i==0)
+                          {
+                            // RPN fngt mit funktion an, wird nicht optimiert: z.B. "rnd()+1"
+                            a_eFallback = efLEADING_FUNCTION;
+                            return -1;
+                          }
+                          else
+                          {
+                            nEngineBits = nEngineBits << 1;
+                            nValues -= tok.Fun.argc - 1;
+                          }
+          case cmEND:     break;
 
-            sz = m_vRPN.size(); // update size; AddFun may have been optimized away
-          }
-          else
-          {
-            // return false since tok must be pushed regardless of this optimization
-            return false;
+          case cmASSIGN:  a_eFallback = efASSIGNMENT;
+                          return -1;
+
+          default:        a_eFallback = efSHAPE;
+                          return -1;
           }
         }
 
-        // 1.) Test try to join values by partially calculating the result and storing it into a 
-        //     val_ex
-        //
-        // Simple optimization based on pattern recognition for a shitload of different
-        // bytecode combinations of addition/subtraction
-        //
-        // If possible Addition/Subtraction is applied immediately and the value tokens
-        // are joined.
-        if (sz>=2 && m_vRPN[sz-1].Cmd == cmVAL_EX && m_vRPN[sz-2].Cmd == cmVAL_EX) 
+        if (nEngineBits!=0 && ((nEngineBits & 1)==0 || (nEngineBits==1)))
+        {
+            a_eFallback = efNONE;
+            return (int)(nEngineBits/2);
+        }
+        else
+        {
+            a_eFallback = (nValues>1) ? efMULTIPLE_RESULTS : efSHAPE;
+            return -1;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Split tokens into instructions and identifiers. */
+      static void Encode(const rpn_type &a_vRPN, std::vector<SInstr> &a_vCode, std::vector<TString> &a_vIdent)
+      {
+        a_vCode.resize(a_vRPN.size());
+        a_vIdent.resize(a_vRPN.size());
+
+        for (std::size_t i=0; i<a_vRPN.size(); ++i)
         {
-          if ( (m_vRPN[sz-1].Val.mul==0 && m_vRPN[sz-2].Val.mul==0) || 
-               (m_vRPN[sz-1].Val.mul==0 && m_vRPN[sz-2].Val.mul!=0) || 
-               (m_vRPN[sz-1].Val.mul!=0 && m_vRPN[sz-2].Val.mul==0) || 
-               (m_vRPN[sz-1].Val.ptr==m_vRPN[sz-2].Val.ptr) )
+          const token_type &tok = a_vRPN[i];
+          SInstr &instr = a_vCode[i];
+          instr.Cmd = tok.Cmd;
+
+          switch(tok.Cmd)
           {
-            m_vRPN[sz-2].Val.ptr    = (m_vRPN[sz-1].Val.mul==0) ? m_vRPN[sz-2].Val.ptr : m_vRPN[sz-1].Val.ptr;
-            m_vRPN[sz-2].Val.fixed += ((tok.Ident==_SL("-")) ? -1 : 1) * m_vRPN[sz-1].Val.fixed;
-            m_vRPN[sz-2].Val.mul   += ((tok.Ident==_SL("-")) ? -1 : 1) * m_vRPN[sz-1].Val.mul;
+          case cmVAL_EX: instr.Val  = tok.Val;  break;
+          case cmFUNC:   instr.Fun  = tok.Fun;  break;
+          case cmASSIGN: instr.Oprt = tok.Oprt; break;
+          default:       break;
+          }
+
+          a_vIdent[i] = tok.Ident;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns true if tok is a call of the builtin binary operator callback pFun. */
+      static bool IsBuiltinOprt(const token_type &tok, fun_type pFun)
+      {
+        return tok.Cmd==cmFUNC && tok.Fun.ptr==pFun && tok.Fun.argc==2;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Join the two topmost value tokens of an addition or subtraction.
+
+        This is possible if at least one of them is constant or if both refer to the same
+        variable. The result is a single value token.
+      */
+      bool TryOptimizeAddSub(const token_type &tok)
+      {
+        std::size_t sz = m_vRPN.size();
+        if (sz<2 || m_vRPN[sz-1].Cmd!=cmVAL_EX || m_vRPN[sz-2].Cmd!=cmVAL_EX)
+          return false;
 
-            RemoveTok();
+        token_type &t1 = m_vRPN[sz-2],
+                   &t2 = m_vRPN[sz-1];
 
-            if (m_vRPN.back().Val.mul==0)
-              m_vRPN.back().ResetVariablePart();
+        if (!t1.IsConst() && !t2.IsConst() && (t1.Val.ptr!=t2.Val.ptr || t1.Val.stride!=t2.Val.stride))
+          return false;
 
-            return true;
-          } 
+        const TValue fSign = (tok.Fun.ptr==&math_type::Sub) ? (TValue)-1 : (TValue)1;
+        if (t1.IsConst())
+        {
+          t1.Val.ptr    = t2.Val.ptr;
+          t1.Val.stride = t2.Val.stride;
         }
 
-        return false;
-*/
+        t1.Val.mul   += fSign * t2.Val.mul;
+        t1.Val.fixed += fSign * t2.Val.fixed;
+
+        m_vRPN.pop_back();
+        m_iStackPos = t1.StackPos;
+        ++m_nOptimized[opJOIN_ADD_SUB];
+        return true;
       }
 
       //-------------------------------------------------------------------------------------------
+      /** \brief Join the multiplication of a value token with a constant. */
       bool TryOptimizeMul(const token_type & /*tok*/)
       {
-        return false;
-/*
         std::size_t sz = m_vRPN.size();
-        if (sz<2 || m_vRPN[sz-1].Cmd != cmVAL_EX ||  m_vRPN[sz-2].Cmd != cmVAL_EX) 
+        if (sz<2 || m_vRPN[sz-1].Cmd!=cmVAL_EX || m_vRPN[sz-2].Cmd!=cmVAL_EX)
           return false;
 
-        // Value multiplied with a variable or vice versa
-        if (m_vRPN[sz-1].Val.mul==0 && m_vRPN[sz-2].Val.mul!=0)
+        token_type &t1 = m_vRPN[sz-2],
+                   &t2 = m_vRPN[sz-1];
+
+        if (t1.IsConst())
         {
-          m_vRPN[sz-2].Cmd        = cmVAL_EX;
-          m_vRPN[sz-2].Val.ptr    = m_vRPN[sz-2].Val.ptr;
-          m_vRPN[sz-2].Val.mul   *= m_vRPN[sz-1].Val.fixed;
-          m_vRPN[sz-2].Val.fixed *= m_vRPN[sz-1].Val.fixed;
-          RemoveTok();
-          return true;
+          // constant multiplied with a variable
+          const TValue fFactor = t1.Val.fixed;
+          t1.Val.ptr    = t2.Val.ptr;
+          t1.Val.stride = t2.Val.stride;
+          t1.Val.mul    = t2.Val.mul   * fFactor;
+          t1.Val.fixed  = t2.Val.fixed * fFactor;
         }
-        else if (m_vRPN[sz-1].Val.mul!=0 && m_vRPN[sz-2].Val.mul==0)
+        else if (t2.IsConst())
         {
-          m_vRPN[sz-2].Cmd       = cmVAL_EX;
-          m_vRPN[sz-2].Val.ptr   = m_vRPN[sz-1].Val.ptr;
-          m_vRPN[sz-2].Val.mul   = m_vRPN[sz-1].Val.mul   * m_vRPN[sz-2].Val.fixed;
-          m_vRPN[sz-2].Val.fixed = m_vRPN[sz-1].Val.fixed * m_vRPN[sz-2].Val.fixed;
-          RemoveTok();
-          return true;
+          // variable multiplied with a constant
+          t1.Val.mul   *= t2.Val.fixed;
+          t1.Val.fixed *= t2.Val.fixed;
+        }
+        else
+        {
+          return false;
         }
 
-        return false;
-*/
+        m_vRPN.pop_back();
+        m_iStackPos = t1.StackPos;
+        ++m_nOptimized[opJOIN_MUL];
+        return true;
       }
 
       //-------------------------------------------------------------------------------------------
-      /** \brief Tries to replace calls to pow with low integer exponents with 
-                 faster versions. 
+      /** \brief Tries to replace calls to pow with low integer exponents with
+                 faster versions.
       */
       bool TryOptimizePow(const token_type & /*tok*/)
       {
-        return false;
-/*
         std::size_t sz = m_vRPN.size();
         if (sz<2)
           return false;
 
-        token_type &top = m_vRPN[sz-1];
-        if (top.Cmd != cmVAL_EX) 
+        const token_type &top = m_vRPN[sz-1];
+        if (!top.IsConst())
           return false;
 
-        token_type newTok(tok);
         int nPow = (int)(top.Val.fixed);
-        if ( nPow==top.Val.fixed && top.Val.fixed>=2 && top.Val.fixed<=5)
-        {
-          RemoveTok();
-          newTok.Cmd = cmFUNC;
-          newTok.Fun.argc = 1;
-
-          switch(nPow)
-          {
-          case 2:  newTok.Fun.ptr = FUN_P2; newTok.Ident = _SL("^2"); break;
-          case 3:  newTok.Fun.ptr = FUN_P3; newTok.Ident = _SL("^3"); break;
-          case 4:  newTok.Fun.ptr = FUN_P4; newTok.Ident = _SL("^4"); break;
-          case 5:  newTok.Fun.ptr = FUN_P5; newTok.Ident = _SL("^5"); break;
-          default: throw ParserError<TString>(ecINTERNAL_ERROR);            
-          }
+        if (nPow!=top.Val.fixed || nPow<2 || nPow>5)
+          return false;
 
-          AddTok(newTok);
-          return true;
+        token_type newTok;
+        switch(nPow)
+        {
+        case 2:  newTok.SetFun(cmFUNC, FUN_P2, 1, oaNONE, 0, _SL("^2"), &vmath_type::template Map1<FUN_P2>); break;
+        case 3:  newTok.SetFun(cmFUNC, FUN_P3, 1, oaNONE, 0, _SL("^3"), &vmath_type::template Map1<FUN_P3>); break;
+        case 4:  newTok.SetFun(cmFUNC, FUN_P4, 1, oaNONE, 0, _SL("^4"), &vmath_type::template Map1<FUN_P4>); break;
+        case 5:  newTok.SetFun(cmFUNC, FUN_P5, 1, oaNONE, 0, _SL("^5"), &vmath_type::template Map1<FUN_P5>); break;
+        default: throw ParserError<TString>(ecINTERNAL_ERROR);
         }
 
-        return false;
-*/
+        RemoveTok();
+        AddTok(newTok);
+        ++m_nOptimized[opPOW];
+        return true;
       }
 
       //---------------------------------------------------------------------------
-      bool TryConstantFolding(const token_type & /*tok*/)
+      /** \brief Evaluate a callback at compile time if all of its arguments are constant.
+
+        Callbacks without arguments are never folded since they may have side effects.
+      */
+      bool TryConstantFolding(const token_type &tok)
       {
-        return false;
-/*
         std::size_t sz = m_vRPN.size();
-        if (sz<(std::size_t)tok.Fun.argc || tok.Fun.argc>=20)
-          return false;
-
-        if (tok.Fun.argc==0)
+        if (tok.Fun.argc<=0 || tok.Fun.argc>20 || sz<(std::size_t)tok.Fun.argc)
           return false;
 
         TValue buf[20];
         for (int i=0; i<tok.Fun.argc; ++i)
         {
           const token_type &t = m_vRPN[sz - tok.Fun.argc + i];
-      
-          if (t.Cmd!=cmVAL_EX)
-            return false;
 
           // If there is a variable component no optimization is possible,
           // else collect the constant value for function application
-          if (t.Val.ptr==&ParserBase<TValue, TString>::g_NullValue)
+          if (!t.IsConst())
             return false;
-          else
-            buf[i] = t.Val.fixed;
+
+          buf[i] = t.Val.fixed;
         }
 
-        // all parameters are constant, remove them from the stack and apply the function
+        // all parameters are constant, apply the function and remove them from the stack
+        (*tok.Fun.ptr)(buf, tok.Fun.argc);
         m_vRPN.erase(m_vRPN.end() - tok.Fun.argc + 1, m_vRPN.end());
 
-        token_type &result = m_vRPN.back(); 
-        result.ResetVariablePart();
-        (*(tok.Fun).ptr)(buf, tok.Fun.argc);
-        result.Val.fixed = buf[0];
+        token_type &result = m_vRPN.back();
+        result.SetVal(buf[0], result.Ident);
         m_iStackPos = result.StackPos;
+        ++m_nOptimized[opCONST_FOLD];
         return true;
-*/
       }
 
       //---------------------------------------------------------------------------------------------
-      bool TrySubstitute(const TString & /*op1*/, const TString & /*op2*/, fun_type /*pFun*/, token_type & /*t1*/, token_type & /*t2*/)
+      /** \brief Substitute two successive binary operators with a single function call.
+
+        t2 computes the right hand operand of t1. If they are calls of the builtin operators
+        pOp2 and pOp1 both are replaced by a call of pFun with three arguments.
+      */
+      bool TrySubstitute(fun_type pOp1,
+                         fun_type pOp2,
+                         fun_type pFun,
+                         vfun_type pVFun,
+                         const token_type &t1,
+                         token_type &t2)
       {
-        return false;
-/*
-        if (t1.Ident==op1 && t2.Ident==op2)
-        {
-          t2.Ident = op1 + op2;
-          t2.Fun.ptr  = pFun;
-          t2.Fun.argc = 3;
-          return true;
-        }
+        if (!IsBuiltinOprt(t1, pOp1) || !IsBuiltinOprt(t2, pOp2))
+          return false;
 
-        return false;
-*/
+        t2.SetFun(cmFUNC, pFun, 3, oaNONE, 0, t1.Ident + t2.Ident, pVFun);
+        t2.StackPos = t1.StackPos;
+        ++m_nOptimized[opFUSE];
+        return true;
       }
 
       //---------------------------------------------------------------------------------------------
       /** \brief Substitute Multiplication with a power of x with a single function call.
       */
-      bool TrySubstitute(const TString & /*op1*/,
-                         fun_type /*pFunPow*/,
-                         fun_type /*pFun*/,
-                         token_type &/*t1*/,
-                         token_type &/*t2*/,
-                         const TString &/*sIdent*/)
-      {
-        return false;
-/*
-        if (t1.Ident==op1 && t2.Fun.ptr==pFunPow)
-        {
-          t2.Ident = sIdent;
-          t2.Fun.ptr  = pFun;
-          t2.Fun.argc = 2;
-          return true;
-        }
+      bool TrySubstitute(fun_type pOp1,
+                         fun_type pFunPow,
+                         fun_type pFun,
+                         vfun_type pVFun,
+                         const token_type &t1,
+                         token_type &t2,
+                         const TString &sIdent)
+      {
+        if (!IsBuiltinOprt(t1, pOp1) || t2.Cmd!=cmFUNC || t2.Fun.ptr!=pFunPow)
+          return false;
 
-        return false;
-*/
+        t2.SetFun(cmFUNC, pFun, 2, oaNONE, 0, sIdent, pVFun);
+        t2.StackPos = t1.StackPos;
+        ++m_nOptimized[opFUSE];
+        return true;
       }
+
       //-------------------------------------------------------------------------------------------
       void Substitute()
       {
@@ -596,29 +855,30 @@ MUP_NAMESPACE_START
           {
           case  cmFUNC:
                 // Herausfinden, ob zwei operatoren kombiniert werden knnen
-                if (tokOrig.Cmd==cmFUNC && tokNew.Cmd==cmFUNC)
+                if (tokNew.Cmd==cmFUNC)
                 {
-                  if (TrySubstitute(_SL("+"), _SL("+"), FUN_AA, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("*"), _SL("*"), FUN_MM, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("+"), _SL("*"), FUN_MA, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("*"), _SL("+"), FUN_AM, tokOrig, tokNew)) break;
-
-                  if (TrySubstitute(_SL("/"), _SL("/"), FUN_DD, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("*"), _SL("/"), FUN_DM, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("/"), _SL("*"), FUN_MD, tokOrig, tokNew)) break;
-
-                  if (TrySubstitute(_SL("+"), _SL("/"), FUN_DA, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("/"), _SL("+"), FUN_AD, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("-"), _SL("/"), FUN_DS, tokOrig, tokNew)) break;
-                  if (TrySubstitute(_SL("/"), _SL("-"), FUN_SD, tokOrig, tokNew)) break;
-
-                  if (TrySubstitute(_SL("*"), FUN_P2, FUN_P2M, tokOrig, tokNew, _SL("^2*"))) break;
-                  if (TrySubstitute(_SL("*"), FUN_P3, FUN_P3M, tokOrig, tokNew, _SL("^3*"))) break;
-                  if (TrySubstitute(_SL("*"), FUN_P4, FUN_P4M, tokOrig, tokNew, _SL("^4*"))) break;
-
-                  if (TrySubstitute(_SL("+"), FUN_P2, FUN_P2A, tokOrig, tokNew, _SL("^2+"))) break;
-                  if (TrySubstitute(_SL("+"), FUN_P3, FUN_P3A, tokOrig, tokNew, _SL("^3+"))) break;
-                  if (TrySubstitute(_SL("+"), FUN_P4, FUN_P4A, tokOrig, tokNew, _SL("^4+"))) break;
+                  if (TrySubstitute(math_type::Add, math_type::Add, FUN_AA, &vmath_type::template Map3<FUN_AA>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Sub, math_type::Add, FUN_AS, &vmath_type::template Map3<FUN_AS>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Mul, math_type::Mul, FUN_MM, &vmath_type::template Map3<FUN_MM>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Add, math_type::Mul, FUN_MA, &vmath_type::template Map3<FUN_MA>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Mul, math_type::Add, FUN_AM, &vmath_type::template Map3<FUN_AM>, tokOrig, tokNew)) break;
+
+                  if (TrySubstitute(math_type::Div, math_type::Div, FUN_DD, &vmath_type::template Map3<FUN_DD>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Mul, math_type::Div, FUN_DM, &vmath_type::template Map3<FUN_DM>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Div, math_type::Mul, FUN_MD, &vmath_type::template Map3<FUN_MD>, tokOrig, tokNew)) break;
+
+                  if (TrySubstitute(math_type::Add, math_type::Div, FUN_DA, &vmath_type::template Map3<FUN_DA>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Div, math_type::Add, FUN_AD, &vmath_type::template Map3<FUN_AD>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Sub, math_type::Div, FUN_DS, &vmath_type::template Map3<FUN_DS>, tokOrig, tokNew)) break;
+                  if (TrySubstitute(math_type::Div, math_type::Sub, FUN_SD, &vmath_type::template Map3<FUN_SD>, tokOrig, tokNew)) break;
+
+                  if (TrySubstitute(math_type::Mul, FUN_P2, FUN_P2M, &vmath_type::template Map2<FUN_P2M>, tokOrig, tokNew, _SL("^2*"))) break;
+                  if (TrySubstitute(math_type::Mul, FUN_P3, FUN_P3M, &vmath_type::template Map2<FUN_P3M>, tokOrig, tokNew, _SL("^3*"))) break;
+                  if (TrySubstitute(math_type::Mul, FUN_P4, FUN_P4M, &vmath_type::template Map2<FUN_P4M>, tokOrig, tokNew, _SL("^4*"))) break;
+
+                  if (TrySubstitute(math_type::Add, FUN_P2, FUN_P2A, &vmath_type::template Map2<FUN_P2A>, tokOrig, tokNew, _SL("^2+"))) break;
+                  if (TrySubstitute(math_type::Add, FUN_P3, FUN_P3A, &vmath_type::template Map2<FUN_P3A>, tokOrig, tokNew, _SL("^3+"))) break;
+                  if (TrySubstitute(math_type::Add, FUN_P4, FUN_P4A, &vmath_type::template Map2<FUN_P4A>, tokOrig, tokNew, _SL("^4+"))) break;
                 }
 
                 // Function tokens can't be joined
@@ -634,6 +894,34 @@ MUP_NAMESPACE_START
         m_vRPN = newRPN;
       }
   };
+
+  //-----------------------------------------------------------------------------------------------
+  template<typename TValue, typename TString>
+  const typename ParserByteCode<TValue, TString>::SInternalFun ParserByteCode<TValue, TString>::c_InternalFun[s_nNumInternalFun] = 
+  {
+    { FUN_AA,  &vmath_type::template Map3<FUN_AA>  },
+    { FUN_AS,  &vmath_type::template Map3<FUN_AS>  },
+    { FUN_MA,  &vmath_type::template Map3<FUN_MA>  },
+    { FUN_AM,  &vmath_type::template Map3<FUN_AM>  },
+    { FUN_MM,  &vmath_type::template Map3<FUN_MM>  },
+    { FUN_DD,  &vmath_type::template Map3<FUN_DD>  },
+    { FUN_MD,  &vmath_type::template Map3<FUN_MD>  },
+    { FUN_DM,  &vmath_type::template Map3<FUN_DM>  },
+    { FUN_DA,  &vmath_type::template Map3<FUN_DA>  },
+    { FUN_AD,  &vmath_type::template Map3<FUN_AD>  },
+    { FUN_DS,  &vmath_type::template Map3<FUN_DS>  },
+    { FUN_SD,  &vmath_type::template Map3<FUN_SD>  },
+    { FUN_P2,  &vmath_type::template Map1<FUN_P2>  },
+    { FUN_P3,  &vmath_type::template Map1<FUN_P3>  },
+    { FUN_P4,  &vmath_type::template Map1<FUN_P4>  },
+    { FUN_P5,  &vmath_type::template Map1<FUN_P5>  },
+    { FUN_P2M, &vmath_type::template Map2<FUN_P2M> },
+    { FUN_P3M, &vmath_type::template Map2<FUN_P3M> },
+    { FUN_P4M, &vmath_type::template Map2<FUN_P4M> },
+    { FUN_P2A, &vmath_type::template Map2<FUN_P2A> },
+    { FUN_P3A, &vmath_type::template Map2<FUN_P3A> },
+    { FUN_P4A, &vmath_type::template Map2<FUN_P4A> }
+  };
 } // namespace mu
 
 #endif
@@ -0,0 +1,426 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_CATALOGUE_H
+#define MU_PARSER_CATALOGUE_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <dirent.h>
+  #define MUP_CATALOGUE_MMAP
+#endif
+
+#include "muParserDef.h"
+#include "muParserError.h"
+#include "muParserBase.h"
+#include "muParserCompiled.h"
+
+/** \file
+    \brief Catalogues of named formulas compiled on demand.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Read only view of a file, memory mapped where supported. */
+  class ParserMappedFile
+  {
+  public:
+
+      //-------------------------------------------------------------------------------------------
+      ParserMappedFile()
+        :m_pData(nullptr)
+        ,m_nSize(0)
+      {}
+
+      ParserMappedFile(const ParserMappedFile&) = delete;
+      ParserMappedFile& operator=(const ParserMappedFile&) = delete;
+
+      //-------------------------------------------------------------------------------------------
+      ~ParserMappedFile()
+      {
+#if defined(MUP_CATALOGUE_MMAP)
+        if (m_pData)
+          munmap(const_cast<char*>(m_pData), m_nSize);
+#endif
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Map a file.
+          \return false if the file can not be read.
+      */
+      bool Open(const std::string &a_sPath)
+      {
+#if defined(MUP_CATALOGUE_MMAP)
+        int fd = open(a_sPath.c_str(), O_RDONLY);
+        if (fd<0)
+          return false;
+
+        struct stat st;
+        if (fstat(fd, &st)!=0 || !S_ISREG(st.st_mode))
+        {
+          close(fd);
+          return false;
+        }
+
+        m_nSize = (std::size_t)st.st_size;
+        if (m_nSize)
+        {
+          void *pMap = mmap(nullptr, m_nSize, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (pMap==MAP_FAILED)
+          {
+            close(fd);
+            return false;
+          }
+
+          m_pData = static_cast<const char*>(pMap);
+        }
+
+        close(fd);
+        return true;
+#else
+        std::ifstream file(a_sPath.c_str(), std::ios::binary);
+        if (!file)
+          return false;
+
+        m_vBuffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_pData = m_vBuffer.data();
+        m_nSize = m_vBuffer.size();
+        return true;
+#endif
+      }
+
+      //-------------------------------------------------------------------------------------------
+      const char* GetData() const
+      {
+        return m_pData;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      std::size_t GetSize() const
+      {
+        return m_nSize;
+      }
+
+  private:
+
+      const char *m_pData;
+      std::size_t m_nSize;
+#if !defined(MUP_CATALOGUE_MMAP)
+      std::vector<char> m_vBuffer;
+#endif
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief A catalogue of named formulas compiled on first use.
+
+    Formula files are memory mapped and indexed when they are opened, the formulas themselves
+    are neither copied nor parsed. A formula is compiled into a CompiledExpression using the 
+    definitions of a single parser the first time it is requested, so the startup time and 
+    the memory used only grow with the size of the index and the formulas actually used.
+
+    A formula file contains one formula per line in the form <tt>name = expression</tt>. 
+    Empty lines and lines starting with <tt>#</tt> are ignored. If a name is defined more than 
+    once the last definition is used.
+
+    Get may be called by several threads at the same time, Eval uses a single evaluation 
+    context per formula and must not. Formulas must not be requested while a file is opened.
+  */
+  template<typename TValue, typename TString>
+  class ParserCatalogue
+  {
+  public:
+
+      typedef CompiledExpression<TValue, TString> expr_type;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Create an empty catalogue.
+          \param a_pParser The parser compiling the formulas. Its definitions are used for all 
+                           formulas, its expression is replaced. The parser is not owned by the
+                           catalogue and must outlive it.
+      */
+      explicit ParserCatalogue(ParserBase<TValue, TString> *a_pParser)
+        :m_pParser(a_pParser)
+        ,m_vFile()
+        ,m_Index()
+        ,m_nCompiled(0)
+        ,m_Mutex()
+      {}
+
+      ParserCatalogue(const ParserCatalogue&) = delete;
+      ParserCatalogue& operator=(const ParserCatalogue&) = delete;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Add the formulas of a file or of all files in a directory.
+          \throw ParserError with the code ecINVALID_CATALOGUE if a file can not be read or 
+                 contains a line that is no formula.
+      */
+      void Open(const std::string &a_sPath)
+      {
+#if defined(MUP_CATALOGUE_MMAP)
+        if (DIR *pDir = opendir(a_sPath.c_str()))
+        {
+          std::vector<std::string> vFiles;
+          while (dirent *pEntry = readdir(pDir))
+          {
+            if (pEntry->d_name[0]!='.')
+              vFiles.push_back(a_sPath + "/" + pEntry->d_name);
+          }
+
+          closedir(pDir);
+
+          // Files are added in a defined order so that redefinitions are deterministic
+          std::sort(vFiles.begin(), vFiles.end());
+          for (std::size_t i=0; i<vFiles.size(); ++i)
+            OpenFile(vFiles[i]);
+
+          return;
+        }
+#endif
+        OpenFile(a_sPath);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the compiled formula, compiles it if needed.
+          \throw ParserError with the code ecINVALID_NAME if there is no formula a_sName or the 
+                 error of the parser if the formula can not be compiled.
+      */
+      const expr_type& Get(const TString &a_sName)
+      {
+        return Compile(Find(a_sName)).Expr;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Evaluate a formula using the variables defined in the parser. */
+      TValue Eval(const TString &a_sName)
+      {
+        SCompiled &compiled = Compile(Find(a_sName));
+        return compiled.Expr.Eval(compiled.Ctx);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the text of a formula. */
+      TString GetExpr(const TString &a_sName)
+      {
+        const SEntry &entry = Find(a_sName);
+        return TString(entry.Expr, entry.Expr + entry.ExprLen);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      bool Contains(const TString &a_sName) const
+      {
+        const std::string sKey(a_sName.begin(), a_sName.end());
+        return m_Index.find(SKey(sKey.data(), sKey.length()))!=m_Index.end();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the number of formulas in the catalogue. */
+      std::size_t GetSize() const
+      {
+        return m_Index.size();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the number of formulas compiled so far. */
+      std::size_t GetNumCompiled() const
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_nCompiled;
+      }
+
+  private:
+
+      /** \brief Name of a formula, refers to the mapped file. */
+      struct SKey
+      {
+        SKey(const char *a_pName, std::size_t a_nLen)
+          :Name(a_pName)
+          ,Len(a_nLen)
+        {}
+
+        bool operator==(const SKey &a_Key) const
+        {
+          return Len==a_Key.Len && std::equal(Name, Name + Len, a_Key.Name);
+        }
+
+        const char *Name;
+        std::size_t Len;
+      };
+
+      /** \brief FNV-1a hash of a name. */
+      struct SKeyHash
+      {
+        std::size_t operator()(const SKey &a_Key) const
+        {
+          std::size_t nHash = 2166136261u;
+          for (std::size_t i=0; i<a_Key.Len; ++i)
+            nHash = (nHash ^ (unsigned char)a_Key.Name[i]) * 16777619u;
+
+          return nHash;
+        }
+      };
+
+      /** \brief A compiled formula and the context used by Eval. */
+      struct SCompiled
+      {
+        explicit SCompiled(expr_type a_Expr)
+          :Expr(std::move(a_Expr))
+          ,Ctx(Expr)
+        {}
+
+        expr_type Expr;
+        typename expr_type::Context Ctx;
+      };
+
+      /** \brief A formula, the text refers to the mapped file. */
+      struct SEntry
+      {
+        const char *Expr;
+        std::size_t ExprLen;
+        std::unique_ptr<SCompiled> Compiled;
+      };
+
+      //-------------------------------------------------------------------------------------------
+      SEntry& Find(const TString &a_sName)
+      {
+        const std::string sKey(a_sName.begin(), a_sName.end());
+        auto item = m_Index.find(SKey(sKey.data(), sKey.length()));
+        if (item==m_Index.end())
+          throw ParserError<TString>(ecINVALID_NAME, -1, a_sName);
+
+        return item->second;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      SCompiled& Compile(SEntry &a_Entry)
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!a_Entry.Compiled)
+        {
+          m_pParser->SetExpr(TString(a_Entry.Expr, a_Entry.Expr + a_Entry.ExprLen));
+          a_Entry.Compiled.reset(new SCompiled(m_pParser->Compile()));
+          ++m_nCompiled;
+        }
+
+        return *a_Entry.Compiled;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void OpenFile(const std::string &a_sPath)
+      {
+        std::unique_ptr<ParserMappedFile> pFile(new ParserMappedFile());
+        if (!pFile->Open(a_sPath))
+          throw ParserError<TString>(ecINVALID_CATALOGUE, -1, TString(a_sPath.begin(), a_sPath.end()));
+
+        const char *pPos = pFile->GetData(),
+                   *pEnd = pPos + pFile->GetSize();
+
+        // Validate the whole file before touching the index, the keys point into the mapping
+        std::vector<std::pair<SKey, SEntry> > vEntry;
+        for (int nLine=1; pPos<pEnd; ++nLine)
+        {
+          const char *pEol = std::find(pPos, pEnd, '\n');
+          const char *pBegin = SkipBlanks(pPos, pEol);
+          pPos = pEol + (pEol<pEnd);
+
+          if (pBegin==pEol || *pBegin=='#')
+            continue;
+
+          const char *pAssign = std::find(pBegin, pEol, '=');
+          const char *pName = TrimBlanks(pBegin, pAssign);
+          const char *pExpr = SkipBlanks(pAssign + (pAssign<pEol), pEol);
+          const char *pExprEnd = TrimBlanks(pExpr, pEol);
+          if (pAssign==pEol || pName==pBegin || pExpr==pExprEnd)
+          {
+            const std::string sPos = a_sPath + ":" + std::to_string(nLine);
+            throw ParserError<TString>(ecINVALID_CATALOGUE, -1, TString(sPos.begin(), sPos.end()));
+          }
+
+          vEntry.emplace_back(SKey(pBegin, pName - pBegin), SEntry());
+          vEntry.back().second.Expr = pExpr;
+          vEntry.back().second.ExprLen = pExprEnd - pExpr;
+        }
+
+        m_vFile.push_back(std::move(pFile));
+        for (auto &item : vEntry)
+        {
+          SEntry &entry = m_Index[item.first];
+          entry.Expr = item.second.Expr;
+          entry.ExprLen = item.second.ExprLen;
+          if (entry.Compiled)
+          {
+            entry.Compiled.reset();
+            --m_nCompiled;
+          }
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static bool IsBlank(char c)
+      {
+        return c>0 && c<=0x20;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static const char* SkipBlanks(const char *a_pBegin, const char *a_pEnd)
+      {
+        while (a_pBegin<a_pEnd && IsBlank(*a_pBegin))
+          ++a_pBegin;
+
+        return a_pBegin;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the end of the range without trailing blanks. */
+      static const char* TrimBlanks(const char *a_pBegin, const char *a_pEnd)
+      {
+        while (a_pEnd>a_pBegin && IsBlank(a_pEnd[-1]))
+          --a_pEnd;
+
+        return a_pEnd;
+      }
+
+      ParserBase<TValue, TString> *m_pParser;
+      std::vector<std::unique_ptr<ParserMappedFile> > m_vFile;
+      std::unordered_map<SKey, SEntry, SKeyHash> m_Index;
+      std::size_t m_nCompiled;
+      mutable std::mutex m_Mutex;  ///< Serializes the compilation of formulas
+  };
+
+MUP_NAMESPACE_END
+
+#endif
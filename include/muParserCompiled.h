@@ -0,0 +1,332 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_COMPILED_H
+#define MU_PARSER_COMPILED_H
+
+#include <vector>
+#include <map>
+#include <utility>
+
+#include "muParserDef.h"
+#include "muParserError.h"
+#include "muParserBytecode.h"
+#include "muParserStats.h"
+#include "muPrecompiledEngines.h"
+
+/** \file
+    \brief Compiled expressions that can be shared between threads.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Immutable compiled form of an expression.
+
+    A compiled expression is created by ParserBase::Compile. It does not refer to the parser
+    and is never modified after construction, so a single instance can be evaluated by any
+    number of threads at the same time. Each thread needs its own Context holding the
+    evaluation stack and the variable bindings.
+
+    Variables are referenced by their index in the variable table of the expression. A new
+    context binds them to the variables defined in the parser at compile time. Contexts used
+    concurrently should bind their own variables, at least if the expression contains an
+    assignment.
+
+    If the parser had a statistics registry attached at compile time the evaluations are
+    recorded under the text of the expression, each context records for the thread using it.
+  */
+  template<typename TValue, typename TString>
+  class CompiledExpression
+  {
+  private:
+
+      typedef ParserByteCode<TValue, TString> bytecode_type;
+      typedef ParserStatsRegistry<TString> stats_type;
+      typedef void (*fun_type)(TValue*, int narg);
+
+      /** \brief A single instruction. */
+      struct SInstr
+      {
+        ECmdCode Cmd;
+        EInlineOp Op;     ///< ioNONE for callbacks and assignments
+        int Var;          ///< Index of the variable, -1 for constants
+        TValue Mul;
+        TValue Fixed;
+        fun_type Fun;
+        int Argc;
+      };
+
+  public:
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Evaluation stack and variable bindings of a single thread. */
+      class Context
+      {
+      friend class CompiledExpression;
+
+      public:
+
+          //---------------------------------------------------------------------------------------
+          /** \brief Create a context for an expression using the default variable bindings. */
+          explicit Context(const CompiledExpression &a_Expr)
+            :m_pExpr(&a_Expr)
+            ,m_vStack(a_Expr.m_nStackSize)
+            ,m_vVar(a_Expr.m_vVarPtr)
+            ,m_pStats(nullptr)
+          {}
+
+          //---------------------------------------------------------------------------------------
+          /** \brief Bind a variable of the expression to a different address.
+              \throw ParserError if the expression has no variable named a_sName or a_pVar is null.
+          */
+          void Bind(const TString &a_sName, TValue *a_pVar)
+          {
+            if (a_pVar==nullptr)
+              throw ParserError<TString>(ecINVALID_VAR_PTR, -1, a_sName);
+
+            bool bFound = false;
+            const std::vector<std::pair<TString, int> > &vNames = m_pExpr->m_vVarName;
+            for (std::size_t i=0; i<vNames.size(); ++i)
+            {
+              if (vNames[i].first!=a_sName)
+                continue;
+
+              m_vVar[vNames[i].second] = a_pVar;
+              bFound = true;
+            }
+
+            if (!bFound)
+              throw ParserError<TString>(ecINVALID_NAME, -1, a_sName);
+          }
+
+      private:
+
+          const CompiledExpression *m_pExpr;
+          std::vector<TValue> m_vStack;
+          std::vector<TValue*> m_vVar;
+          typename stats_type::SExprStats *m_pStats;  ///< Statistics record of the thread using the context
+      };
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Create the compiled form of finalized bytecode.
+          \param a_ByteCode The finalized bytecode.
+          \param a_nFinalResultIdx Stack position of the final result.
+          \param a_VarDef The variables of the parser, used for the names of the variables.
+          \param a_pStats Optional statistics registry, not owned by the expression.
+          \param a_sExpr Normalized text of the expression, the key of the statistics.
+          \param a_eEngine Engine of the parser, recorded in the statistics.
+          \param a_eFallback Reason why the parser has no precompiled engine.
+      */
+      CompiledExpression(const bytecode_type &a_ByteCode,
+                         int a_nFinalResultIdx,
+                         const std::map<TString, TValue*> &a_VarDef,
+                         stats_type *a_pStats = nullptr,
+                         const TString &a_sExpr = TString(),
+                         EEngine a_eEngine = enCMD_CODE,
+                         EEngineFallback a_eFallback = efNONE)
+        :m_vCode()
+        ,m_vVarName()
+        ,m_vVarPtr()
+        ,m_nStackSize(a_ByteCode.GetMaxStackSize())
+        ,m_nFinalResultIdx(a_nFinalResultIdx)
+        ,m_pStats(a_pStats)
+        ,m_sExpr(a_sExpr)
+        ,m_nEngineID(a_ByteCode.GetEngineID())
+        ,m_eEngine(a_eEngine)
+        ,m_eFallback(a_eFallback)
+      {
+        const typename bytecode_type::SInstr *pBase = a_ByteCode.GetBase();
+        for (std::size_t i=0; i<a_ByteCode.GetSize(); ++i)
+        {
+          const typename bytecode_type::SInstr &tok = pBase[i];
+
+          SInstr instr = {};
+          instr.Cmd = tok.Cmd;
+          instr.Op  = (tok.Cmd==cmASSIGN) ? ioNONE : bytecode_type::GetInlineOp(tok);
+          instr.Var = -1;
+
+          switch(tok.Cmd)
+          {
+          case cmVAL_EX:
+               instr.Fixed = tok.Val.fixed;
+               if (!tok.IsConst())
+               {
+                 instr.Var = AddVar(tok.Val.ptr, a_VarDef);
+                 instr.Mul = tok.Val.mul;
+               }
+               break;
+
+          case cmFUNC:
+               instr.Fun  = tok.Fun.ptr;
+               instr.Argc = tok.Fun.argc;
+               break;
+
+          case cmASSIGN:
+               instr.Var = AddVar(tok.Oprt.ptr, a_VarDef);
+               break;
+
+          default:
+               break;
+          }
+
+          m_vCode.push_back(instr);
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Evaluate the expression.
+          \param a_Ctx A context created for this expression.
+
+        This function does not modify the expression and may be called concurrently as long
+        as each thread uses its own context.
+      */
+      TValue Eval(Context &a_Ctx) const
+      {
+        if (m_pStats==nullptr)
+          return EvalCode(a_Ctx);
+
+        if (a_Ctx.m_pStats==nullptr || a_Ctx.m_pStats->Thread!=std::this_thread::get_id())
+        {
+          a_Ctx.m_pStats = m_pStats->Acquire(m_sExpr);
+          stats_type::RecordEngine(*a_Ctx.m_pStats, m_eEngine, m_nEngineID, m_eFallback);
+        }
+
+        const std::uint64_t nStart = stats_type::ReadCycles();
+        TValue fVal = EvalCode(a_Ctx);
+        stats_type::RecordEval(*a_Ctx.m_pStats, stats_type::ReadCycles() - nStart);
+        return fVal;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the names of the variables referenced by the expression. 
+      
+        Variables sharing the same address are listed with all their names.
+      */
+      std::vector<TString> GetVarNames() const
+      {
+        std::vector<TString> vNames;
+        for (std::size_t i=0; i<m_vVarName.size(); ++i)
+          vNames.push_back(m_vVarName[i].first);
+
+        return vNames;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      int GetNumResults() const
+      {
+        return m_nFinalResultIdx;
+      }
+
+  private:
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Interpret the instructions. */
+      TValue EvalCode(Context &a_Ctx) const
+      {
+        TValue *Stack = &a_Ctx.m_vStack[0];
+        TValue *const *Var = a_Ctx.m_vVar.data();
+        int sidx = 0;
+
+        for (const SInstr *pTok = &m_vCode[0]; ; ++pTok)
+        {
+          switch(pTok->Op)
+          {
+          case ioVAL:
+               Stack[++sidx] = (pTok->Var<0) ? pTok->Fixed : *Var[pTok->Var] * pTok->Mul + pTok->Fixed;
+               continue;
+
+          case ioADD:    --sidx;   InlineOp<TValue, ioADD>::Apply(&Stack[sidx]);    continue;
+          case ioSUB:    --sidx;   InlineOp<TValue, ioSUB>::Apply(&Stack[sidx]);    continue;
+          case ioMUL:    --sidx;   InlineOp<TValue, ioMUL>::Apply(&Stack[sidx]);    continue;
+          case ioDIV:    --sidx;   InlineOp<TValue, ioDIV>::Apply(&Stack[sidx]);    continue;
+          case ioFUN_AA: sidx -= 2; InlineOp<TValue, ioFUN_AA>::Apply(&Stack[sidx]); continue;
+          case ioFUN_AS: sidx -= 2; InlineOp<TValue, ioFUN_AS>::Apply(&Stack[sidx]); continue;
+          case ioFUN_MA: sidx -= 2; InlineOp<TValue, ioFUN_MA>::Apply(&Stack[sidx]); continue;
+          case ioFUN_AM: sidx -= 2; InlineOp<TValue, ioFUN_AM>::Apply(&Stack[sidx]); continue;
+          case ioFUN_MM: sidx -= 2; InlineOp<TValue, ioFUN_MM>::Apply(&Stack[sidx]); continue;
+          case ioFUN_DD: sidx -= 2; InlineOp<TValue, ioFUN_DD>::Apply(&Stack[sidx]); continue;
+          case ioFUN_MD: sidx -= 2; InlineOp<TValue, ioFUN_MD>::Apply(&Stack[sidx]); continue;
+          case ioFUN_DM: sidx -= 2; InlineOp<TValue, ioFUN_DM>::Apply(&Stack[sidx]); continue;
+          case ioFUN_DA: sidx -= 2; InlineOp<TValue, ioFUN_DA>::Apply(&Stack[sidx]); continue;
+          case ioFUN_AD: sidx -= 2; InlineOp<TValue, ioFUN_AD>::Apply(&Stack[sidx]); continue;
+          case ioFUN_DS: sidx -= 2; InlineOp<TValue, ioFUN_DS>::Apply(&Stack[sidx]); continue;
+          case ioFUN_SD: sidx -= 2; InlineOp<TValue, ioFUN_SD>::Apply(&Stack[sidx]); continue;
+
+          case ioNONE:
+               if (pTok->Cmd==cmASSIGN)
+               {
+                 --sidx;
+                 Stack[sidx] = *Var[pTok->Var] = Stack[sidx+1];
+               }
+               else
+               {
+                 sidx -= pTok->Argc - 1;
+                 (*pTok->Fun)(&Stack[sidx], pTok->Argc);
+               }
+               continue;
+
+          case ioEND:
+               return Stack[m_nFinalResultIdx];
+          }
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the index of a variable, adds it to the variable table if needed. */
+      int AddVar(TValue *a_pVar, const std::map<TString, TValue*> &a_VarDef)
+      {
+        for (std::size_t i=0; i<m_vVarPtr.size(); ++i)
+        {
+          if (m_vVarPtr[i]==a_pVar)
+            return (int)i;
+        }
+
+        int iVar = (int)m_vVarPtr.size();
+        m_vVarPtr.push_back(a_pVar);
+
+        for (auto item = a_VarDef.begin(); item!=a_VarDef.end(); ++item)
+        {
+          if (item->second==a_pVar)
+            m_vVarName.push_back(std::make_pair(item->first, iVar));
+        }
+
+        return iVar;
+      }
+
+      std::vector<SInstr> m_vCode;
+      std::vector<std::pair<TString, int> > m_vVarName;  ///< Variable names and their index
+      std::vector<TValue*> m_vVarPtr;                     ///< Default bindings indexed by SInstr::Var
+      std::size_t m_nStackSize;
+      int m_nFinalResultIdx;
+      stats_type *m_pStats;          ///< Optional statistics registry, not owned by the expression
+      TString m_sExpr;               ///< Key of the statistics
+      int m_nEngineID;
+      EEngine m_eEngine;
+      EEngineFallback m_eFallback;
+  };
+
+MUP_NAMESPACE_END
+
+#endif
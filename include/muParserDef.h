@@ -54,6 +54,51 @@
   #define MUP_INLINE inline
 #endif
 
+/** \brief Number of rows processed per pass through the bytecode by the bulk evaluation. */
+#if !defined(MUP_BULK_SIZE)
+  #define MUP_BULK_SIZE 64
+#endif
+
+/** \brief Approximate number of bytes of input and output touched by a task of the parallel 
+           bulk evaluation.
+
+  The rows of a parallel evaluation are split into chunks whose column data fits into the 
+  per core cache. Chunks are rounded to a multiple of MUP_BULK_SIZE rows.
+*/
+#if !defined(MUP_PARALLEL_CHUNK_BYTES)
+  #define MUP_PARALLEL_CHUNK_BYTES 262144
+#endif
+
+/** \brief Maximum number of tokens of bytecode evaluated by a precompiled engine.
+
+  An engine is instantiated for each of the 2^(MUP_PRECOMPILED_MAX_LEN-1) possible shapes,
+  increasing the limit by one doubles the number of engines. Longer bytecode is evaluated by
+  the register code.
+*/
+#if !defined(MUP_PRECOMPILED_MAX_LEN)
+  #define MUP_PRECOMPILED_MAX_LEN 11
+#endif
+
+/** \brief Maximum number of arithmetic operators inlined by a specialized engine.
+
+  Specialized engines are instantiated for each combination of bytecode shape and builtin 
+  arithmetic operators, a fused operator counts as two. The default covers arithmetic 
+  expressions of up to four operands, raising it by one multiplies the number of engines 
+  by about ten.
+*/
+#if !defined(MUP_SPECIALIZED_MAX_OPS)
+  #define MUP_SPECIALIZED_MAX_OPS 3
+#endif
+
+/** \brief Dispatch the register code by jumping to handler addresses stored in the instructions.
+
+  Requires labels as values, a GCC extension also supported by clang. Define 
+  MUP_NO_COMPUTED_GOTO in order to use a portable switch statement instead.
+*/
+#if !defined(MUP_NO_COMPUTED_GOTO) && defined(__GNUC__)
+  #define MUP_COMPUTED_GOTO
+#endif
+
 #if defined(_DEBUG)
   #define MUP_FAIL(MSG)     \
           {                 \
@@ -113,6 +158,123 @@ MUP_NAMESPACE_START
     cmEND
   };
 
+  //------------------------------------------------------------------------------
+  /** \brief Instruction codes of the register based bytecode.
+
+    The suffix of the arithmetic instructions denotes the kind of their operands. R is
+    a register, V a value operand (*ptr * mul + fixed) and K a constant stored in the 
+    instruction itself. The order of the operand variants must be the same for all 
+    arithmetic operations.
+  */
+  enum ERegCode
+  {
+    rcLOAD = 0,     ///< r[dst] = V
+    rcLOAD_VAR,     ///< r[dst] = *ptr
+    rcLOAD_CONST,   ///< r[dst] = K
+
+    rcADD_RR,       ///< r[dst] = r[dst] + r[src]
+    rcADD_RV,       ///< r[dst] = r[dst] + V
+    rcADD_VR,       ///< r[dst] = V + r[src]
+    rcADD_RK,       ///< r[dst] = r[dst] + K
+    rcADD_KR,       ///< r[dst] = K + r[src]
+    rcSUB_RR,
+    rcSUB_RV,
+    rcSUB_VR,
+    rcSUB_RK,
+    rcSUB_KR,
+    rcMUL_RR,
+    rcMUL_RV,
+    rcMUL_VR,
+    rcMUL_RK,
+    rcMUL_KR,
+    rcDIV_RR,
+    rcDIV_RV,
+    rcDIV_VR,
+    rcDIV_RK,
+    rcDIV_KR,
+
+    // Builtin functions with a single argument, r[dst] = f(r[dst])
+    rcNEG,
+    rcSIN,
+    rcCOS,
+    rcTAN,
+    rcSQRT,
+    rcEXP,
+    rcLOG,
+    rcABS,
+
+    rcCALL,         ///< Callback with its arguments in r[dst] ... r[dst+argc-1], result in r[dst]
+    rcASSIGN,       ///< *var = r[dst] = r[src]
+    rcEND
+  };
+
+  //------------------------------------------------------------------------------
+  /** \brief Kinds of bytecode tokens a specialized engine can evaluate inline.
+
+    The fused operators are created by the bytecode optimizer, their names follow 
+    the substitution functions of the bytecode. 
+  */
+  enum EInlineOp
+  {
+    ioVAL = 0,      ///< Value token
+    ioADD,          ///< a + b
+    ioSUB,          ///< a - b
+    ioMUL,          ///< a * b
+    ioDIV,          ///< a / b
+    ioFUN_AA,       ///< a + (b + c)
+    ioFUN_AS,       ///< a - (b + c)
+    ioFUN_MA,       ///< a + b * c
+    ioFUN_AM,       ///< a * (b + c)
+    ioFUN_MM,       ///< a * (b * c)
+    ioFUN_DD,       ///< a / (b / c)
+    ioFUN_MD,       ///< a / (b * c)
+    ioFUN_DM,       ///< a * (b / c)
+    ioFUN_DA,       ///< a + b / c
+    ioFUN_AD,       ///< a / (b + c)
+    ioFUN_DS,       ///< a - b / c
+    ioFUN_SD,       ///< a / (b - c)
+    ioEND,          ///< End of the bytecode
+    ioNONE          ///< Token that can't be inlined
+  };
+
+  //------------------------------------------------------------------------------
+  /** \brief Engines evaluating an expression, see ParserBase::GetEngine. */
+  enum EEngine
+  {
+    enPARSE_STRING = 0,  ///< The expression is not compiled yet
+    enCMD_CODE,          ///< Interpreter of the stack based bytecode
+    enREG_CODE,          ///< Interpreter of the register code
+    enJIT,               ///< Machine code of the JIT backend
+    enSPECIALIZED,       ///< Engine specialized for a sequence of inline operators
+    enPRECOMPILED,       ///< Engine for the shape of the bytecode, identified by its engine ID
+    enCOUNT
+  };
+
+  //------------------------------------------------------------------------------
+  /** \brief Reasons why no precompiled engine exists for an expression. */
+  enum EEngineFallback
+  {
+    efNONE = 0,          ///< A precompiled engine exists
+    efLEADING_FUNCTION,  ///< The bytecode starts with a function call, e.g. "rnd()+1"
+    efASSIGNMENT,        ///< The bytecode contains cmASSIGN
+    efTOO_LONG,          ///< The bytecode is longer than MUP_PRECOMPILED_MAX_LEN
+    efMULTIPLE_RESULTS,  ///< The expression has several comma separated results
+    efSHAPE,             ///< No engine for the shape of the bytecode
+    efCOUNT
+  };
+
+  //------------------------------------------------------------------------------
+  /** \brief Rewrites applied by the bytecode optimizer, see ParserByteCode::GetNumOptimized. */
+  enum EOptimization
+  {
+    opCONST_FOLD = 0,    ///< A callback with constant arguments was evaluated at compile time
+    opJOIN_ADD_SUB,      ///< An addition or subtraction was merged into a value token
+    opJOIN_MUL,          ///< A multiplication with a constant was merged into a value token
+    opPOW,               ///< A power with a small integer exponent was replaced by multiplications
+    opFUSE,              ///< Two successive operators were replaced by a single callback
+    opCOUNT
+  };
+
   //------------------------------------------------------------------------------
   enum EParserVersionInfo
   {
@@ -182,6 +344,10 @@ MUP_NAMESPACE_START
 
     // internal errors
     ecINTERNAL_ERROR         = 28, ///< Internal error of any kind.
+
+    ecINVALID_BYTECODE       = 29, ///< Serialized bytecode is damaged or refers to undefined symbols
+    ecINVALID_CATALOGUE      = 30, ///< A formula catalogue can not be read or contains an invalid line
+    ecSTACK_TOO_SMALL        = 31, ///< The evaluation stack passed to Eval is smaller than GetMaxStackSize()
   
     // The last two are special entries 
     ecCOUNT,                       ///< This is no error code, It just stores just the total number of error codes
@@ -203,6 +369,7 @@ MUP_NAMESPACE_START
   {
     typedef TVal value_type;
     typedef void (*fun_type)(TVal*, int narg);
+    typedef void (*vfun_type)(TVal *const *args, TVal *out, int narg, std::size_t n);
     typedef int (*identfun_type)(const typename TString::value_type *sExpr, int *nPos, TVal *fVal);
     typedef TVal* (*facfun_type)(const typename TString::value_type*, void*);
     typedef Token<TVal, TString> token_type;
@@ -49,6 +49,9 @@ MUP_NAMESPACE_START
 
       m_vErrMsg[ecUNASSIGNABLE_TOKEN]     = _SL("Unexpected token \"$TOK$\" found at position $POS$.");
       m_vErrMsg[ecINTERNAL_ERROR]         = _SL("Internal error");
+      m_vErrMsg[ecINVALID_BYTECODE]       = _SL("Invalid or incompatible bytecode: \"$TOK$\".");
+      m_vErrMsg[ecINVALID_CATALOGUE]      = _SL("Invalid formula catalogue: \"$TOK$\".");
+      m_vErrMsg[ecSTACK_TOO_SMALL]        = _SL("Evaluation stack too small, $TOK$ values required.");
       m_vErrMsg[ecINVALID_NAME]           = _SL("Invalid function-, variable- or constant name: \"$TOK$\".");
       m_vErrMsg[ecINVALID_BINOP_IDENT]    = _SL("Invalid binary operator identifier: \"$TOK$\".");
       m_vErrMsg[ecINVALID_INFIX_IDENT]    = _SL("Invalid infix operator identifier: \"$TOK$\".");
@@ -0,0 +1,435 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_EXPLAIN_H
+#define MU_PARSER_EXPLAIN_H
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <map>
+
+#include "muParserDef.h"
+#include "muParserBytecode.h"
+#include "muParserStats.h"
+
+/** \file
+    \brief Report describing how a compiled expression is evaluated.
+*/
+
+MUP_NAMESPACE_START
+
+  namespace details
+  {
+    //---------------------------------------------------------------------------------------------
+    inline const char* GetOptimizationName(EOptimization a_eOpt)
+    {
+      static const char *szName[opCOUNT] =
+      {
+        "const_fold", "join_add_sub", "join_mul", "pow", "fuse"
+      };
+
+      return (a_eOpt>=0 && a_eOpt<opCOUNT) ? szName[a_eOpt] : "unknown";
+    }
+  }
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Plan of a compiled expression, created by ParserBase::Explain.
+
+    The plan lists the finalized instructions, the rewrites of the optimizer, the stack size,
+    the engine and the variables loaded by the expression. Hints suggest rewrites of the
+    expression that would let it reach a faster engine.
+
+    Costs are rough estimates in cycles derived from the instruction kinds and the dispatch
+    overhead of the engine, they are meant for comparing expressions. Use
+    ParserStatsRegistry in order to measure the real cost.
+  */
+  template<typename TValue, typename TString>
+  class ParserExplain
+  {
+  private:
+
+      typedef ParserByteCode<TValue, TString> bytecode_type;
+
+  public:
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief A single instruction of the plan. */
+      struct SInstr
+      {
+        ECmdCode Cmd;
+        EInlineOp Op;     ///< ioNONE for callbacks and assignments
+        TString Ident;    ///< Name of the variable or callback
+        int StackPos;     ///< Stack position after the instruction
+        bool Const;       ///< Value instruction without a variable
+        TValue Mul;       ///< Factor of the variable of a value instruction
+        TValue Fixed;     ///< Constant part of a value instruction
+        int Argc;         ///< Number of arguments of a callback
+        unsigned Cost;    ///< Estimated cycles including the dispatch
+      };
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Create the plan of finalized bytecode.
+          \param a_ByteCode The finalized bytecode.
+          \param a_sExpr The expression.
+          \param a_nFinalResultIdx Stack position of the final result.
+          \param a_VarDef The variables of the parser, used for the names of the variables.
+          \param a_eEngine The engine evaluating the bytecode.
+          \param a_sEngineName Name of the engine function.
+          \param a_eFallback Reason why there is no precompiled engine.
+      */
+      ParserExplain(const bytecode_type &a_ByteCode,
+                    const TString &a_sExpr,
+                    int a_nFinalResultIdx,
+                    const std::map<TString, TValue*> &a_VarDef,
+                    EEngine a_eEngine,
+                    const std::string &a_sEngineName,
+                    EEngineFallback a_eFallback)
+        :m_sExpr(a_sExpr)
+        ,m_vCode()
+        ,m_vVar()
+        ,m_vHint()
+        ,m_nOptimized()
+        ,m_bOptimizer(a_ByteCode.IsOptimizerEnabled())
+        ,m_nStackSize(a_ByteCode.GetMaxStackSize())
+        ,m_nNumResults(a_nFinalResultIdx)
+        ,m_eEngine(a_eEngine)
+        ,m_sEngineName(a_sEngineName)
+        ,m_nEngineID(a_ByteCode.GetEngineID())
+        ,m_eFallback(a_eFallback)
+        ,m_nCost(0)
+      {
+        for (int i=0; i<opCOUNT; ++i)
+          m_nOptimized[i] = a_ByteCode.GetNumOptimized((EOptimization)i);
+
+        const unsigned nDispatch = GetDispatchCost(a_eEngine);
+        const typename bytecode_type::SInstr *pBase = a_ByteCode.GetBase();
+        std::vector<TString> vCallback;
+        int nStackPos = 0;
+
+        // The end marker is not part of the plan
+        for (std::size_t i=0; i+1<a_ByteCode.GetSize(); ++i)
+        {
+          const typename bytecode_type::SInstr &tok = pBase[i];
+
+          SInstr instr = {};
+          instr.Cmd   = tok.Cmd;
+          instr.Op    = (tok.Cmd==cmASSIGN) ? ioNONE : bytecode_type::GetInlineOp(tok);
+          instr.Ident = a_ByteCode.GetIdent(i);
+
+          switch(tok.Cmd)
+          {
+          case cmVAL_EX:
+               ++nStackPos;
+               instr.Const = tok.IsConst();
+               instr.Mul   = (instr.Const) ? 0 : tok.Val.mul;
+               instr.Fixed = tok.Val.fixed;
+               if (instr.Const)
+               {
+                 instr.Ident.clear();
+               }
+               else
+               {
+                 // The optimizer may keep the identifier of a constant joined with the variable
+                 instr.Ident = GetVarName(tok.Val.ptr, a_VarDef, instr.Ident);
+                 if (std::find(m_vVar.begin(), m_vVar.end(), instr.Ident)==m_vVar.end())
+                   m_vVar.push_back(instr.Ident);
+               }
+               break;
+
+          case cmFUNC:
+               nStackPos -= tok.Fun.argc - 1;
+               instr.Argc = tok.Fun.argc;
+               if (instr.Op==ioNONE && bytecode_type::GetInternalFunIdx(tok.Fun.ptr)<0)
+                 vCallback.push_back(instr.Ident);
+               break;
+
+          case cmASSIGN:
+               --nStackPos;
+               instr.Ident = GetVarName(tok.Oprt.ptr, a_VarDef, instr.Ident);
+               break;
+
+          default:
+               break;
+          }
+
+          instr.StackPos = nStackPos;
+          instr.Cost = GetCost(instr) + nDispatch;
+          m_nCost += instr.Cost;
+          m_vCode.push_back(instr);
+        }
+
+        CreateHints(vCallback);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      const TString& GetExpr() const                       { return m_sExpr; }
+      const std::vector<SInstr>& GetCode() const           { return m_vCode; }
+      const std::vector<TString>& GetVarNames() const      { return m_vVar; }
+      const std::vector<std::string>& GetHints() const     { return m_vHint; }
+      unsigned GetNumOptimized(EOptimization a_eOpt) const { return m_nOptimized[a_eOpt]; }
+      bool IsOptimizerEnabled() const                      { return m_bOptimizer; }
+      std::size_t GetStackSize() const                     { return m_nStackSize; }
+      int GetNumResults() const                            { return m_nNumResults; }
+      EEngine GetEngine() const                            { return m_eEngine; }
+      const std::string& GetEngineName() const             { return m_sEngineName; }
+      int GetEngineID() const                              { return m_nEngineID; }
+      EEngineFallback GetEngineFallback() const            { return m_eFallback; }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the estimated cycles of a single evaluation. */
+      unsigned GetCost() const
+      {
+        return m_nCost;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the plan as JSON. */
+      std::string GetJson() const
+      {
+        std::ostringstream ss;
+        ss << "{\n"
+           << "  \"expr\": ";
+        details::WriteJsonString(ss, m_sExpr);
+        ss << ",\n"
+           << "  \"engine\": \"" << m_sEngineName << "\",\n"
+           << "  \"engine_id\": " << m_nEngineID << ",\n"
+           << "  \"fallback\": \"" << details::GetEngineFallbackName(m_eFallback) << "\",\n"
+           << "  \"results\": " << m_nNumResults << ",\n"
+           << "  \"stack_size\": " << m_nStackSize << ",\n"
+           << "  \"estimated_cycles\": " << m_nCost << ",\n"
+           << "  \"optimizer\": " << ((m_bOptimizer) ? "true" : "false") << ",\n"
+           << "  \"optimizations\": {";
+
+        for (int i=0; i<opCOUNT; ++i)
+        {
+          ss << ((i==0) ? " " : ", ")
+             << "\"" << details::GetOptimizationName((EOptimization)i) << "\": " << m_nOptimized[i];
+        }
+
+        ss << " },\n"
+           << "  \"vars\": [";
+        for (std::size_t i=0; i<m_vVar.size(); ++i)
+        {
+          ss << ((i==0) ? " " : ", ");
+          details::WriteJsonString(ss, m_vVar[i]);
+        }
+
+        ss << ((m_vVar.size()) ? " ],\n" : "],\n")
+           << "  \"code\": [";
+
+        for (std::size_t i=0; i<m_vCode.size(); ++i)
+        {
+          const SInstr &instr = m_vCode[i];
+          ss << ((i==0) ? "\n" : ",\n")
+             << "    { \"op\": \"" << GetOpName(instr) << "\""
+             << ", \"stack\": " << instr.StackPos;
+
+          if (instr.Cmd!=cmVAL_EX || !instr.Const)
+          {
+            ss << ", \"ident\": ";
+            details::WriteJsonString(ss, instr.Ident);
+          }
+
+          if (instr.Cmd==cmVAL_EX)
+          {
+            if (!instr.Const)
+              ss << ", \"mul\": " << instr.Mul;
+
+            ss << ", \"fixed\": " << instr.Fixed;
+          }
+          else if (instr.Cmd==cmFUNC)
+          {
+            ss << ", \"argc\": " << instr.Argc;
+          }
+
+          ss << ", \"cycles\": " << instr.Cost << " }";
+        }
+
+        ss << ((m_vCode.size()) ? "\n  ],\n" : "],\n")
+           << "  \"hints\": [";
+
+        for (std::size_t i=0; i<m_vHint.size(); ++i)
+        {
+          ss << ((i==0) ? "\n    " : ",\n    ");
+          details::WriteJsonString(ss, m_vHint[i]);
+        }
+
+        ss << ((m_vHint.size()) ? "\n  ]\n" : "]\n")
+           << "}\n";
+        return ss.str();
+      }
+
+  private:
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the name of the variable at an address or a_sDefault if it is unknown. */
+      static TString GetVarName(const TValue *a_pVar, 
+                                const std::map<TString, TValue*> &a_VarDef, 
+                                const TString &a_sDefault)
+      {
+        for (auto item = a_VarDef.begin(); item!=a_VarDef.end(); ++item)
+        {
+          if (item->second==a_pVar)
+            return item->first;
+        }
+
+        return a_sDefault;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the estimated overhead of an engine for dispatching an instruction. */
+      static unsigned GetDispatchCost(EEngine a_eEngine)
+      {
+        switch(a_eEngine)
+        {
+        case enSPECIALIZED:
+        case enJIT:         return 0;
+        case enPRECOMPILED: return 1;
+        case enREG_CODE:    return 3;
+        default:            return 4;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the estimated cycles of an instruction without the dispatch. */
+      static unsigned GetCost(const SInstr &a_Instr)
+      {
+        switch(a_Instr.Op)
+        {
+        case ioVAL:    return (a_Instr.Const) ? 1 : 3;
+        case ioADD:
+        case ioSUB:
+        case ioMUL:    return 1;
+        case ioDIV:    return 5;
+        case ioFUN_AA:
+        case ioFUN_AS:
+        case ioFUN_MA:
+        case ioFUN_AM:
+        case ioFUN_MM: return 2;
+        case ioFUN_DD: return 10;
+        case ioFUN_MD:
+        case ioFUN_DM:
+        case ioFUN_DA:
+        case ioFUN_AD:
+        case ioFUN_DS:
+        case ioFUN_SD: return 6;
+        default:       break;
+        }
+
+        // Callbacks are called indirectly and pass their arguments on the stack
+        return (a_Instr.Cmd==cmASSIGN) ? 2 : 10 + (unsigned)a_Instr.Argc;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static const char* GetOpName(const SInstr &a_Instr)
+      {
+        switch(a_Instr.Cmd)
+        {
+        case cmVAL_EX:  return "VAL";
+        case cmASSIGN:  return "ASSIGN";
+        case cmFUNC:    return (a_Instr.Op==ioNONE) ? "CALL" : "INLINE";
+        default:        return "UNKNOWN";
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Suggest rewrites of the expression leading to a faster engine.
+          \param a_vCallback Names of the user defined callbacks called by the expression.
+      */
+      void CreateHints(const std::vector<TString> &a_vCallback)
+      {
+        if (!m_bOptimizer)
+          m_vHint.push_back("Enable the optimizer in order to fold constants and fuse operators.");
+
+        // Specialized engines and machine code don't need a precompiled engine
+        if (m_eEngine==enCMD_CODE || m_eEngine==enREG_CODE)
+        {
+          switch(m_eFallback)
+          {
+          case efLEADING_FUNCTION:
+               m_vHint.push_back("The expression starts with a function call, start it with a value "
+                                 "instead, e.g. \"1+rnd()\" rather than \"rnd()+1\".");
+               break;
+
+          case efASSIGNMENT:
+               m_vHint.push_back("Move the assignment into a separate expression.");
+               break;
+
+          case efTOO_LONG:
+               m_vHint.push_back("Split the expression into parts of at most " +
+                                 std::to_string(MUP_PRECOMPILED_MAX_LEN) + " instructions, it has " +
+                                 std::to_string(m_vCode.size()) + ".");
+               break;
+
+          case efMULTIPLE_RESULTS:
+               m_vHint.push_back("Evaluate the comma separated results as separate expressions.");
+               break;
+
+          case efSHAPE:
+               m_vHint.push_back("No precompiled engine exists for the order of values and calls, "
+                                 "reorder the operands of commutative operators.");
+               break;
+
+          default:
+               break;
+          }
+        }
+
+        // Without callbacks short expressions would be evaluated by a specialized engine
+        if (m_eEngine!=enSPECIALIZED && a_vCallback.size() && m_nNumResults==1 &&
+            m_vCode.size() + 1 <= 2 * MUP_SPECIALIZED_MAX_OPS + 2)
+        {
+          std::string sNames;
+          for (std::size_t i=0; i<a_vCallback.size(); ++i)
+          {
+            std::ostringstream ss;
+            details::WriteJsonString(ss, a_vCallback[i]);
+            sNames += ((i==0) ? "" : ", ") + ss.str();
+          }
+
+          m_vHint.push_back("Replace the calls of " + sNames + " with builtin operators in order to "
+                            "reach a specialized engine.");
+        }
+      }
+
+      TString m_sExpr;
+      std::vector<SInstr> m_vCode;
+      std::vector<TString> m_vVar;        ///< Names of the variables loaded, in order of their first use
+      std::vector<std::string> m_vHint;   ///< Suggested rewrites of the expression
+      unsigned m_nOptimized[opCOUNT];     ///< Number of rewrites applied by the optimizer
+      bool m_bOptimizer;
+      std::size_t m_nStackSize;
+      int m_nNumResults;
+      EEngine m_eEngine;
+      std::string m_sEngineName;
+      int m_nEngineID;
+      EEngineFallback m_eFallback;
+      unsigned m_nCost;                   ///< Estimated cycles per evaluation
+  };
+
+MUP_NAMESPACE_END
+
+#endif
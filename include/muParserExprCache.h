@@ -0,0 +1,318 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_EXPR_CACHE_H
+#define MU_PARSER_EXPR_CACHE_H
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+#include "muParserDef.h"
+#include "muParserBytecode.h"
+
+/** \file
+    \brief Cache of finalized bytecode shared by several parsers.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Concurrent cache mapping expressions to their finalized bytecode.
+
+    Entries are keyed by the normalized expression text and a fingerprint of the definitions
+    of the parser, i.e. variables, constants, functions and operators. A parser with a cache 
+    attached looks up the bytecode before parsing an expression and stores the bytecode of 
+    every expression it parses.
+
+    The cache is set associative with s_nWays entries per set, a set is replaced using the 
+    CLOCK algorithm. Lookups and insertions never block: an entry is pinned by incrementing 
+    its reference count, an insertion only claims entries that are not pinned and skips the 
+    insertion if all of them are. The cache may be shared by any number of threads and parsers.
+  */
+  template<typename TValue, typename TString>
+  class ParserExprCache
+  {
+  public:
+
+      typedef ParserByteCode<TValue, TString> bytecode_type;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Create a cache.
+          \param a_nCapacity Minimum number of expressions held by the cache.
+      */
+      explicit ParserExprCache(std::size_t a_nCapacity = 4096)
+        :m_pEntry()
+        ,m_pHand()
+        ,m_nSets(1)
+        ,m_nHits(0)
+        ,m_nMisses(0)
+      {
+        while (m_nSets * s_nWays < a_nCapacity)
+          m_nSets *= 2;
+
+        m_pEntry.reset(new SEntry[m_nSets * s_nWays]);
+        m_pHand.reset(new std::atomic<unsigned>[m_nSets]);
+        for (std::size_t i=0; i<m_nSets; ++i)
+          m_pHand[i].store(0, std::memory_order_relaxed);
+      }
+
+      ParserExprCache(const ParserExprCache&) = delete;
+      ParserExprCache& operator=(const ParserExprCache&) = delete;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Look up the bytecode of an expression.
+          \param a_sExpr The expression.
+          \param a_nFingerprint Fingerprint of the definitions of the parser.
+          \param a_ByteCode Receives the bytecode if the expression is in the cache.
+          \param a_nFinalResultIdx Receives the stack position of the final result.
+          \return true if the expression was found.
+      */
+      bool Find(const TString &a_sExpr, 
+                std::uint64_t a_nFingerprint, 
+                bytecode_type &a_ByteCode, 
+                int &a_nFinalResultIdx)
+      {
+        const TString sKey = Normalize(a_sExpr);
+        const std::uint64_t nHash = GetHash(sKey, a_nFingerprint);
+        SEntry *pSet = &m_pEntry[(nHash & (m_nSets - 1)) * s_nWays];
+
+        for (unsigned i=0; i<s_nWays; ++i)
+        {
+          SEntry &entry = pSet[i];
+          if (entry.Hash.load(std::memory_order_relaxed)!=nHash)
+            continue;
+
+          // Pin the entry, a negative count means it is being replaced
+          if (entry.Refs.fetch_add(1, std::memory_order_acquire)<0)
+          {
+            entry.Refs.fetch_sub(1, std::memory_order_release);
+            continue;
+          }
+
+          bool bFound = entry.Hash.load(std::memory_order_relaxed)==nHash && 
+                        entry.Fingerprint==a_nFingerprint && 
+                        entry.Expr==sKey;
+          if (bFound)
+          {
+            a_ByteCode = entry.ByteCode;
+            a_nFinalResultIdx = entry.FinalResultIdx;
+            entry.Referenced.store(true, std::memory_order_relaxed);
+          }
+
+          entry.Refs.fetch_sub(1, std::memory_order_release);
+
+          if (bFound)
+          {
+            m_nHits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+          }
+        }
+
+        m_nMisses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Store the bytecode of an expression.
+          \param a_sExpr The expression.
+          \param a_nFingerprint Fingerprint of the definitions of the parser.
+          \param a_ByteCode The finalized bytecode of the expression.
+          \param a_nFinalResultIdx Stack position of the final result.
+
+        The entry replaced is chosen by the CLOCK algorithm among the entries of the set the
+        expression maps to. If all of them are in use by other threads the bytecode is not stored.
+      */
+      void Insert(const TString &a_sExpr, 
+                  std::uint64_t a_nFingerprint, 
+                  const bytecode_type &a_ByteCode, 
+                  int a_nFinalResultIdx)
+      {
+        const TString sKey = Normalize(a_sExpr);
+        const std::uint64_t nHash = GetHash(sKey, a_nFingerprint);
+        const std::size_t nSet = nHash & (m_nSets - 1);
+        SEntry *pSet = &m_pEntry[nSet * s_nWays];
+
+        for (unsigned i=0; i<s_nWays; ++i)
+        {
+          if (pSet[i].Hash.load(std::memory_order_relaxed)==nHash)
+            return;
+        }
+
+        // Advance the clock hand, referenced entries get a second chance
+        unsigned nHand = m_pHand[nSet].load(std::memory_order_relaxed);
+        for (unsigned i=0; i<2*s_nWays; ++i, ++nHand)
+        {
+          SEntry &entry = pSet[nHand % s_nWays];
+          if (entry.Referenced.exchange(false, std::memory_order_relaxed))
+            continue;
+
+          int nRefs = 0;
+          if (!entry.Refs.compare_exchange_strong(nRefs, s_nLocked, std::memory_order_acquire))
+            continue;
+
+          entry.Hash.store(0, std::memory_order_relaxed);
+          entry.Expr = sKey;
+          entry.Fingerprint = a_nFingerprint;
+          entry.ByteCode = a_ByteCode;
+          entry.FinalResultIdx = a_nFinalResultIdx;
+          entry.Referenced.store(false, std::memory_order_relaxed);
+          entry.Hash.store(nHash, std::memory_order_relaxed);
+          entry.Refs.fetch_sub(s_nLocked, std::memory_order_release);
+
+          m_pHand[nSet].store(nHand + 1, std::memory_order_relaxed);
+          return;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Remove all expressions that are not in use by other threads. */
+      void Clear()
+      {
+        for (std::size_t i=0; i<m_nSets * s_nWays; ++i)
+        {
+          SEntry &entry = m_pEntry[i];
+
+          int nRefs = 0;
+          if (!entry.Refs.compare_exchange_strong(nRefs, s_nLocked, std::memory_order_acquire))
+            continue;
+
+          entry.Hash.store(0, std::memory_order_relaxed);
+          entry.Expr.clear();
+          entry.ByteCode.Clear();
+          entry.Refs.fetch_sub(s_nLocked, std::memory_order_release);
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the number of lookups that found the expression. */
+      std::uint64_t GetHits() const
+      {
+        return m_nHits.load(std::memory_order_relaxed);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the number of lookups that did not find the expression. */
+      std::uint64_t GetMisses() const
+      {
+        return m_nMisses.load(std::memory_order_relaxed);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      std::size_t GetCapacity() const
+      {
+        return m_nSets * s_nWays;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Update a 64 bit FNV-1a hash with a block of memory. */
+      static std::uint64_t Hash(std::uint64_t a_nHash, const void *a_pData, std::size_t a_nSize)
+      {
+        const unsigned char *pData = static_cast<const unsigned char*>(a_pData);
+        for (std::size_t i=0; i<a_nSize; ++i)
+          a_nHash = (a_nHash ^ pData[i]) * 0x100000001b3ULL;
+
+        return a_nHash;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Start value of the hash. */
+      static std::uint64_t HashSeed()
+      {
+        return 0xcbf29ce484222325ULL;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the expression without leading and trailing whitespace and with each 
+                 run of whitespace replaced by a single blank.
+      */
+      static TString Normalize(const TString &a_sExpr)
+      {
+        TString sExpr;
+        sExpr.reserve(a_sExpr.length());
+
+        bool bBlank = false;
+        for (std::size_t i=0; i<a_sExpr.length(); ++i)
+        {
+          // the token reader treats all non printable characters as whitespace
+          if (a_sExpr[i]>0 && a_sExpr[i]<=0x20)
+          {
+            bBlank = true;
+            continue;
+          }
+
+          if (bBlank && sExpr.length())
+            sExpr += ' ';
+
+          sExpr += a_sExpr[i];
+          bBlank = false;
+        }
+
+        return sExpr;
+      }
+
+  private:
+
+      static const unsigned s_nWays = 8;
+      static const int s_nLocked = -(1 << 30);  ///< Added to the reference count of an entry being replaced
+
+      /** \brief A cached expression. */
+      struct SEntry
+      {
+        SEntry()
+          :Hash(0)
+          ,Refs(0)
+          ,Referenced(false)
+          ,Expr()
+          ,Fingerprint(0)
+          ,ByteCode()
+          ,FinalResultIdx(0)
+        {}
+
+        std::atomic<std::uint64_t> Hash;  ///< Hash of the key, 0 for empty entries
+        std::atomic<int> Refs;            ///< Number of readers, negative while the entry is written
+        std::atomic<bool> Referenced;     ///< CLOCK reference bit
+        TString Expr;
+        std::uint64_t Fingerprint;
+        bytecode_type ByteCode;
+        int FinalResultIdx;
+      };
+
+      //-------------------------------------------------------------------------------------------
+      static std::uint64_t GetHash(const TString &a_sKey, std::uint64_t a_nFingerprint)
+      {
+        std::uint64_t nHash = Hash(a_nFingerprint, a_sKey.data(), a_sKey.length() * sizeof(a_sKey[0]));
+        return (nHash) ? nHash : 1;
+      }
+
+      std::unique_ptr<SEntry[]> m_pEntry;
+      std::unique_ptr<std::atomic<unsigned>[]> m_pHand;  ///< CLOCK hand of each set
+      std::size_t m_nSets;
+      std::atomic<std::uint64_t> m_nHits;
+      std::atomic<std::uint64_t> m_nMisses;
+  };
+
+MUP_NAMESPACE_END
+
+#endif
@@ -0,0 +1,573 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_JIT_H
+#define MU_PARSER_JIT_H
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <exception>
+
+#include "muParserDef.h"
+#include "muParserBytecode.h"
+
+#if defined(MUP_USE_JIT) && defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+  #define MUP_JIT_SUPPORTED
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+/** \file
+    \brief Translation of the finalized bytecode into x86-64 machine code.
+
+  The JIT backend is only available if MUP_USE_JIT is defined, the target is x86-64 with
+  the System V calling convention and the value type is double. In all other cases
+  Compile() fails and the parser keeps using its interpreters.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Placeholder for configurations without JIT support. */
+  template<typename TValue, typename TString>
+  class ParserJit
+  {
+  public:
+
+      ParserJit() {}
+      ParserJit(const ParserJit&) = delete;
+      ParserJit& operator=(const ParserJit&) = delete;
+
+      bool Compile(const ParserByteCode<TValue, TString>&, int) { return false; }
+      bool IsCompiled() const { return false; }
+      TValue Exec(TValue*) const { return 0; }
+      std::size_t GetSize() const { return 0; }
+      void Clear() {}
+  };
+
+#if defined(MUP_JIT_SUPPORTED)
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Native code of the bytecode for double values on x86-64.
+
+    Stack slot i is kept in register xmm(i-1), xmm14 and xmm15 are scratch registers. The
+    builtin arithmetic operators, the fused operators created by the optimizer, the
+    comparisons and logical operators as well as the sign, abs and sqrt are translated into
+    scalar SSE2 instructions. All other functions are called through their callback. Before
+    a call the live slots are stored into the evaluation stack, the callback works on the
+    stack as usual and the slots are reloaded afterwards.
+
+    Callbacks are invoked through CallFun, which catches exceptions so that they never
+    unwind through the generated code. The code returns immediately and Exec rethrows the
+    exception.
+
+    The generated function takes the address of the evaluation stack as its only argument.
+    Bytecode needing more than 14 slots is not compiled.
+  */
+  template<typename TString>
+  class ParserJit<double, TString>
+  {
+  private:
+
+      typedef double TValue;
+      typedef ParserByteCode<TValue, TString> bytecode_type;
+      typedef typename bytecode_type::SInstr token_type;
+      typedef void (*fun_type)(TValue*, int narg);
+      typedef TValue (*jit_fun_type)(TValue *stack);
+      typedef MathImpl<TValue, TString> math_type;
+
+      static const int c_nMaxSlots = 14;
+      static const int c_nScratch1 = 14;
+      static const int c_nScratch2 = 15;
+
+      /** \brief SSE2 opcodes, the mandatory prefix is in the high byte. */
+      enum EOpcode
+      {
+        opMOVSD_LOAD  = 0xF210,
+        opMOVSD_STORE = 0xF211,
+        opSQRTSD      = 0xF251,
+        opADDSD       = 0xF258,
+        opMULSD       = 0xF259,
+        opSUBSD       = 0xF25C,
+        opDIVSD       = 0xF25E,
+        opCMPSD       = 0xF2C2,
+        opMOVAPD      = 0x6628,
+        opANDPD       = 0x6654,
+        opORPD        = 0x6656,
+        opXORPD       = 0x6657
+      };
+
+      /** \brief Predicates of cmpsd. */
+      enum ECmpPred
+      {
+        cpEQ  = 0,
+        cpLT  = 1,
+        cpLE  = 2,
+        cpNEQ = 4
+      };
+
+  public:
+
+      //-------------------------------------------------------------------------------------------
+      ParserJit()
+        :m_pCode(nullptr)
+        ,m_nSize(0)
+        ,m_vBuf()
+        ,m_vExitJumps()
+        ,m_pException()
+      {}
+
+      ParserJit(const ParserJit&) = delete;
+      ParserJit& operator=(const ParserJit&) = delete;
+
+      //-------------------------------------------------------------------------------------------
+      ~ParserJit()
+      {
+        Clear();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Translate finalized bytecode into machine code.
+          \param a_ByteCode The bytecode.
+          \param a_nFinalResultIdx Stack position of the final result.
+          \return false if the bytecode can't be compiled.
+      */
+      bool Compile(const bytecode_type &a_ByteCode, int a_nFinalResultIdx)
+      {
+        Clear();
+
+        if (a_ByteCode.GetMaxStackSize() > c_nMaxSlots + 1)
+          return false;
+
+        m_vBuf.clear();
+        m_vExitJumps.clear();
+
+        // push rbx; mov rbx, rdi  (rbx holds the stack address, the push aligns rsp for calls)
+        Emit(0x53);
+        Emit(0x48); Emit(0x89); Emit(0xFB);
+
+        int sidx = 0;
+        for (const token_type *pTok = a_ByteCode.GetBase(); pTok->Cmd!=cmEND; ++pTok)
+        {
+          switch(pTok->Cmd)
+          {
+          case cmVAL_EX:
+               if (++sidx > c_nMaxSlots)
+                 return false;
+
+               EmitLoadValue(Slot(sidx), *pTok);
+               continue;
+
+          case cmASSIGN:
+               EmitLoadAddress(pTok->Oprt.ptr);
+               EmitMem(opMOVSD_STORE, Slot(sidx));
+               EmitRR(opMOVAPD, Slot(sidx-1), Slot(sidx));
+               --sidx;
+               continue;
+
+          case cmFUNC:
+               if (!EmitInlineFun(*pTok, sidx))
+                 EmitCall(*pTok, sidx);
+
+               sidx -= pTok->Fun.argc - 1;
+               if (sidx > c_nMaxSlots)
+                 return false;
+               continue;
+
+          default:
+               return false;
+          }
+        }
+
+        if (a_nFinalResultIdx<1 || a_nFinalResultIdx>sidx)
+          return false;
+
+        // result in xmm0; pop rbx; ret
+        if (Slot(a_nFinalResultIdx)!=0)
+          EmitRR(opMOVAPD, 0, Slot(a_nFinalResultIdx));
+
+        for (std::size_t i=0; i<m_vExitJumps.size(); ++i)
+        {
+          std::size_t nPos = m_vExitJumps[i];
+          std::int32_t nRel = (std::int32_t)(m_vBuf.size() - (nPos + 4));
+          for (int k=0; k<4; ++k)
+            m_vBuf[nPos + k] = (unsigned char)(((std::uint32_t)nRel >> (8*k)) & 0xFF);
+        }
+
+        Emit(0x5B);
+        Emit(0xC3);
+
+        return Install();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      bool IsCompiled() const
+      {
+        return m_pCode!=nullptr;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Evaluate the compiled bytecode using a_pStack as evaluation stack. */
+      MUP_INLINE TValue Exec(TValue *a_pStack) const
+      {
+        TValue fRes = (*reinterpret_cast<jit_fun_type>(m_pCode))(a_pStack);
+        if (m_pException)
+        {
+          std::exception_ptr pException;
+          std::swap(pException, m_pException);
+          std::rethrow_exception(pException);
+        }
+
+        return fRes;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the size of the machine code in bytes. */
+      std::size_t GetSize() const
+      {
+        return (m_pCode) ? m_vBuf.size() : 0;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void Clear()
+      {
+        if (m_pCode)
+          munmap(m_pCode, m_nSize);
+
+        m_pCode = nullptr;
+        m_nSize = 0;
+      }
+
+  private:
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Copy the code into executable memory.
+
+        The memory is never writable and executable at the same time.
+      */
+      bool Install()
+      {
+        std::size_t nPage = (std::size_t)sysconf(_SC_PAGESIZE);
+        std::size_t nSize = (m_vBuf.size() + nPage - 1) / nPage * nPage;
+
+        void *pMem = mmap(nullptr, nSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (pMem==MAP_FAILED)
+          return false;
+
+        std::memcpy(pMem, &m_vBuf[0], m_vBuf.size());
+        if (mprotect(pMem, nSize, PROT_READ | PROT_EXEC)!=0)
+        {
+          munmap(pMem, nSize);
+          return false;
+        }
+
+        m_pCode = pMem;
+        m_nSize = nSize;
+        return true;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Translate builtin functions into SSE2 instructions.
+          \return false if the function has to be called.
+      */
+      bool EmitInlineFun(const token_type &a_Tok, int sidx)
+      {
+        const fun_type pFun = a_Tok.Fun.ptr;
+        const int argc = a_Tok.Fun.argc;
+        const int a = Slot(sidx - argc + 1);
+
+        switch(bytecode_type::GetInlineOp(a_Tok))
+        {
+        case ioADD: EmitRR(opADDSD, a, a+1); return true;
+        case ioSUB: EmitRR(opSUBSD, a, a+1); return true;
+        case ioMUL: EmitRR(opMULSD, a, a+1); return true;
+        case ioDIV: EmitRR(opDIVSD, a, a+1); return true;
+
+        // a op1 (b op2 c)
+        case ioFUN_AA: EmitRR(opADDSD, a+1, a+2); EmitRR(opADDSD, a, a+1); return true;
+        case ioFUN_AS: EmitRR(opADDSD, a+1, a+2); EmitRR(opSUBSD, a, a+1); return true;
+        case ioFUN_MA: EmitRR(opMULSD, a+1, a+2); EmitRR(opADDSD, a, a+1); return true;
+        case ioFUN_AM: EmitRR(opADDSD, a+1, a+2); EmitRR(opMULSD, a, a+1); return true;
+        case ioFUN_MM: EmitRR(opMULSD, a+1, a+2); EmitRR(opMULSD, a, a+1); return true;
+        case ioFUN_DD: EmitRR(opDIVSD, a+1, a+2); EmitRR(opDIVSD, a, a+1); return true;
+        case ioFUN_MD: EmitRR(opMULSD, a+1, a+2); EmitRR(opDIVSD, a, a+1); return true;
+        case ioFUN_DM: EmitRR(opDIVSD, a+1, a+2); EmitRR(opMULSD, a, a+1); return true;
+        case ioFUN_DA: EmitRR(opDIVSD, a+1, a+2); EmitRR(opADDSD, a, a+1); return true;
+        case ioFUN_AD: EmitRR(opADDSD, a+1, a+2); EmitRR(opDIVSD, a, a+1); return true;
+        case ioFUN_DS: EmitRR(opDIVSD, a+1, a+2); EmitRR(opSUBSD, a, a+1); return true;
+        case ioFUN_SD: EmitRR(opSUBSD, a+1, a+2); EmitRR(opDIVSD, a, a+1); return true;
+        default:       break;
+        }
+
+        if (argc==2)
+        {
+          if (pFun==math_type::Less)      { EmitCompare(a, a, a+1, cpLT);  return true; }
+          if (pFun==math_type::Greater)   { EmitCompare(a, a+1, a, cpLT);  return true; }
+          if (pFun==math_type::LessEq)    { EmitCompare(a, a, a+1, cpLE);  return true; }
+          if (pFun==math_type::GreaterEq) { EmitCompare(a, a+1, a, cpLE);  return true; }
+          if (pFun==math_type::Equal)     { EmitCompare(a, a, a+1, cpEQ);  return true; }
+          if (pFun==math_type::NotEqual)  { EmitCompare(a, a, a+1, cpNEQ); return true; }
+
+          if (pFun==math_type::And || pFun==math_type::Or)
+          {
+            // (a!=0) op (b!=0)
+            EmitLoadConst(c_nScratch1, 0);
+            EmitRR(opMOVAPD, c_nScratch2, c_nScratch1);
+            EmitCmp(c_nScratch1, a, cpNEQ);
+            EmitCmp(c_nScratch2, a+1, cpNEQ);
+            EmitRR((pFun==math_type::And) ? opANDPD : opORPD, c_nScratch1, c_nScratch2);
+            EmitMaskToBool(a, c_nScratch1);
+            return true;
+          }
+        }
+        else if (argc==1)
+        {
+          if (pFun==math_type::UnaryPlus)
+            return true;
+
+          if (pFun==math_type::UnaryMinus)
+          {
+            EmitLoadConst(c_nScratch1, -1);
+            EmitRR(opMULSD, a, c_nScratch1);
+            return true;
+          }
+
+          if (pFun==math_type::Sqrt)
+          {
+            EmitRR(opSQRTSD, a, a);
+            return true;
+          }
+
+          if (pFun==math_type::Abs)
+          {
+            // a = (a>=0) ? a : -a
+            EmitLoadConst(c_nScratch1, 0);
+            EmitCmp(c_nScratch1, a, cpLE);
+            EmitLoadConst(c_nScratch2, -1);
+            EmitRR(opMULSD, c_nScratch2, a);
+            EmitBlend(a, c_nScratch1, c_nScratch2);
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Call a callback with its arguments on the evaluation stack. */
+      void EmitCall(const token_type &a_Tok, int sidx)
+      {
+        const typename Token<TValue, TString>::SFunDef &fun = a_Tok.Fun;
+        const int nArgIdx = sidx - fun.argc + 1;
+
+        for (int i=1; i<=sidx; ++i)
+          EmitStack(opMOVSD_STORE, Slot(i), i);
+
+        // mov rdi, ptr; lea rsi, [rbx + 8*nArgIdx]; mov edx, argc; mov rcx, this
+        Emit(0x48); Emit(0xBF); Emit64(reinterpret_cast<std::uint64_t>(fun.ptr));
+        Emit(0x48); Emit(0x8D); Emit(0xB3); Emit32(nArgIdx * (int)sizeof(TValue));
+        Emit(0xBA); Emit32(fun.argc);
+        Emit(0x48); Emit(0xB9); Emit64(reinterpret_cast<std::uint64_t>(this));
+
+        // mov rax, CallFun; call rax; test eax, eax; jnz exit
+        Emit(0x48); Emit(0xB8); Emit64(reinterpret_cast<std::uint64_t>(&CallFun));
+        Emit(0xFF); Emit(0xD0);
+        Emit(0x85); Emit(0xC0);
+        Emit(0x0F); Emit(0x85); 
+        m_vExitJumps.push_back(m_vBuf.size());
+        Emit32(0);
+
+        for (int i=1; i<=nArgIdx; ++i)
+          EmitStack(opMOVSD_LOAD, Slot(i), i);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Invoke a callback on behalf of the generated code.
+          \return 0 on success, 1 if the callback has thrown.
+      */
+      static int CallFun(fun_type a_pFun, TValue *a_pArgs, int a_iArgc, ParserJit *a_pJit)
+      {
+        try
+        {
+          (*a_pFun)(a_pArgs, a_iArgc);
+          return 0;
+        }
+        catch(...)
+        {
+          a_pJit->m_pException = std::current_exception();
+          return 1;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief dst = (lhs pred rhs) ? 1 : 0 */
+      void EmitCompare(int dst, int lhs, int rhs, ECmpPred ePred)
+      {
+        EmitRR(opMOVAPD, c_nScratch1, lhs);
+        EmitCmp(c_nScratch1, rhs, ePred);
+        EmitMaskToBool(dst, c_nScratch1);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief dst = mask & 1.0 */
+      void EmitMaskToBool(int dst, int mask)
+      {
+        EmitLoadConst(dst, 1);
+        EmitRR(opANDPD, dst, mask);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief dst = mask ? dst : other, clobbers mask */
+      void EmitBlend(int dst, int mask, int other)
+      {
+        // dst = (dst & mask) | (other & ~mask), computed as other ^ ((other ^ dst) & mask)
+        EmitRR(opXORPD, dst, other);
+        EmitRR(opANDPD, dst, mask);
+        EmitRR(opXORPD, dst, other);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void EmitCmp(int dst, int src, ECmpPred ePred)
+      {
+        EmitRR(opCMPSD, dst, src);
+        Emit((unsigned char)ePred);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief xmm = *ptr * mul + fixed */
+      void EmitLoadValue(int xmm, const token_type &a_Tok)
+      {
+        const typename Token<TValue, TString>::SValDef &val = a_Tok.Val;
+        if (a_Tok.IsConst())
+        {
+          EmitLoadConst(xmm, val.fixed);
+          return;
+        }
+
+        EmitLoadAddress(val.ptr);
+        EmitMem(opMOVSD_LOAD, xmm);
+
+        if (val.mul!=1)
+        {
+          EmitLoadConst(c_nScratch1, val.mul);
+          EmitRR(opMULSD, xmm, c_nScratch1);
+        }
+
+        if (val.fixed!=0)
+        {
+          EmitLoadConst(c_nScratch1, val.fixed);
+          EmitRR(opADDSD, xmm, c_nScratch1);
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief mov rax, imm64; movq xmm, rax */
+      void EmitLoadConst(int xmm, TValue fVal)
+      {
+        std::uint64_t nBits;
+        std::memcpy(&nBits, &fVal, sizeof(nBits));
+
+        Emit(0x48); Emit(0xB8); Emit64(nBits);
+        Emit(0x66); Emit(0x48 | ((xmm & 8) ? 0x04 : 0)); Emit(0x0F); Emit(0x6E); Emit(0xC0 | ((xmm & 7) << 3));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief mov rax, imm64 */
+      void EmitLoadAddress(const void *ptr)
+      {
+        Emit(0x48); Emit(0xB8); Emit64(reinterpret_cast<std::uint64_t>(ptr));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Instruction with two xmm register operands. */
+      void EmitRR(int nOpcode, int dst, int src)
+      {
+        Emit((unsigned char)(nOpcode >> 8));
+        if ((dst | src) & 8)
+          Emit(0x40 | ((dst & 8) ? 0x04 : 0) | ((src & 8) ? 0x01 : 0));
+
+        Emit(0x0F); Emit((unsigned char)nOpcode); Emit(0xC0 | ((dst & 7) << 3) | (src & 7));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Load from or store to [rax]. */
+      void EmitMem(int nOpcode, int xmm)
+      {
+        Emit((unsigned char)(nOpcode >> 8));
+        if (xmm & 8)
+          Emit(0x44);
+
+        Emit(0x0F); Emit((unsigned char)nOpcode); Emit((xmm & 7) << 3);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Load from or store to the stack position sidx, [rbx + 8*sidx]. */
+      void EmitStack(int nOpcode, int xmm, int sidx)
+      {
+        Emit((unsigned char)(nOpcode >> 8));
+        if (xmm & 8)
+          Emit(0x44);
+
+        Emit(0x0F); Emit((unsigned char)nOpcode); Emit(0x83 | ((xmm & 7) << 3)); Emit32(sidx * (int)sizeof(TValue));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static int Slot(int sidx)
+      {
+        return sidx - 1;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void Emit(unsigned char c)
+      {
+        m_vBuf.push_back(c);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void Emit32(std::int32_t n)
+      {
+        for (int i=0; i<4; ++i)
+          Emit((unsigned char)(((std::uint32_t)n >> (8*i)) & 0xFF));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void Emit64(std::uint64_t n)
+      {
+        for (int i=0; i<8; ++i)
+          Emit((unsigned char)((n >> (8*i)) & 0xFF));
+      }
+
+      void *m_pCode;                            ///< Executable copy of the code
+      std::size_t m_nSize;                      ///< Size of the mapping at m_pCode
+      std::vector<unsigned char> m_vBuf;        ///< Code buffer
+      std::vector<std::size_t> m_vExitJumps;    ///< Offsets of the jumps to the function exit
+      mutable std::exception_ptr m_pException;  ///< Exception thrown by a callback during Exec
+  };
+
+#endif // MUP_JIT_SUPPORTED
+
+MUP_NAMESPACE_END
+
+#endif
@@ -6,6 +6,7 @@
 
 //--- muparser framework --------------------------------------------------------------------------
 #include "muParserDef.h"
+#include "muParserSimd.h"
 
 
 MUP_NAMESPACE_START
@@ -143,6 +144,165 @@ MUP_NAMESPACE_START
 
     template<typename T, typename TString>
     const T MathImpl<T, TString>::c_e  = (T)2.718281828459045235360287;
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Vectorized versions of the MathImpl functions.
+
+      The functions have the signature of parser_types::vfun_type. They compute n results at once, 
+      argument k of lane i is args[k][i] and the result is stored in out[i]. out may be identical
+      to args[0]. Each function computes exactly the same values as its scalar counterpart.
+    */
+    template<typename T, typename TString>
+    struct VecMathImpl
+    {
+      typedef MathImpl<T, TString> scalar_type;
+      typedef SimdLanes<T> lanes_type;
+
+      //---------------------------------------------------------------------------------------------
+      /** \brief Apply a scalar function with a single argument to all lanes. */
+      template<void (*F)(T*, int)>
+      static void Map1(T *const *args, T *out, int /*argc*/, std::size_t n)
+      {
+        const T *a = args[0];
+        for (std::size_t i=0; i<n; ++i)
+        {
+          T v = a[i];
+          F(&v, 1);
+          out[i] = v;
+        }
+      }
+
+      //---------------------------------------------------------------------------------------------
+      /** \brief Apply a scalar function with two arguments to all lanes. */
+      template<void (*F)(T*, int)>
+      static void Map2(T *const *args, T *out, int /*argc*/, std::size_t n)
+      {
+        const T *a = args[0], *b = args[1];
+        for (std::size_t i=0; i<n; ++i)
+        {
+          T v[2] = { a[i], b[i] };
+          F(v, 2);
+          out[i] = v[0];
+        }
+      }
+
+      //---------------------------------------------------------------------------------------------
+      /** \brief Apply a scalar function with three arguments to all lanes. */
+      template<void (*F)(T*, int)>
+      static void Map3(T *const *args, T *out, int /*argc*/, std::size_t n)
+      {
+        const T *a = args[0], *b = args[1], *c = args[2];
+        for (std::size_t i=0; i<n; ++i)
+        {
+          T v[3] = { a[i], b[i], c[i] };
+          F(v, 3);
+          out[i] = v[0];
+        }
+      }
+
+      // basic arithmetic operations
+      static void Add(T *const *args, T *out, int, std::size_t n) { lanes_type::Add(out, args[0], args[1], n); }
+      static void Sub(T *const *args, T *out, int, std::size_t n) { lanes_type::Sub(out, args[0], args[1], n); }
+      static void Mul(T *const *args, T *out, int, std::size_t n) { lanes_type::Mul(out, args[0], args[1], n); }
+      static void Div(T *const *args, T *out, int, std::size_t n) { lanes_type::Div(out, args[0], args[1], n); }
+      static void Pow(T *const *args, T *out, int argc, std::size_t n) { Map2<scalar_type::Pow>(args, out, argc, n); }
+
+      // Logical and comparison operators
+      static void And(T *const *args, T *out, int argc, std::size_t n)       { Map2<scalar_type::And>(args, out, argc, n); }
+      static void Or(T *const *args, T *out, int argc, std::size_t n)        { Map2<scalar_type::Or>(args, out, argc, n); }
+      static void Less(T *const *args, T *out, int argc, std::size_t n)      { Map2<scalar_type::Less>(args, out, argc, n); }
+      static void Greater(T *const *args, T *out, int argc, std::size_t n)   { Map2<scalar_type::Greater>(args, out, argc, n); }
+      static void LessEq(T *const *args, T *out, int argc, std::size_t n)    { Map2<scalar_type::LessEq>(args, out, argc, n); }
+      static void GreaterEq(T *const *args, T *out, int argc, std::size_t n) { Map2<scalar_type::GreaterEq>(args, out, argc, n); }
+      static void Equal(T *const *args, T *out, int argc, std::size_t n)     { Map2<scalar_type::Equal>(args, out, argc, n); }
+      static void NotEqual(T *const *args, T *out, int argc, std::size_t n)  { Map2<scalar_type::NotEqual>(args, out, argc, n); }
+
+      // trigonometric and hyperbolic functions
+      static void Sin(T *const *args, T *out, int argc, std::size_t n)   { Map1<scalar_type::Sin>(args, out, argc, n); }
+      static void Cos(T *const *args, T *out, int argc, std::size_t n)   { Map1<scalar_type::Cos>(args, out, argc, n); }
+      static void Tan(T *const *args, T *out, int argc, std::size_t n)   { Map1<scalar_type::Tan>(args, out, argc, n); }
+      static void ASin(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::ASin>(args, out, argc, n); }
+      static void ACos(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::ACos>(args, out, argc, n); }
+      static void ATan(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::ATan>(args, out, argc, n); }
+      static void ATan2(T *const *args, T *out, int argc, std::size_t n) { Map2<scalar_type::ATan2>(args, out, argc, n); }
+      static void Sinh(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Sinh>(args, out, argc, n); }
+      static void Cosh(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Cosh>(args, out, argc, n); }
+      static void Tanh(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Tanh>(args, out, argc, n); }
+      static void ASinh(T *const *args, T *out, int argc, std::size_t n) { Map1<scalar_type::ASinh>(args, out, argc, n); }
+      static void ACosh(T *const *args, T *out, int argc, std::size_t n) { Map1<scalar_type::ACosh>(args, out, argc, n); }
+      static void ATanh(T *const *args, T *out, int argc, std::size_t n) { Map1<scalar_type::ATanh>(args, out, argc, n); }
+
+      // Logarithm and misc functions
+      static void Log(T *const *args, T *out, int argc, std::size_t n)   { Map1<scalar_type::Log>(args, out, argc, n); }
+      static void Log2(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Log2>(args, out, argc, n); }
+      static void Log10(T *const *args, T *out, int argc, std::size_t n) { Map1<scalar_type::Log10>(args, out, argc, n); }
+      static void Exp(T *const *args, T *out, int argc, std::size_t n)   { Map1<scalar_type::Exp>(args, out, argc, n); }
+      static void Abs(T *const *args, T *out, int argc, std::size_t n)   { Map1<scalar_type::Abs>(args, out, argc, n); }
+      static void Sqrt(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Sqrt>(args, out, argc, n); }
+      static void Rint(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Rint>(args, out, argc, n); }
+      static void Sign(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::Sign>(args, out, argc, n); }
+
+      // Unary operator callbacks
+      static void UnaryMinus(T *const *args, T *out, int argc, std::size_t n) { Map1<scalar_type::UnaryMinus>(args, out, argc, n); }
+      static void UnaryPlus(T *const *args, T *out, int argc, std::size_t n)  { Map1<scalar_type::UnaryPlus>(args, out, argc, n); }
+
+      //---------------------------------------------------------------------------------------------
+      // Functions with unlimited number of arguments
+      static void Sum(T *const *args, T *out, int a_iArgc, std::size_t n)
+      { 
+        if (!a_iArgc)	
+          throw ParserError<TString>(_SL("too few arguments for function sum."));
+
+        for (std::size_t i=0; i<n; ++i) 
+          out[i] = args[0][i];
+
+        for (int k=1; k<a_iArgc; ++k) 
+          lanes_type::Add(out, out, args[k], n);
+      }
+
+      //---------------------------------------------------------------------------
+      static void Avg(T *const *args, T *out, int a_iArgc, std::size_t n)
+      { 
+        if (!a_iArgc)	
+          throw ParserError<TString>(_SL("too few arguments for function sum."));
+
+        Sum(args, out, a_iArgc, n);
+      }
+
+      //---------------------------------------------------------------------------
+      static void Min(T *const *args, T *out, int a_iArgc, std::size_t n)
+      { 
+        if (!a_iArgc)	
+          throw ParserError<TString>(_SL("too few arguments for function min."));
+
+        for (std::size_t i=0; i<n; ++i) 
+          out[i] = args[0][i];
+
+        for (int k=1; k<a_iArgc; ++k) 
+        {
+          const T *a = args[k];
+          for (std::size_t i=0; i<n; ++i) 
+            out[i] = std::min(out[i], a[i]);
+        }
+      }
+
+      //---------------------------------------------------------------------------
+      static void Max(T *const *args, T *out, int a_iArgc, std::size_t n)
+      { 
+        if (!a_iArgc)	
+          throw ParserError<TString>(_SL("too few arguments for function min."));
+
+        for (std::size_t i=0; i<n; ++i) 
+          out[i] = args[0][i];
+
+        for (int k=1; k<a_iArgc; ++k) 
+        {
+          const T *a = args[k];
+          for (std::size_t i=0; i<n; ++i) 
+            out[i] = std::max(out[i], a[i]);
+        }
+      }
+    };
 }
 
 #endif
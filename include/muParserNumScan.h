@@ -0,0 +1,311 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_NUM_SCAN_H
+#define MU_PARSER_NUM_SCAN_H
+
+#include <cstdlib>
+#include <clocale>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "muParserDef.h"
+
+/** \file
+    \brief Scanner for numeric literals working directly on the expression string.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Locale independent scanner for numeric literals.
+
+    The functions work like std::from_chars: they read the longest literal at the start of 
+    the given string and return the number of characters used, 0 if there is no literal. 
+    They do not depend on the global locale and do not allocate memory except for decimal
+    literals with an excessive number of digits.
+
+    Decimal literals are rounded correctly. Literals with at most 19 significant digits and a 
+    small exponent are converted exactly with a single multiplication or division by a power 
+    of ten, all others by the conversion functions of the C library.
+  */
+  template<typename TValue, typename TChar>
+  struct NumScanner
+  {
+      //-------------------------------------------------------------------------------------------
+      /** \brief Read a decimal floating point literal.
+          \param a_szExpr The expression string starting at the literal.
+          \param a_fVal [out] The value of the literal.
+          \return The length of the literal or 0 if there is none or its value is out of range.
+
+        The literal consists of an optional sign, digits with an optional decimal point and
+        an optional exponent. An exponent without digits is not part of the literal.
+      */
+      static int ScanFloat(const TChar *a_szExpr, TValue &a_fVal)
+      {
+        const int nMaxDigits = 19;   // significant digits fitting into the mantissa below
+
+        unsigned long long nMant = 0;
+        int nDigits = 0,             // significant digits stored in nMant
+            iExp10 = 0;
+        bool bTruncated = false,     // nonzero digits did not fit into nMant
+             bAnyDigit = false;
+
+        int i = 0;
+        bool bNeg = (a_szExpr[0]=='-');
+        if (a_szExpr[0]=='-' || a_szExpr[0]=='+')
+          ++i;
+
+        for (; IsDigit(a_szExpr[i], 10); ++i)
+        {
+          bAnyDigit = true;
+          int iDigit = a_szExpr[i] - '0';
+          if (nDigits<nMaxDigits)
+          {
+            nMant = nMant*10 + iDigit;
+            nDigits += (nMant!=0);
+          }
+          else
+          {
+            ++iExp10;
+            bTruncated |= (iDigit!=0);
+          }
+        }
+
+        if (a_szExpr[i]=='.')
+        {
+          for (++i; IsDigit(a_szExpr[i], 10); ++i)
+          {
+            bAnyDigit = true;
+            int iDigit = a_szExpr[i] - '0';
+            if (nDigits<nMaxDigits)
+            {
+              nMant = nMant*10 + iDigit;
+              nDigits += (nMant!=0);
+              --iExp10;
+            }
+            else
+              bTruncated |= (iDigit!=0);
+          }
+        }
+
+        if (!bAnyDigit)
+          return 0;
+
+        if (a_szExpr[i]=='e' || a_szExpr[i]=='E')
+        {
+          int j = i + 1;
+          bool bNegExp = (a_szExpr[j]=='-');
+          if (a_szExpr[j]=='-' || a_szExpr[j]=='+')
+            ++j;
+
+          if (IsDigit(a_szExpr[j], 10))
+          {
+            int iExp = 0;
+            for (; IsDigit(a_szExpr[j], 10); ++j)
+            {
+              if (iExp<100000)
+                iExp = iExp*10 + (a_szExpr[j] - '0');
+            }
+
+            iExp10 += (bNegExp) ? -iExp : iExp;
+            i = j;
+          }
+        }
+
+        // Fast path: the mantissa and the power of ten are exact, a single rounding remains
+        const int nMaxExp10 = GetMaxExactExp10();
+        if ( nMant==0 ||
+             (!bTruncated && 
+              nMant<=GetMaxExactMant() &&
+              iExp10>=-nMaxExp10 && iExp10<=nMaxExp10) )
+        {
+          TValue fVal = (TValue)nMant;
+          if (iExp10<0)
+            fVal /= GetPow10(-iExp10);
+          else if (iExp10>0)
+            fVal *= GetPow10(iExp10);
+
+          a_fVal = (bNeg) ? -fVal : fVal;
+          return i;
+        }
+
+        return ConvertSlow(a_szExpr, i, a_fVal);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Read an unsigned integer literal without prefix.
+          \param a_szExpr The expression string starting at the literal.
+          \param a_nBase The base of the literal, 2, 10 or 16.
+          \param a_nMax The largest value allowed.
+          \param a_nVal [out] The value of the literal.
+          \param a_bOverflow [out] Set if the value exceeds a_nMax.
+          \return The length of the literal or 0 if there is none.
+      */
+      static int ScanInt(const TChar *a_szExpr, 
+                         unsigned a_nBase, 
+                         unsigned long long a_nMax, 
+                         unsigned long long &a_nVal,
+                         bool &a_bOverflow)
+      {
+        unsigned long long nVal = 0;
+        a_bOverflow = false;
+
+        int i = 0;
+        for (; IsDigit(a_szExpr[i], a_nBase); ++i)
+        {
+          unsigned long long nDigit = GetDigitVal(a_szExpr[i]);
+          if (nVal > (a_nMax - nDigit) / a_nBase)
+            a_bOverflow = true;
+          else
+            nVal = nVal*a_nBase + nDigit;
+        }
+
+        a_nVal = nVal;
+        return i;
+      }
+
+  private:
+
+      //-------------------------------------------------------------------------------------------
+      static bool IsDigit(TChar c, unsigned a_nBase)
+      {
+        if (a_nBase<=10)
+          return c>='0' && c<(TChar)('0' + a_nBase);
+
+        return (c>='0' && c<='9') || (c>='a' && c<='f') || (c>='A' && c<='F');
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static unsigned GetDigitVal(TChar c)
+      {
+        if (c>='a')
+          return (unsigned)(c - 'a' + 10);
+        else if (c>='A')
+          return (unsigned)(c - 'A' + 10);
+        else
+          return (unsigned)(c - '0');
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the largest integer up to which all integers are exactly representable in TValue. */
+      static unsigned long long GetMaxExactMant()
+      {
+        const int nBits = std::numeric_limits<TValue>::digits;
+        return (nBits>=64) ? ~0ULL : (1ULL << (nBits & 63));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the largest power of ten that is exactly representable in TValue. */
+      static int GetMaxExactExp10()
+      {
+        // 10^k is exact as long as 5^k fits into the mantissa
+        static const int s_nMaxExp10 = []()
+          {
+            int k = 0;
+            for (unsigned long long n5 = 5; n5<=GetMaxExactMant() && k<27; n5 *= 5)
+              ++k;
+
+            return k;
+          }();
+
+        return s_nMaxExp10;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static TValue GetPow10(int a_iExp)
+      {
+        static const TValue s_fPow10[] = { (TValue)1e0,  (TValue)1e1,  (TValue)1e2,  (TValue)1e3,  
+                                           (TValue)1e4,  (TValue)1e5,  (TValue)1e6,  (TValue)1e7,  
+                                           (TValue)1e8,  (TValue)1e9,  (TValue)1e10, (TValue)1e11, 
+                                           (TValue)1e12, (TValue)1e13, (TValue)1e14, (TValue)1e15,
+                                           (TValue)1e16, (TValue)1e17, (TValue)1e18, (TValue)1e19,
+                                           (TValue)1e20, (TValue)1e21, (TValue)1e22, (TValue)1e23L, 
+                                           (TValue)1e24L, (TValue)1e25L, (TValue)1e26L, (TValue)1e27L };
+        return s_fPow10[a_iExp];
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static void StrToVal(const char *a_szBuf, char **a_pEnd, float &a_fVal)       { a_fVal = std::strtof(a_szBuf, a_pEnd); }
+      static void StrToVal(const char *a_szBuf, char **a_pEnd, double &a_fVal)      { a_fVal = std::strtod(a_szBuf, a_pEnd); }
+      static void StrToVal(const char *a_szBuf, char **a_pEnd, long double &a_fVal) { a_fVal = std::strtold(a_szBuf, a_pEnd); }
+
+      template<typename T>
+      static void StrToVal(const char *a_szBuf, char **a_pEnd, T &a_fVal)           { a_fVal = (T)std::strtod(a_szBuf, a_pEnd); }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Convert the a_nLen characters of a literal with the C library.
+      
+        The literal is copied into a narrow buffer using the decimal point of the C locale
+        currently set, so the result does not depend on it.
+      */
+      static int ConvertSlow(const TChar *a_szExpr, int a_nLen, TValue &a_fVal)
+      {
+        const char *szPoint = std::localeconv()->decimal_point;
+        const std::size_t nPointLen = std::strlen(szPoint);
+
+        char szLocal[128];
+        std::string sHeap;
+        char *szBuf = szLocal;
+        if ((a_nLen + 1)*nPointLen >= sizeof(szLocal))
+        {
+          sHeap.resize((a_nLen + 1)*nPointLen + 1);
+          szBuf = &sHeap[0];
+        }
+
+        std::size_t n = 0;
+        for (int i=0; i<a_nLen; ++i)
+        {
+          if (a_szExpr[i]=='.')
+          {
+            std::memcpy(szBuf + n, szPoint, nPointLen);
+            n += nPointLen;
+          }
+          else
+            szBuf[n++] = (char)a_szExpr[i];
+        }
+        szBuf[n] = 0;
+
+        char *pEnd = nullptr;
+        TValue fVal;
+        StrToVal(szBuf, &pEnd, fVal);
+        if (pEnd!=szBuf + n)
+          return 0;
+
+        // out of range, std::from_chars would report an error as well
+        if ( std::numeric_limits<TValue>::has_infinity && 
+             (fVal==std::numeric_limits<TValue>::infinity() || fVal==-std::numeric_limits<TValue>::infinity()) )
+        {
+          return 0;
+        }
+
+        a_fVal = fVal;
+        return a_nLen;
+      }
+  };
+
+MUP_NAMESPACE_END
+
+#endif
@@ -0,0 +1,427 @@
+/*
+                 __________                                      
+    _____   __ __\______   \_____  _______  ______  ____ _______ 
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|   
+        \/                       \/            \/      \/        
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify, 
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or 
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND 
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, 
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. 
+*/
+#ifndef MU_PARSER_REGCODE_H
+#define MU_PARSER_REGCODE_H
+
+#include <vector>
+
+#include "muParserDef.h"
+#include "muParserBytecode.h"
+
+/** \file
+    \brief Register based form of the parser bytecode.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Register based (three address) version of the bytecode.
+
+    The bytecode is lowered into instructions like "r3 = mul(r3, var[x])". Registers are the
+    slots of the evaluation stack, so the arguments of a callback still end up in successive 
+    registers. Value tokens are not pushed. They are kept pending and become an operand of 
+    the builtin arithmetic instruction consuming them. A value is only loaded into its 
+    register if it is the argument of a callback, the final result or if its variable could
+    be changed before it is used.
+  */
+  template<typename TValue, typename TString>
+  class ParserRegCode
+  {
+  private:
+
+      typedef ParserByteCode<TValue, TString> bytecode_type;
+      typedef typename bytecode_type::SInstr token_type;
+      typedef std::basic_stringstream<typename TString::value_type,
+                                      std::char_traits<typename TString::value_type>,  
+                                      std::allocator<typename TString::value_type> > stringstream_type;
+      typedef void (*fun_type)(TValue*, int narg);
+      typedef MathImpl<TValue, TString> math_type;
+
+  public:
+
+      /** \brief Value operand, evaluates to *ptr * mul + fixed. */
+      struct SValOp
+      {
+        const TValue *ptr;
+        TValue mul;
+        TValue fixed;
+      };
+
+      /** \brief Callback operand. */
+      struct SFunOp
+      {
+        fun_type ptr;
+        int argc;
+      };
+
+      /** \brief A single instruction. */
+      struct SInstr
+      {
+        const void *Handler;  ///< Address of the handler of Cmd (computed goto dispatch only)
+        ERegCode Cmd;
+        int Dst;              ///< Destination register, first argument of rcCALL
+        int Src;              ///< Register of the second operand (_RR, _VR, _KR and rcASSIGN only)
+
+        union
+        {
+          SValOp Val;
+          SFunOp Fun;
+          TValue *Var;   ///< Assignment target
+        };
+      };
+
+      //-------------------------------------------------------------------------------------------
+      ParserRegCode()
+        :m_vCode()
+        ,m_vIdent()
+        ,m_bLinked(false)
+      {}
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Lower finalized bytecode into register instructions. */
+      void Compile(const bytecode_type &a_ByteCode)
+      {
+        m_vCode.clear();
+        m_vIdent.clear();
+        m_bLinked = false;
+
+        // Value tokens not yet loaded into their register, indexed by stack position
+        std::vector<const token_type*> vPending(a_ByteCode.GetMaxStackSize() + 1, nullptr);
+        int sidx = 0;
+
+        const token_type *pBase = a_ByteCode.GetBase();
+        for (const token_type *pTok = pBase; pTok->Cmd!=cmEND; ++pTok)
+        {
+          const TString &sIdent = a_ByteCode.GetIdent(pTok - pBase);
+
+          switch(pTok->Cmd)
+          {
+          case cmVAL_EX:
+               vPending[++sidx] = pTok;
+               continue;
+
+          case cmASSIGN:
+               {
+                 // The left hand side variable is not needed, all other variables 
+                 // must be read before they are overwritten
+                 const token_type *pVar = vPending[sidx-1];
+                 vPending[sidx-1] = nullptr;
+                 LoadPending(a_ByteCode, vPending, 1, sidx, false);
+                 LoadPending(a_ByteCode, vPending, sidx, sidx, true);
+
+                 SInstr &instr = AddInstr(rcASSIGN, sidx-1, (pVar) ? a_ByteCode.GetIdent(pVar - pBase) : sIdent);
+                 instr.Src = sidx;
+                 instr.Var = pTok->Oprt.ptr;
+                 --sidx;
+               }
+               continue;
+
+          case cmFUNC:
+               {
+                 const int argc = pTok->Fun.argc;
+                 ERegCode eCode = GetArithmeticCode(pTok->Fun);
+
+                 if (eCode!=rcEND)
+                 {
+                   const int d = --sidx;
+
+                   // with two pending values the left one is loaded into its register
+                   if (vPending[d] && vPending[d+1])
+                     LoadPending(a_ByteCode, vPending, d, d, true);
+
+                   if (vPending[d+1])
+                   {
+                     const int nVariant = (vPending[d+1]->IsConst()) ? 3 : 1;  // _RK or _RV
+                     AddInstr(a_ByteCode, (ERegCode)(eCode + nVariant), d, vPending[d+1]);
+                   }
+                   else if (vPending[d])
+                   {
+                     const int nVariant = (vPending[d]->IsConst()) ? 4 : 2;    // _KR or _VR
+                     SInstr &instr = AddInstr(a_ByteCode, (ERegCode)(eCode + nVariant), d, vPending[d]);
+                     instr.Src = d + 1;
+                   }
+                   else
+                   {
+                     SInstr &instr = AddInstr(eCode, d, sIdent);
+                     instr.Src = d + 1;
+                   }
+
+                   vPending[d] = vPending[d+1] = nullptr;
+                 }
+                 else if ((eCode = GetUnaryCode(pTok->Fun))!=rcEND)
+                 {
+                   // builtin functions have no side effects, only the argument is loaded
+                   LoadPending(a_ByteCode, vPending, sidx, sidx, true);
+                   AddInstr(eCode, sidx, sIdent);
+                 }
+                 else
+                 {
+                   // Callbacks may change variables, so variables must be read before
+                   // the call. The arguments need to be loaded into their registers.
+                   LoadPending(a_ByteCode, vPending, 1, sidx, false);
+                   LoadPending(a_ByteCode, vPending, sidx - argc + 1, sidx, true);
+
+                   sidx -= argc - 1;
+                   SInstr &instr = AddInstr(rcCALL, sidx, sIdent);
+                   instr.Fun.ptr  = pTok->Fun.ptr;
+                   instr.Fun.argc = argc;
+                 }
+               }
+               continue;
+
+          default:
+               throw ParserError<TString>(ecINTERNAL_ERROR);
+          }
+        }
+
+        // All results must be in their registers
+        LoadPending(a_ByteCode, vPending, 1, sidx, true);
+        AddInstr(rcEND, 0, TString());
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void Clear()
+      {
+        m_vCode.clear();
+        m_vIdent.clear();
+        m_bLinked = false;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns true if the handler addresses of the instructions are set. */
+      bool IsLinked() const
+      {
+        return m_bLinked;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Store the handler address of each instruction.
+          \param a_pHandler Handler addresses indexed by instruction code.
+      */
+      void Link(const void *const *a_pHandler)
+      {
+        for (std::size_t i=0; i<m_vCode.size(); ++i)
+          m_vCode[i].Handler = a_pHandler[m_vCode[i].Cmd];
+
+        m_bLinked = true;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      std::size_t GetSize() const
+      {
+        return m_vCode.size();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      const SInstr* GetBase() const
+      {
+        if (m_vCode.size()==0)
+          throw ParserError<TString>(ecINTERNAL_ERROR);
+        else
+          return &m_vCode[0];
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void AsciiDump() const
+      {
+        if (!m_vCode.size()) 
+        {
+          _OUT << _SL("No register code available\n");
+          return;
+        }
+
+        static const typename TString::value_type *szOp[] = { _SL("add"), _SL("sub"), _SL("mul"), _SL("div") };
+
+        _OUT << _SL("Number of instructions:") << std::dec << (int)m_vCode.size()-1 << _SL("\n");
+        for (std::size_t i=0; i<m_vCode.size() && m_vCode[i].Cmd!=rcEND; ++i)
+        {
+          const SInstr &instr = m_vCode[i];
+          const TString &sIdent = m_vIdent[i];
+          _OUT << std::dec << i << _SL(" : r") << instr.Dst << _SL(" = ");
+
+          switch(instr.Cmd)
+          {
+          case rcLOAD:
+          case rcLOAD_VAR:
+          case rcLOAD_CONST:
+                DumpVal(instr, sIdent);
+                break;
+
+          case rcCALL:
+                _OUT << sIdent << _SL("(r") << instr.Dst;
+                if (instr.Fun.argc>1)
+                  _OUT << _SL(" .. r") << instr.Dst + instr.Fun.argc - 1;
+                _OUT << _SL(")");
+                break;
+
+          case rcNEG:
+          case rcSIN:
+          case rcCOS:
+          case rcTAN:
+          case rcSQRT:
+          case rcEXP:
+          case rcLOG:
+          case rcABS:
+                _OUT << sIdent << _SL("(r") << instr.Dst << _SL(")");
+                break;
+
+          case rcASSIGN:
+                _OUT << _SL("var[") << sIdent << _SL("] = r") << instr.Src;
+                break;
+
+          default:
+                {
+                  const int nOp  = (instr.Cmd - rcADD_RR) / (rcSUB_RR - rcADD_RR),
+                            nArg = (instr.Cmd - rcADD_RR) % (rcSUB_RR - rcADD_RR);
+                  _OUT << szOp[nOp] << _SL("(");
+                  switch(nArg)
+                  {
+                  case 0:  _OUT << _SL("r") << instr.Dst << _SL(", r") << instr.Src; break;
+                  case 1:
+                  case 3:  _OUT << _SL("r") << instr.Dst << _SL(", "); DumpVal(instr, sIdent); break;
+                  default: DumpVal(instr, sIdent); _OUT << _SL(", r") << instr.Src; break;
+                  }
+                  _OUT << _SL(")");
+                }
+                break;
+          }
+
+          _OUT << _SL("\n");
+        }
+
+        _OUT << _SL("END\n");
+      }
+
+  private:
+
+      std::vector<SInstr> m_vCode;
+      std::vector<TString> m_vIdent;   ///< Identifiers of the instructions (debug dump only)
+      bool m_bLinked;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the _RR code of a builtin arithmetic operator or rcEND for any other callback. */
+      static ERegCode GetArithmeticCode(const typename Token<TValue, TString>::SFunDef &fun)
+      {
+        if (fun.argc!=2)
+          return rcEND;
+
+        if (fun.ptr==&math_type::Add) return rcADD_RR;
+        if (fun.ptr==&math_type::Sub) return rcSUB_RR;
+        if (fun.ptr==&math_type::Mul) return rcMUL_RR;
+        if (fun.ptr==&math_type::Div) return rcDIV_RR;
+        return rcEND;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the code of a builtin function with a single argument or rcEND. */
+      static ERegCode GetUnaryCode(const typename Token<TValue, TString>::SFunDef &fun)
+      {
+        if (fun.argc!=1)
+          return rcEND;
+
+        if (fun.ptr==&math_type::UnaryMinus) return rcNEG;
+        if (fun.ptr==&math_type::Sin)  return rcSIN;
+        if (fun.ptr==&math_type::Cos)  return rcCOS;
+        if (fun.ptr==&math_type::Tan)  return rcTAN;
+        if (fun.ptr==&math_type::Sqrt) return rcSQRT;
+        if (fun.ptr==&math_type::Exp)  return rcEXP;
+        if (fun.ptr==&math_type::Log)  return rcLOG;
+        if (fun.ptr==&math_type::Abs)  return rcABS;
+        return rcEND;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      SInstr& AddInstr(ERegCode eCode, int nDst, const TString &sIdent)
+      {
+        SInstr instr;
+        instr.Handler = nullptr;
+        instr.Cmd = eCode;
+        instr.Dst = nDst;
+        instr.Src = 0;
+        instr.Val.ptr = nullptr;
+        instr.Val.mul = 0;
+        instr.Val.fixed = 0;
+        m_vCode.push_back(instr);
+        m_vIdent.push_back(sIdent);
+        return m_vCode.back();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      SInstr& AddInstr(const bytecode_type &a_ByteCode, ERegCode eCode, int nDst, const token_type *pVal)
+      {
+        SInstr &instr = AddInstr(eCode, nDst, a_ByteCode.GetIdent(pVal - a_ByteCode.GetBase()));
+        instr.Val.ptr   = pVal->Val.ptr;
+        instr.Val.mul   = pVal->Val.mul;
+        instr.Val.fixed = pVal->Val.fixed;
+        return instr;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Load pending values of the registers a_nFirst to a_nLast.
+          \param a_bConst If false only values with a variable part are loaded.
+      */
+      void LoadPending(const bytecode_type &a_ByteCode, 
+                       std::vector<const token_type*> &a_vPending, 
+                       int a_nFirst, 
+                       int a_nLast, 
+                       bool a_bConst)
+      {
+        for (int i=std::max(a_nFirst, 1); i<=a_nLast; ++i)
+        {
+          const token_type *pVal = a_vPending[i];
+          if (!pVal || (!a_bConst && pVal->IsConst()))
+            continue;
+
+          ERegCode eCode = rcLOAD;
+          if (pVal->IsConst())
+            eCode = rcLOAD_CONST;
+          else if (pVal->Val.mul==1 && pVal->Val.fixed==0)
+            eCode = rcLOAD_VAR;
+
+          AddInstr(a_ByteCode, eCode, i, pVal);
+          a_vPending[i] = nullptr;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static void DumpVal(const SInstr &instr, const TString &sIdent)
+      {
+        if (instr.Val.ptr==&ParserBase<TValue, TString>::g_NullValue)
+        {
+          _OUT << instr.Val.fixed;
+        }
+        else
+        {
+          _OUT << _SL("var[") << sIdent << _SL("]");
+          if (instr.Val.mul!=1)
+            _OUT << _SL("*") << instr.Val.mul;
+          if (instr.Val.fixed!=0)
+            _OUT << _SL("+") << instr.Val.fixed;
+        }
+      }
+  };
+} // namespace mu
+
+#endif
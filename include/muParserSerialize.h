@@ -0,0 +1,158 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_SERIALIZE_H
+#define MU_PARSER_SERIALIZE_H
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+#include "muParserDef.h"
+#include "muParserError.h"
+
+/** \file
+    \brief Helpers for the binary format of serialized bytecode.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Appends values in native byte order to a memory block. */
+  template<typename TString>
+  class ParserBlobWriter
+  {
+  public:
+
+      explicit ParserBlobWriter(std::vector<unsigned char> &a_vBlob)
+        :m_vBlob(a_vBlob)
+      {}
+
+      //-------------------------------------------------------------------------------------------
+      template<typename T>
+      void Write(const T &a_Val)
+      {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+        const unsigned char *pVal = reinterpret_cast<const unsigned char*>(&a_Val);
+        m_vBlob.insert(m_vBlob.end(), pVal, pVal + sizeof(T));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Overwrite a value written before, e.g. a size only known at the end. */
+      template<typename T>
+      void WriteAt(std::size_t a_nPos, const T &a_Val)
+      {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+        std::memcpy(&m_vBlob[a_nPos], &a_Val, sizeof(T));
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void WriteString(const TString &a_sVal)
+      {
+        Write((std::uint32_t)a_sVal.length());
+        for (std::size_t i=0; i<a_sVal.length(); ++i)
+          Write(a_sVal[i]);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      std::size_t GetPos() const
+      {
+        return m_vBlob.size();
+      }
+
+  private:
+
+      std::vector<unsigned char> &m_vBlob;
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Reads values written by ParserBlobWriter. 
+  
+    The reader does not copy the memory block, it can be used on a memory mapped file.
+    Reading past the end of the block throws a ParserError with the code ecINVALID_BYTECODE.
+  */
+  template<typename TString>
+  class ParserBlobReader
+  {
+  public:
+
+      ParserBlobReader(const void *a_pData, std::size_t a_nSize)
+        :m_pData(static_cast<const unsigned char*>(a_pData))
+        ,m_nSize(a_nSize)
+        ,m_nPos(0)
+      {}
+
+      //-------------------------------------------------------------------------------------------
+      template<typename T>
+      T Read()
+      {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read");
+        Require(sizeof(T));
+
+        T val;
+        std::memcpy(&val, m_pData + m_nPos, sizeof(T));
+        m_nPos += sizeof(T);
+        return val;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      TString ReadString()
+      {
+        typedef typename TString::value_type char_type;
+
+        const std::size_t nLen = Read<std::uint32_t>();
+        Require(nLen * sizeof(char_type));
+
+        TString sVal(nLen, char_type());
+        if (nLen)
+          std::memcpy(&sVal[0], m_pData + m_nPos, nLen * sizeof(char_type));
+
+        m_nPos += nLen * sizeof(char_type);
+        return sVal;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      std::size_t GetPos() const
+      {
+        return m_nPos;
+      }
+
+  private:
+
+      //-------------------------------------------------------------------------------------------
+      void Require(std::size_t a_nBytes) const
+      {
+        if (a_nBytes > m_nSize - m_nPos)
+          throw ParserError<TString>(ecINVALID_BYTECODE, -1, _SL("unexpected end of data"));
+      }
+
+      const unsigned char *m_pData;
+      std::size_t m_nSize;
+      std::size_t m_nPos;
+  };
+
+MUP_NAMESPACE_END
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef MU_PARSER_SIMD_H
+#define MU_PARSER_SIMD_H
+
+//--- Standard includes ---------------------------------------------------------------------------
+#include <cstddef>
+
+//--- muparser framework --------------------------------------------------------------------------
+#include "muParserDef.h"
+
+/** \file
+    \brief Vector register abstraction and lane kernels used by the bulk evaluation.
+
+  The instruction set is selected at compile time from the compiler flags. AVX-512 is used if
+  available, otherwise AVX/AVX2 and finally SSE2. Define MUP_NO_SIMD in order to use plain
+  scalar loops.
+*/
+
+#if !defined(MUP_NO_SIMD)
+  #if defined(__AVX512F__)
+    #define MUP_SIMD_AVX512
+  #elif defined(__AVX2__) || defined(__AVX__)
+    #define MUP_SIMD_AVX
+  #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+    #define MUP_SIMD_SSE2
+  #endif
+#endif
+
+#if defined(MUP_SIMD_AVX512) || defined(MUP_SIMD_AVX)
+  #include <immintrin.h>
+#elif defined(MUP_SIMD_SSE2)
+  #include <emmintrin.h>
+#endif
+
+
+MUP_NAMESPACE_START
+
+  //---------------------------------------------------------------------------------------------
+  /** \brief Vector register traits for a value type.
+
+    The generic version treats a single value as a register of width 1 and is used for all
+    value types without a specialization.
+  */
+  template<typename T>
+  struct SimdTraits
+  {
+    typedef T vec_type;
+    static const std::size_t width = 1;
+
+    static vec_type Load(const T *p)            { return *p; }
+    static void     Store(T *p, vec_type v)     { *p = v; }
+    static vec_type Set1(T v)                   { return v; }
+    static vec_type Add(vec_type a, vec_type b) { return a + b; }
+    static vec_type Sub(vec_type a, vec_type b) { return a - b; }
+    static vec_type Mul(vec_type a, vec_type b) { return a * b; }
+    static vec_type Div(vec_type a, vec_type b) { return a / b; }
+  };
+
+#if defined(MUP_SIMD_AVX512)
+
+  //---------------------------------------------------------------------------------------------
+  template<>
+  struct SimdTraits<double>
+  {
+    typedef __m512d vec_type;
+    static const std::size_t width = 8;
+
+    static vec_type Load(const double *p)       { return _mm512_loadu_pd(p); }
+    static void     Store(double *p, vec_type v){ _mm512_storeu_pd(p, v); }
+    static vec_type Set1(double v)              { return _mm512_set1_pd(v); }
+    static vec_type Add(vec_type a, vec_type b) { return _mm512_add_pd(a, b); }
+    static vec_type Sub(vec_type a, vec_type b) { return _mm512_sub_pd(a, b); }
+    static vec_type Mul(vec_type a, vec_type b) { return _mm512_mul_pd(a, b); }
+    static vec_type Div(vec_type a, vec_type b) { return _mm512_div_pd(a, b); }
+  };
+
+  //---------------------------------------------------------------------------------------------
+  template<>
+  struct SimdTraits<float>
+  {
+    typedef __m512 vec_type;
+    static const std::size_t width = 16;
+
+    static vec_type Load(const float *p)        { return _mm512_loadu_ps(p); }
+    static void     Store(float *p, vec_type v) { _mm512_storeu_ps(p, v); }
+    static vec_type Set1(float v)               { return _mm512_set1_ps(v); }
+    static vec_type Add(vec_type a, vec_type b) { return _mm512_add_ps(a, b); }
+    static vec_type Sub(vec_type a, vec_type b) { return _mm512_sub_ps(a, b); }
+    static vec_type Mul(vec_type a, vec_type b) { return _mm512_mul_ps(a, b); }
+    static vec_type Div(vec_type a, vec_type b) { return _mm512_div_ps(a, b); }
+  };
+
+#elif defined(MUP_SIMD_AVX)
+
+  //---------------------------------------------------------------------------------------------
+  template<>
+  struct SimdTraits<double>
+  {
+    typedef __m256d vec_type;
+    static const std::size_t width = 4;
+
+    static vec_type Load(const double *p)       { return _mm256_loadu_pd(p); }
+    static void     Store(double *p, vec_type v){ _mm256_storeu_pd(p, v); }
+    static vec_type Set1(double v)              { return _mm256_set1_pd(v); }
+    static vec_type Add(vec_type a, vec_type b) { return _mm256_add_pd(a, b); }
+    static vec_type Sub(vec_type a, vec_type b) { return _mm256_sub_pd(a, b); }
+    static vec_type Mul(vec_type a, vec_type b) { return _mm256_mul_pd(a, b); }
+    static vec_type Div(vec_type a, vec_type b) { return _mm256_div_pd(a, b); }
+  };
+
+  //---------------------------------------------------------------------------------------------
+  template<>
+  struct SimdTraits<float>
+  {
+    typedef __m256 vec_type;
+    static const std::size_t width = 8;
+
+    static vec_type Load(const float *p)        { return _mm256_loadu_ps(p); }
+    static void     Store(float *p, vec_type v) { _mm256_storeu_ps(p, v); }
+    static vec_type Set1(float v)               { return _mm256_set1_ps(v); }
+    static vec_type Add(vec_type a, vec_type b) { return _mm256_add_ps(a, b); }
+    static vec_type Sub(vec_type a, vec_type b) { return _mm256_sub_ps(a, b); }
+    static vec_type Mul(vec_type a, vec_type b) { return _mm256_mul_ps(a, b); }
+    static vec_type Div(vec_type a, vec_type b) { return _mm256_div_ps(a, b); }
+  };
+
+#elif defined(MUP_SIMD_SSE2)
+
+  //---------------------------------------------------------------------------------------------
+  template<>
+  struct SimdTraits<double>
+  {
+    typedef __m128d vec_type;
+    static const std::size_t width = 2;
+
+    static vec_type Load(const double *p)       { return _mm_loadu_pd(p); }
+    static void     Store(double *p, vec_type v){ _mm_storeu_pd(p, v); }
+    static vec_type Set1(double v)              { return _mm_set1_pd(v); }
+    static vec_type Add(vec_type a, vec_type b) { return _mm_add_pd(a, b); }
+    static vec_type Sub(vec_type a, vec_type b) { return _mm_sub_pd(a, b); }
+    static vec_type Mul(vec_type a, vec_type b) { return _mm_mul_pd(a, b); }
+    static vec_type Div(vec_type a, vec_type b) { return _mm_div_pd(a, b); }
+  };
+
+  //---------------------------------------------------------------------------------------------
+  template<>
+  struct SimdTraits<float>
+  {
+    typedef __m128 vec_type;
+    static const std::size_t width = 4;
+
+    static vec_type Load(const float *p)        { return _mm_loadu_ps(p); }
+    static void     Store(float *p, vec_type v) { _mm_storeu_ps(p, v); }
+    static vec_type Set1(float v)               { return _mm_set1_ps(v); }
+    static vec_type Add(vec_type a, vec_type b) { return _mm_add_ps(a, b); }
+    static vec_type Sub(vec_type a, vec_type b) { return _mm_sub_ps(a, b); }
+    static vec_type Mul(vec_type a, vec_type b) { return _mm_mul_ps(a, b); }
+    static vec_type Div(vec_type a, vec_type b) { return _mm_div_ps(a, b); }
+  };
+
+#endif
+
+  //---------------------------------------------------------------------------------------------
+  /** \brief Kernels operating on all lanes of a bulk evaluation stack slot.
+
+    All kernels process n lanes, the remainder that does not fill a complete register is
+    handled by a scalar loop. Memory is accessed unaligned. The output of the binary kernels 
+    may be identical to one of the inputs.
+  */
+  template<typename T>
+  struct SimdLanes
+  {
+    typedef SimdTraits<T> simd;
+    typedef typename simd::vec_type vec_type;
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Load a variable column: a_pDst[i] = a_pSrc[i*a_nStride] * a_fMul + a_fFixed. */
+    static void Load(T *a_pDst, const T *a_pSrc, std::size_t a_nStride, T a_fMul, T a_fFixed, std::size_t n)
+    {
+      const std::size_t w = simd::width;
+      std::size_t i = 0;
+
+      if (a_nStride==0)
+      {
+        const T val = *a_pSrc * a_fMul + a_fFixed;
+        const vec_type v = simd::Set1(val);
+        for (; i+w<=n; i+=w)
+          simd::Store(a_pDst + i, v);
+
+        for (; i<n; ++i)
+          a_pDst[i] = val;
+      }
+      else if (a_nStride==1)
+      {
+        const vec_type m = simd::Set1(a_fMul),
+                       f = simd::Set1(a_fFixed);
+        for (; i+w<=n; i+=w)
+          simd::Store(a_pDst + i, simd::Add(simd::Mul(simd::Load(a_pSrc + i), m), f));
+
+        for (; i<n; ++i)
+          a_pDst[i] = a_pSrc[i] * a_fMul + a_fFixed;
+      }
+      else
+      {
+        for (; i<n; ++i)
+          a_pDst[i] = a_pSrc[i*a_nStride] * a_fMul + a_fFixed;
+      }
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Store lanes into a variable column and into the result slot.
+
+      With a stride of 0 the variable receives the value of the last lane just like it would
+      when evaluating the rows one after another.
+    */
+    static void Assign(T *a_pVar, std::size_t a_nStride, T *a_pRes, const T *a_pVal, std::size_t n)
+    {
+      const std::size_t w = simd::width;
+      std::size_t i = 0;
+
+      if (a_nStride==1)
+      {
+        for (; i+w<=n; i+=w)
+        {
+          const vec_type v = simd::Load(a_pVal + i);
+          simd::Store(a_pVar + i, v);
+          simd::Store(a_pRes + i, v);
+        }
+
+        for (; i<n; ++i)
+          a_pRes[i] = a_pVar[i] = a_pVal[i];
+      }
+      else
+      {
+        for (; i+w<=n; i+=w)
+          simd::Store(a_pRes + i, simd::Load(a_pVal + i));
+
+        for (; i<n; ++i)
+          a_pRes[i] = a_pVal[i];
+
+        if (a_nStride==0)
+        {
+          if (n)
+            *a_pVar = a_pVal[n-1];
+        }
+        else
+        {
+          for (i=0; i<n; ++i)
+            a_pVar[i*a_nStride] = a_pVal[i];
+        }
+      }
+    }
+
+    //---------------------------------------------------------------------------------------------
+    #define MUP_SIMD_BINARY_KERNEL(NAME, OP)                          \
+    static void NAME(T *out, const T *a, const T *b, std::size_t n)   \
+    {                                                                 \
+      const std::size_t w = simd::width;                              \
+      std::size_t i = 0;                                              \
+      for (; i+w<=n; i+=w)                                            \
+        simd::Store(out + i, simd::NAME(simd::Load(a + i), simd::Load(b + i))); \
+                                                                      \
+      for (; i<n; ++i)                                                \
+        out[i] = a[i] OP b[i];                                        \
+    }
+
+    /** \brief out[i] = a[i] + b[i] */
+    MUP_SIMD_BINARY_KERNEL(Add, +)
+
+    /** \brief out[i] = a[i] - b[i] */
+    MUP_SIMD_BINARY_KERNEL(Sub, -)
+
+    /** \brief out[i] = a[i] * b[i] */
+    MUP_SIMD_BINARY_KERNEL(Mul, *)
+
+    /** \brief out[i] = a[i] / b[i] */
+    MUP_SIMD_BINARY_KERNEL(Div, /)
+
+    #undef MUP_SIMD_BINARY_KERNEL
+  };
+
+MUP_NAMESPACE_END
+
+#endif
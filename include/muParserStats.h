@@ -0,0 +1,436 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_STATS_H
+#define MU_PARSER_STATS_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <map>
+#include <string>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+  #define MUP_HAS_TSC
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #include <x86intrin.h>
+  #define MUP_HAS_TSC
+#endif
+
+#include "muParserDef.h"
+
+/** \file
+    \brief Runtime statistics of the expressions evaluated by parsers.
+*/
+
+MUP_NAMESPACE_START
+
+  namespace details
+  {
+    //---------------------------------------------------------------------------------------------
+    inline const char* GetEngineName(EEngine a_eEngine)
+    {
+      static const char *szName[enCOUNT] =
+      {
+        "ParseString", "ParseCmdCode", "ParseRegCode", "ParseJit", "SpecializedExpr", "PrecompiledExpr"
+      };
+
+      return (a_eEngine>=0 && a_eEngine<enCOUNT) ? szName[a_eEngine] : "unknown";
+    }
+
+    //---------------------------------------------------------------------------------------------
+    inline const char* GetEngineFallbackName(EEngineFallback a_eFallback)
+    {
+      static const char *szName[efCOUNT] =
+      {
+        "none", "leading_function", "assignment", "too_long", "multiple_results", "shape"
+      };
+
+      return (a_eFallback>=0 && a_eFallback<efCOUNT) ? szName[a_eFallback] : "unknown";
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Write a string as JSON string, characters outside ASCII are escaped. */
+    template<typename TString>
+    void WriteJsonString(std::ostream &a_Out, const TString &a_sVal)
+    {
+      a_Out << '"';
+      for (std::size_t i=0; i<a_sVal.size(); ++i)
+      {
+        const unsigned long c = (unsigned long)(typename std::make_unsigned<typename TString::value_type>::type)a_sVal[i];
+        if (c=='"' || c=='\\')
+        {
+          a_Out << '\\' << (char)c;
+        }
+        else if (c>=0x20 && c<0x7f)
+        {
+          a_Out << (char)c;
+        }
+        else
+        {
+          char szBuf[16];
+          if (c>0xffff)
+          {
+            // UTF-16 surrogate pair
+            const unsigned long u = c - 0x10000;
+            std::snprintf(szBuf, sizeof(szBuf), "\\u%04lx\\u%04lx", 0xd800 + (u >> 10), 0xdc00 + (u & 0x3ff));
+          }
+          else
+          {
+            std::snprintf(szBuf, sizeof(szBuf), "\\u%04lx", c);
+          }
+
+          a_Out << szBuf;
+        }
+      }
+
+      a_Out << '"';
+    }
+  }
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Registry collecting runtime statistics of expressions.
+
+    A parser with a registry attached by ParserBase::SetStatsRegistry records for every
+    expression it compiles the number and duration of the compilations, the engine chosen
+    and the reason if no precompiled engine exists. Every Eval is counted together with the
+    cycles it took. Parsers without a registry do not pay anything for this.
+
+    The statistics are kept per thread, each thread only updates its own records. GetJson may
+    be called at any time by any thread, it does not block evaluations. Expressions are
+    identified by their text, the statistics of parsers evaluating the same text are merged.
+
+    Cycles are read from the time stamp counter on x86, on other targets they are nanoseconds
+    of std::chrono::steady_clock.
+  */
+  template<typename TString>
+  class ParserStatsRegistry
+  {
+  public:
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Statistics of an expression evaluated by a single thread.
+
+        Only the thread Thread writes the counters, readers may load them at any time.
+      */
+      struct SExprStats
+      {
+        std::thread::id Thread;
+        std::atomic<std::uint64_t> Evals;
+        std::atomic<std::uint64_t> Cycles;
+        std::atomic<std::uint64_t> Compiles;
+        std::atomic<std::uint64_t> CompileCycles;
+        std::atomic<int> Engine;      ///< EEngine of the last compilation
+        std::atomic<int> EngineID;    ///< Precompiled engine ID of the last compilation or -1
+        std::atomic<int> Fallback;    ///< EEngineFallback of the last compilation
+      };
+
+      //-------------------------------------------------------------------------------------------
+      ParserStatsRegistry()
+        :m_Mutex()
+        ,m_vThread()
+        ,m_nSerial(NextSerial())
+      {}
+
+      ParserStatsRegistry(const ParserStatsRegistry&) = delete;
+      ParserStatsRegistry& operator=(const ParserStatsRegistry&) = delete;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns a registry shared by the whole process. */
+      static ParserStatsRegistry& Instance()
+      {
+        static ParserStatsRegistry s_Registry;
+        return s_Registry;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the current value of the cycle counter. */
+      static std::uint64_t ReadCycles()
+      {
+  #if defined(MUP_HAS_TSC)
+        return __rdtsc();
+  #else
+        return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+  #endif
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the statistics of an expression for the calling thread.
+
+        The record is created if needed, it stays valid for the lifetime of the registry.
+      */
+      SExprStats* Acquire(const TString &a_sExpr)
+      {
+        SThread &thread = GetThread();
+
+        std::lock_guard<std::mutex> lock(thread.Mutex);
+        std::unique_ptr<SExprStats> &pStats = thread.Expr[a_sExpr];
+        if (!pStats)
+        {
+          pStats.reset(new SExprStats());
+          pStats->Thread = thread.Id;
+          pStats->Evals.store(0, std::memory_order_relaxed);
+          pStats->Cycles.store(0, std::memory_order_relaxed);
+          pStats->Compiles.store(0, std::memory_order_relaxed);
+          pStats->CompileCycles.store(0, std::memory_order_relaxed);
+          pStats->Engine.store(enPARSE_STRING, std::memory_order_relaxed);
+          pStats->EngineID.store(-1, std::memory_order_relaxed);
+          pStats->Fallback.store(efNONE, std::memory_order_relaxed);
+        }
+
+        return pStats.get();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Count an evaluation, must be called by the thread owning the record. */
+      static void RecordEval(SExprStats &a_Stats, std::uint64_t a_nCycles)
+      {
+        Add(a_Stats.Evals, 1);
+        Add(a_Stats.Cycles, a_nCycles);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Store the engine of an expression, must be called by the thread owning the record. */
+      static void RecordEngine(SExprStats &a_Stats, EEngine a_eEngine, int a_nEngineID, EEngineFallback a_eFallback)
+      {
+        a_Stats.Engine.store(a_eEngine, std::memory_order_relaxed);
+        a_Stats.EngineID.store(a_nEngineID, std::memory_order_relaxed);
+        a_Stats.Fallback.store(a_eFallback, std::memory_order_relaxed);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Count a compilation, must be called by the thread owning the record. */
+      static void RecordCompile(SExprStats &a_Stats, std::uint64_t a_nCycles)
+      {
+        Add(a_Stats.Compiles, 1);
+        Add(a_Stats.CompileCycles, a_nCycles);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Set all counters to zero.
+
+        Counters updated concurrently may keep a part of their increments.
+      */
+      void Reset()
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (std::size_t i=0; i<m_vThread.size(); ++i)
+        {
+          std::lock_guard<std::mutex> lockThread(m_vThread[i]->Mutex);
+          for (auto item = m_vThread[i]->Expr.begin(); item!=m_vThread[i]->Expr.end(); ++item)
+          {
+            SExprStats &stats = *item->second;
+            stats.Evals.store(0, std::memory_order_relaxed);
+            stats.Cycles.store(0, std::memory_order_relaxed);
+            stats.Compiles.store(0, std::memory_order_relaxed);
+            stats.CompileCycles.store(0, std::memory_order_relaxed);
+          }
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the statistics as JSON.
+
+        Expressions are sorted by their total cycles, each one lists the counters summed over
+        all threads followed by the counters of the individual threads. Engine, engine ID and
+        fallback reason are taken from the thread that compiled the expression last.
+      */
+      std::string GetJson() const
+      {
+        struct SThreadCounters
+        {
+          unsigned Thread;
+          std::uint64_t Evals, Cycles, Compiles, CompileCycles;
+        };
+
+        struct SExprSummary
+        {
+          std::uint64_t Evals = 0, Cycles = 0, Compiles = 0, CompileCycles = 0;
+          int Engine = enPARSE_STRING, EngineID = -1, Fallback = efNONE;
+          std::vector<SThreadCounters> Threads;
+        };
+
+        std::map<TString, SExprSummary> mapExpr;
+        std::size_t nThreads = 0;
+
+        {
+          std::lock_guard<std::mutex> lock(m_Mutex);
+          nThreads = m_vThread.size();
+          for (std::size_t i=0; i<m_vThread.size(); ++i)
+          {
+            std::lock_guard<std::mutex> lockThread(m_vThread[i]->Mutex);
+            for (auto item = m_vThread[i]->Expr.begin(); item!=m_vThread[i]->Expr.end(); ++item)
+            {
+              const SExprStats &stats = *item->second;
+              SThreadCounters counters = { (unsigned)i,
+                                           stats.Evals.load(std::memory_order_relaxed),
+                                           stats.Cycles.load(std::memory_order_relaxed),
+                                           stats.Compiles.load(std::memory_order_relaxed),
+                                           stats.CompileCycles.load(std::memory_order_relaxed) };
+
+              SExprSummary &summary = mapExpr[item->first];
+              summary.Evals += counters.Evals;
+              summary.Cycles += counters.Cycles;
+              summary.Compiles += counters.Compiles;
+              summary.CompileCycles += counters.CompileCycles;
+              if (counters.Compiles!=0 || summary.Engine==enPARSE_STRING)
+              {
+                summary.Engine = stats.Engine.load(std::memory_order_relaxed);
+                summary.EngineID = stats.EngineID.load(std::memory_order_relaxed);
+                summary.Fallback = stats.Fallback.load(std::memory_order_relaxed);
+              }
+
+              summary.Threads.push_back(counters);
+            }
+          }
+        }
+
+        std::vector<std::pair<const TString*, const SExprSummary*> > vExpr;
+        for (auto item = mapExpr.begin(); item!=mapExpr.end(); ++item)
+          vExpr.push_back(std::make_pair(&item->first, &item->second));
+
+        std::stable_sort(vExpr.begin(), vExpr.end(),
+                         [](const std::pair<const TString*, const SExprSummary*> &a,
+                            const std::pair<const TString*, const SExprSummary*> &b)
+                         {
+                           return a.second->Cycles > b.second->Cycles;
+                         });
+
+        std::ostringstream ss;
+        ss << "{\n"
+           << "  \"cycle_source\": \"" << GetCycleSource() << "\",\n"
+           << "  \"threads\": " << nThreads << ",\n"
+           << "  \"expressions\": [";
+
+        for (std::size_t i=0; i<vExpr.size(); ++i)
+        {
+          const SExprSummary &summary = *vExpr[i].second;
+          ss << ((i==0) ? "\n" : ",\n")
+             << "    { \"expr\": ";
+          details::WriteJsonString(ss, *vExpr[i].first);
+          ss << ", \"evals\": " << summary.Evals
+             << ", \"cycles\": " << summary.Cycles
+             << ", \"cycles_per_eval\": " << ((summary.Evals) ? summary.Cycles / summary.Evals : 0)
+             << ", \"compiles\": " << summary.Compiles
+             << ", \"compile_cycles\": " << summary.CompileCycles
+             << ", \"engine\": \"" << details::GetEngineName((EEngine)summary.Engine) << "\""
+             << ", \"engine_id\": " << summary.EngineID
+             << ", \"fallback\": \"" << details::GetEngineFallbackName((EEngineFallback)summary.Fallback) << "\""
+             << ", \"threads\": [";
+
+          for (std::size_t t=0; t<summary.Threads.size(); ++t)
+          {
+            const SThreadCounters &counters = summary.Threads[t];
+            ss << ((t==0) ? " " : ", ")
+               << "{ \"thread\": " << counters.Thread
+               << ", \"evals\": " << counters.Evals
+               << ", \"cycles\": " << counters.Cycles
+               << ", \"compiles\": " << counters.Compiles
+               << ", \"compile_cycles\": " << counters.CompileCycles << " }";
+          }
+
+          ss << " ] }";
+        }
+
+        ss << "\n  ]\n}\n";
+        return ss.str();
+      }
+
+  private:
+
+      /** \brief Records of a thread, the map is modified by its thread only. */
+      struct SThread
+      {
+        std::thread::id Id;
+        mutable std::mutex Mutex;   ///< Protects the map against concurrent readers
+        std::map<TString, std::unique_ptr<SExprStats> > Expr;
+      };
+
+      //-------------------------------------------------------------------------------------------
+      static const char* GetCycleSource()
+      {
+  #if defined(MUP_HAS_TSC)
+        return "tsc";
+  #else
+        return "steady_clock_ns";
+  #endif
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Increment a counter written by a single thread without a locked instruction. */
+      static void Add(std::atomic<std::uint64_t> &a_nCounter, std::uint64_t a_nVal)
+      {
+        a_nCounter.store(a_nCounter.load(std::memory_order_relaxed) + a_nVal, std::memory_order_relaxed);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      static std::uint64_t NextSerial()
+      {
+        static std::atomic<std::uint64_t> s_nSerial(0);
+        return ++s_nSerial;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the records of the calling thread, creates them if needed.
+
+        Each thread caches its records per registry. The cache is keyed by a serial number
+        since a new registry may reuse the address of a destroyed one.
+      */
+      SThread& GetThread()
+      {
+        thread_local std::vector<std::pair<std::uint64_t, SThread*> > t_vCache;
+        for (std::size_t i=0; i<t_vCache.size(); ++i)
+        {
+          if (t_vCache[i].first==m_nSerial)
+            return *t_vCache[i].second;
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_vThread.push_back(std::unique_ptr<SThread>(new SThread()));
+        SThread *pThread = m_vThread.back().get();
+        pThread->Id = std::this_thread::get_id();
+
+        t_vCache.push_back(std::make_pair(m_nSerial, pThread));
+        return *pThread;
+      }
+
+      mutable std::mutex m_Mutex;                    ///< Protects the thread list
+      std::vector<std::unique_ptr<SThread> > m_vThread;
+      const std::uint64_t m_nSerial;                 ///< Identifies the registry in the thread caches
+  };
+
+MUP_NAMESPACE_END
+
+#endif
@@ -0,0 +1,290 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_SYMBOL_TABLE_H
+#define MU_PARSER_SYMBOL_TABLE_H
+
+#include <vector>
+#include <map>
+#include <string>
+#include <algorithm>
+
+#include "muParserDef.h"
+
+/** \file
+    \brief Lookup structures used by the token reader for the symbols defined in a parser.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Hash index over the entries of a symbol map.
+
+    The index refers to the entries of the map and can look up names given as a pointer and a
+    length, so the token reader does not need to create a string for each lookup. It is an 
+    open addressing table with linear probing kept at most half full, the cost of a lookup 
+    does not depend on the number of symbols.
+
+    The index must be rebuilt once entries are erased from the map.
+  */
+  template<typename TString, typename TMapped>
+  class ParserSymbolIndex
+  {
+  public:
+
+      typedef typename TString::value_type char_type;
+      typedef std::map<TString, TMapped> map_type;
+      typedef typename map_type::value_type entry_type;
+
+      //-------------------------------------------------------------------------------------------
+      ParserSymbolIndex()
+        :m_vSlot()
+        ,m_nSize(0)
+      {}
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Index all entries of a map. */
+      void Build(const map_type &a_Map)
+      {
+        std::size_t nCapacity = 8;
+        while (nCapacity < a_Map.size()*2)
+          nCapacity *= 2;
+
+        m_vSlot.assign(nCapacity, SSlot());
+        m_nSize = 0;
+
+        for (auto item = a_Map.begin(); item!=a_Map.end(); ++item)
+          Insert(&*item);
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Add an entry that has been inserted into the map after the index was built. */
+      void Insert(const entry_type *a_pEntry)
+      {
+        if ((m_nSize + 1)*2 > m_vSlot.size())
+          Grow();
+
+        const TString &sName = a_pEntry->first;
+        const std::size_t nHash = Hash(sName.data(), sName.length());
+
+        SSlot &slot = m_vSlot[FindSlot(sName.data(), sName.length(), nHash)];
+        if (slot.Entry==nullptr)
+          ++m_nSize;
+
+        slot.Hash = nHash;
+        slot.Entry = a_pEntry;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the entry named by the a_nLen characters at a_szName or nullptr. */
+      const entry_type* Find(const char_type *a_szName, std::size_t a_nLen) const
+      {
+        if (m_nSize==0)
+          return nullptr;
+
+        return m_vSlot[FindSlot(a_szName, a_nLen, Hash(a_szName, a_nLen))].Entry;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      std::size_t GetSize() const
+      {
+        return m_nSize;
+      }
+
+  private:
+
+      struct SSlot
+      {
+        SSlot()
+          :Hash(0)
+          ,Entry(nullptr)
+        {}
+
+        std::size_t Hash;
+        const entry_type *Entry;   ///< nullptr for empty slots
+      };
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief FNV-1a hash of a name. */
+      static std::size_t Hash(const char_type *a_szName, std::size_t a_nLen)
+      {
+        std::size_t nHash = (std::size_t)14695981039346656037ULL;
+        for (std::size_t i=0; i<a_nLen; ++i)
+        {
+          nHash ^= (std::size_t)a_szName[i];
+          nHash *= (std::size_t)1099511628211ULL;
+        }
+
+        return nHash;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the slot of a name or the empty slot where it would be inserted. */
+      std::size_t FindSlot(const char_type *a_szName, std::size_t a_nLen, std::size_t a_nHash) const
+      {
+        const std::size_t nMask = m_vSlot.size() - 1;
+        for (std::size_t i = a_nHash & nMask; ; i = (i + 1) & nMask)
+        {
+          const SSlot &slot = m_vSlot[i];
+          if (slot.Entry==nullptr)
+            return i;
+
+          const TString &sName = slot.Entry->first;
+          if ( slot.Hash==a_nHash && 
+               sName.length()==a_nLen && 
+               std::char_traits<char_type>::compare(sName.data(), a_szName, a_nLen)==0 )
+          {
+            return i;
+          }
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void Grow()
+      {
+        std::vector<SSlot> vOld;
+        vOld.swap(m_vSlot);
+        m_vSlot.assign(std::max<std::size_t>(8, vOld.size()*2), SSlot());
+
+        for (std::size_t i=0; i<vOld.size(); ++i)
+        {
+          if (vOld[i].Entry!=nullptr)
+          {
+            const TString &sName = vOld[i].Entry->first;
+            m_vSlot[FindSlot(sName.data(), sName.length(), vOld[i].Hash)] = vOld[i];
+          }
+        }
+      }
+
+      std::vector<SSlot> m_vSlot;   ///< The table, its size is a power of two
+      std::size_t m_nSize;          ///< Number of used slots
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Trie over the names of a symbol map for finding the longest name at a position.
+
+    Operators may be written without separating blanks, so the reader has to find the longest
+    operator name the remaining formula starts with. The trie finds it in a single pass over
+    the characters. Nodes are stored in a vector, the children of a node form a linked list.
+  */
+  template<typename TString, typename TMapped>
+  class ParserSymbolTrie
+  {
+  public:
+
+      typedef typename TString::value_type char_type;
+      typedef std::map<TString, TMapped> map_type;
+      typedef typename map_type::value_type entry_type;
+
+      //-------------------------------------------------------------------------------------------
+      ParserSymbolTrie()
+        :m_vNode(1)
+      {}
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Create the trie for all names of a map. */
+      void Build(const map_type &a_Map)
+      {
+        m_vNode.assign(1, SNode());
+
+        for (auto item = a_Map.begin(); item!=a_Map.end(); ++item)
+        {
+          const TString &sName = item->first;
+
+          int iNode = 0;
+          for (std::size_t i=0; i<sName.length(); ++i)
+          {
+            int iChild = FindChild(iNode, sName[i]);
+            if (iChild<0)
+            {
+              SNode node;
+              node.Char = sName[i];
+              node.Next = m_vNode[iNode].Child;
+              iChild = (int)m_vNode.size();
+              m_vNode[iNode].Child = iChild;
+              m_vNode.push_back(node);
+            }
+
+            iNode = iChild;
+          }
+
+          m_vNode[iNode].Entry = &*item;
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the entry with the longest name that is a prefix of the a_nLen 
+                 characters at a_szExpr or nullptr if there is none.
+      */
+      const entry_type* Match(const char_type *a_szExpr, std::size_t a_nLen) const
+      {
+        const entry_type *pMatch = nullptr;
+
+        int iNode = 0;
+        for (std::size_t i=0; i<a_nLen; ++i)
+        {
+          iNode = FindChild(iNode, a_szExpr[i]);
+          if (iNode<0)
+            break;
+
+          if (m_vNode[iNode].Entry!=nullptr)
+            pMatch = m_vNode[iNode].Entry;
+        }
+
+        return pMatch;
+      }
+
+  private:
+
+      struct SNode
+      {
+        SNode()
+          :Char(0)
+          ,Child(-1)
+          ,Next(-1)
+          ,Entry(nullptr)
+        {}
+
+        char_type Char;
+        int Child;                 ///< First child or -1
+        int Next;                  ///< Next sibling or -1
+        const entry_type *Entry;   ///< Symbol ending at this node or nullptr
+      };
+
+      //-------------------------------------------------------------------------------------------
+      int FindChild(int a_iNode, char_type a_cChar) const
+      {
+        int iChild = m_vNode[a_iNode].Child;
+        while (iChild>=0 && m_vNode[iChild].Char!=a_cChar)
+          iChild = m_vNode[iChild].Next;
+
+        return iChild;
+      }
+
+      std::vector<SNode> m_vNode;   ///< Node 0 is the root
+  };
+
+MUP_NAMESPACE_END
+
+#endif
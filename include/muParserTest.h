@@ -4,8 +4,14 @@
 #include <string>
 //#include <cstdlib>
 #include <numeric> // for accumulate
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <cstdio>
 #include <limits>
+#include <thread>
 #include "muParser.h"
+#include "muParserCatalogue.h"
 
 
 MUP_NAMESPACE_START
@@ -40,6 +46,12 @@ MUP_NAMESPACE_START
         arg[0] = (arg[0]>arg[1]) ? arg[0] : arg[1];
       }
 
+      static void VecMax(TValue *const *arg, TValue *out, int /*argc*/, std::size_t n)
+      {
+        for (std::size_t i=0; i<n; ++i)
+          out[i] = (arg[0][i]>arg[1][i]) ? arg[0][i] : arg[1][i];
+      }
+
       static void plus2(TValue* arg, int /*argc*/)
       { 
         arg[0] += 2;
@@ -79,11 +91,38 @@ MUP_NAMESPACE_START
         arg[0] = 10;
       }
 
+      // callback returning the number of previous calls
+      static TValue& Calls()
+      {
+        static TValue s_nCalls = 0;
+        return s_nCalls;
+      }
+
+      static void Count(TValue *arg, int)
+      {
+        arg[0] = Calls()++;
+      }
+
       // postfix operator callback
       static void Mega(TValue *arg , int) { arg[0] *= (TValue)1e6;  }
       static void Micro(TValue *arg, int) { arg[0] *= (TValue)1e-6; }
       static void Milli(TValue *arg, int) { arg[0] *= (TValue)1e-3; }
 
+      // variable factory, creates variables with the value 1 in a deque passed as user data
+      static TValue* AddVariable(const typename TString::value_type*, void *pUserData)
+      {
+        std::deque<TValue> *pVars = static_cast<std::deque<TValue>*>(pUserData);
+        pVars->push_back(1);
+        return &pVars->back();
+      }
+
+      // value recognition that never matches, counts how often the parser reads a token
+      static int CountTokens(const typename TString::value_type*, int*, TValue*)
+      {
+        ++Calls();
+        return 0;
+      }
+
       // Custom value recognition
 
       //-----------------------------------------------------------------------------------------
@@ -109,40 +148,895 @@ MUP_NAMESPACE_START
       }
 
       //---------------------------------------------------------------------------------------------
-      int TestInterface()
+      int TestInterface()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing member functions...");
+   
+        // Test RemoveVar
+        TValue afVal[3] = {1,2,3};
+        Parser<TValue, TString> p;
+  
+        try
+        {
+          p.DefineVar(_SL("a"), &afVal[0]);
+          p.DefineVar(_SL("b"), &afVal[1]);
+          p.DefineVar(_SL("c"), &afVal[2]);
+          p.SetExpr(_SL("a+b+c"));
+          p.Eval();
+        }
+        catch(...)
+        {
+          iStat += 1;  // this is not supposed to happen 
+        }
+
+        try
+        {
+          p.RemoveVar( _SL("c") );
+          p.Eval();
+          iStat += 1;  // not supposed to reach this, nonexisting variable "c" deleted...
+        }
+        catch(...)
+        {
+          // failure is expected...
+        }
+
+        if (iStat==0) 
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestSymbolTable()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing symbol lookup...");
+
+        try
+        {
+          std::vector<TValue> vVal(2000);
+          Parser<TValue, TString> p;
+          for (std::size_t i=0; i<vVal.size(); ++i)
+          {
+            stringstream_type ss;
+            ss << _SL("v") << i;
+            vVal[i] = (TValue)i;
+            p.DefineVar(ss.str(), &vVal[i]);
+          }
+
+          p.SetExpr(_SL("v0+v1999*2+v1234-v12"));
+          if (p.Eval()!=5220)
+            iStat += 1;
+
+          // symbols defined after an expression was parsed
+          p.DefineConst(_SL("k"), 10);
+          p.DefineFun(_SL("max2"), Max, 2);
+          p.DefinePostfixOprt(_SL("m"), Milli);
+          p.DefinePostfixOprt(_SL("mm"), Mega);
+          p.SetExpr(_SL("k*max2(v1,v2)+1mm"));
+          if (p.Eval()!=1000020)
+            iStat += 1;
+
+          p.RemoveVar(_SL("v2"));
+          p.DefineVar(_SL("v20"), &vVal[3]);
+          p.SetExpr(_SL("v20+1m*1000"));
+          if (p.Eval()!=4)
+            iStat += 1;
+
+          // a copy of the parser uses its own symbols
+          Parser<TValue, TString> q(p);
+          p.ClearVar();
+          q.SetExpr(_SL("v1+v20"));
+          if (q.Eval()!=4)
+            iStat += 1;
+
+          // variables created by the factory are found when used a second time
+          std::deque<TValue> vNew;
+          p.SetVarFactory(AddVariable, &vNew);
+          p.SetExpr(_SL("x=3,x*2+y"));
+          if (p.Eval()!=7 || vNew.size()!=2)
+            iStat += 1;
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestNumLiterals()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing numeric literals...");
+
+        try
+        {
+          Parser<TValue, TString> p;
+
+          // values printed with enough digits must be read back exactly
+          const TValue fVal[] = { (TValue)0.1, (TValue)1/3, (TValue)2/3*1e-30, (TValue)123456.789e20, 
+                                  std::numeric_limits<TValue>::max(), std::numeric_limits<TValue>::min(),
+                                  std::numeric_limits<TValue>::denorm_min(), std::numeric_limits<TValue>::epsilon() };
+          for (std::size_t i=0; i<sizeof(fVal)/sizeof(fVal[0]); ++i)
+          {
+            stringstream_type ss;
+            ss.precision(std::numeric_limits<TValue>::max_digits10);
+            ss << fVal[i];
+            p.SetExpr(ss.str());
+            if (p.Eval()!=fVal[i])
+            {
+              _OUT << _SL("\n  ") << ss.str() << _SL(" was not read back exactly");
+              iStat += 1;
+            }
+          }
+
+          // literal forms
+          const TString sExpr[] = { _SL("1.5e3"), _SL(".25e+1"), _SL("5."), _SL("000012.5000"), _SL("12345678901234567890123e-21") };
+          const TValue fRes[] = { 1500, (TValue)2.5, 5, (TValue)12.5, (TValue)12.345678901234567890123 };
+          for (std::size_t i=0; i<sizeof(sExpr)/sizeof(sExpr[0]); ++i)
+          {
+            p.SetExpr(sExpr[i]);
+            if (p.Eval()!=fRes[i])
+              iStat += 1;
+          }
+
+          // integer parser, decimal literals must fit into the value type
+          Parser<int, TString> q;
+          q.SetExpr(_SL("0x1F+#101+2147483647-2147483640"));
+          if (q.Eval()!=43)
+            iStat += 1;
+
+          try
+          {
+            q.SetExpr(_SL("2147483648"));
+            q.Eval();
+            iStat += 1;
+          }
+          catch(ParserError<TString>&)
+          {
+            // overflow is expected
+          }
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestRebind()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing variable rebinding...");
+
+        for (int iOpt=0; iOpt<2; ++iOpt)
+        {
+          try
+          {
+            TValue a1 = 2, a2 = 5, b = 3, b2 = 7, fRes = 0;
+            std::vector<TValue> vA(3*MUP_BULK_SIZE), vRes(vA.size());
+            for (std::size_t i=0; i<vA.size(); ++i)
+              vA[i] = (TValue)i;
+
+            Parser<TValue, TString> p;
+            p.EnableOptimizer(iOpt==1);
+            p.AddValIdent(CountTokens);
+            p.DefineVar(_SL("a"), &a1);
+            p.DefineVar(_SL("b"), &b);
+            p.DefineVar(_SL("x"), &b2);
+            p.DefineConst(_SL("k"), 10);
+            p.SetExpr(_SL("a*b+a-1"));
+            p.Eval();
+
+            // moving a variable or changing unused symbols must not parse the expression again
+            TValue nCalls = Calls();
+            p.DefineVar(_SL("a"), &a2);
+            if (p.Eval()!=19)
+              iStat += 1;
+
+            p.DefineConst(_SL("k"), 20);
+            p.RemoveVar(_SL("x"));
+            if (p.Eval()!=19 || Calls()!=nCalls)
+              iStat += 1;
+
+            // columns for the bulk evaluation
+            p.DefineVar(_SL("a"), &vA[0], 1);
+            p.Eval(&vRes[0], vRes.size());
+            for (std::size_t i=0; i<vRes.size(); ++i)
+              iStat += (vRes[i]!=vA[i]*b+vA[i]-1);
+
+            p.DefineVar(_SL("a"), &a1);
+            if (p.Eval()!=7 || Calls()!=nCalls)
+              iStat += 1;
+
+            // used constants are folded, changing them needs a new parse
+            p.SetExpr(_SL("b*k"));
+            if (p.Eval()!=60)
+              iStat += 1;
+
+            p.DefineConst(_SL("k"), 2);
+            if (p.Eval()!=6)
+              iStat += 1;
+
+            // variables sharing an address can not be told apart in the bytecode
+            p.DefineVar(_SL("c"), &b);
+            p.SetExpr(_SL("b*10+c"));
+            p.Eval();
+            p.DefineVar(_SL("b"), &b2);
+            if (p.Eval()!=73)
+              iStat += 1;
+
+            // assignment targets
+            p.SetExpr(_SL("a=b*2"));
+            p.Eval();
+            nCalls = Calls();
+            p.DefineVar(_SL("a"), &fRes);
+            if (p.Eval()!=14 || fRes!=14 || a1!=14 || Calls()!=nCalls)
+              iStat += 1;
+          }
+          catch(ParserError<TString> &e)
+          {
+            _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+            iStat += 1;
+          }
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestEvalStack()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing evaluation with a caller stack...");
+
+        const TString sExpr[] = { _SL("a+b"), 
+                                  _SL("a*b+sin(a)-(b/a+1)*2"), 
+                                  _SL("(a+(b+(a+(b+(a+(b+(a+b)))))))*2"), 
+                                  _SL("c=a*2, c+b") };
+
+        for (int iOpt=0; iOpt<2; ++iOpt)
+        {
+          for (std::size_t i=0; i<sizeof(sExpr)/sizeof(sExpr[0]); ++i)
+          {
+            try
+            {
+              TValue a = 2, b = 3, c = 0;
+              Parser<TValue, TString> p;
+              p.EnableOptimizer(iOpt==1);
+              p.DefineVar(_SL("a"), &a);
+              p.DefineVar(_SL("b"), &b);
+              p.DefineVar(_SL("c"), &c);
+              p.SetExpr(sExpr[i]);
+
+              std::vector<TValue> vStack(p.GetMaxStackSize(), -999);
+              TValue fRes = p.Eval();
+
+              // the parser must not use its own stack, results must not depend on the stack
+              Parser<TValue, TString> p2(p);
+              if (p.EvalWithStack(vStack.data(), vStack.size())!=fRes || p2.EvalWithStack(vStack.data(), vStack.size())!=fRes)
+                iStat += 1;
+
+              a = 5;
+              fRes = p.Eval();
+              if (p.EvalWithStack(vStack.data(), vStack.size())!=fRes || p.Eval()!=fRes)
+                iStat += 1;
+
+              try
+              {
+                p.EvalWithStack(vStack.data(), vStack.size() - 1);
+                iStat += 1;
+              }
+              catch(ParserError<TString> &e)
+              {
+                iStat += (e.GetCode()==ecSTACK_TOO_SMALL) ? 0 : 1;
+              }
+
+              if (p.Eval()!=fRes)
+                iStat += 1;
+            }
+            catch(ParserError<TString> &e)
+            {
+              _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+              iStat += 1;
+            }
+          }
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestCompiledExpr()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing compiled expressions...");
+
+        iStat += CompiledExprTest(_SL("a"));
+        iStat += CompiledExprTest(_SL("a*b+c"));
+        iStat += CompiledExprTest(_SL("a+(b+c)*(a-b/c)+b^3*a-(2*a+1)*3"));
+        iStat += CompiledExprTest(_SL("sum(a,b,c,1)*min(a,b)+ping()"));
+        iStat += CompiledExprTest(_SL("a,b,a*b*c"));
+        iStat += CompiledExprTest(_SL("(d=a*b)*2+d"));
+
+        // Contexts with different bindings of the same expression
+        try
+        {
+          TValue a1 = 1, a2 = 2, b = 3;
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a1);
+          p.DefineVar(_SL("b"), &b);
+          p.SetExpr(_SL("a*b+a"));
+          CompiledExpression<TValue, TString> expr = p.Compile();
+
+          typename CompiledExpression<TValue, TString>::Context ctx1(expr), ctx2(expr);
+          ctx2.Bind(_SL("a"), &a2);
+          if (expr.Eval(ctx1)!=4 || expr.Eval(ctx2)!=8)
+            iStat += 1;
+
+          // the compiled expression must not depend on the parser
+          p.SetExpr(_SL("0"));
+          if (expr.Eval(ctx2)!=8)
+            iStat += 1;
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestBulkEval()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing bulk evaluation...");
+
+        iStat += BulkTest(_SL("a"));
+        iStat += BulkTest(_SL("2"));
+        iStat += BulkTest(_SL("a*b+c"));
+        iStat += BulkTest(_SL("a/(a+3)-(b-c)/c*2"));
+        iStat += BulkTest(_SL("sin(a)+cos(b)*c"));
+        iStat += BulkTest(_SL("(a<b)*c+(a>=b)*(c-1)"));
+        iStat += BulkTest(_SL("sum(a,b,c,1)*min(a,b)"));
+        iStat += BulkTest(_SL("max2(a,b)*sqrt(c)-max2(1,a)"));
+        iStat += BulkTest(_SL("-sin(a)^2+(a!=b)||(c==3)"));
+        iStat += BulkTest(_SL("1+ping()*a"));
+        iStat += BulkTest(_SL("-a{m}+b^2"));
+        iStat += BulkTest(_SL("a,b,a*b*c"));
+        iStat += BulkTest(_SL("d=a+b"));
+        iStat += BulkTest(_SL("(d=a*b)*2+d"));
+        iStat += BulkTest(_SL("a+(b+c)*(a-b/c)+b^3*a-(2*a+1)*3"));
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestParallelEval()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing parallel evaluation...");
+
+        iStat += ParallelTest(_SL("a*b+c"));
+        iStat += ParallelTest(_SL("sin(a)+cos(b)*c"));
+        iStat += ParallelTest(_SL("max2(a,b)*sqrt(c)-min(a,b)"));
+        iStat += ParallelTest(_SL("a,b,a*b*c"));
+        iStat += ParallelTest(_SL("(d=a*b)*2+d"));
+        iStat += ParallelTest(_SL("c=a+b"));
+
+        // every task is executed exactly once, exceptions are passed to the caller
+        {
+          ParserThreadPool pool(4);
+          std::vector<int> vCalls(1000);
+          pool.Run(vCalls.size(), [&](std::size_t nTask, unsigned){ vCalls[nTask] += 1; });
+          if (std::count(vCalls.begin(), vCalls.end(), 1)!=(int)vCalls.size())
+            iStat += 1;
+
+          try
+          {
+            pool.Run(100, [](std::size_t nTask, unsigned){ if (nTask==50) throw std::runtime_error("task failed"); });
+            iStat += 1;
+          }
+          catch(std::runtime_error&)
+          {}
+        }
+
+        // callbacks without a vectorized version are called in row order if requested
+        try
+        {
+          const std::size_t nRows = 100000;
+          std::vector<TValue> vA(nRows), vRes(nRows);
+          for (std::size_t i=0; i<nRows; ++i)
+            vA[i] = (TValue)(i % 5);
+
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &vA[0], 1);
+          p.DefineFun(_SL("count"), Count, 0);
+          p.SetExpr(_SL("a+count()"));
+
+          Calls() = 0;
+          p.EvalParallel(&vRes[0], nRows, true);
+          for (std::size_t i=0; i<nRows; ++i)
+          {
+            if (vRes[i]!=vA[i] + (TValue)i)
+            {
+              iStat += 1;
+              break;
+            }
+          }
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestExprCache()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing expression cache...");
+
+        try
+        {
+          ParserExprCache<TValue, TString> cache(16);
+          TValue a = 2, b = 3, c = 5;
+
+          Parser<TValue, TString> p1;
+          p1.DefineVar(_SL("a"), &a);
+          p1.DefineVar(_SL("b"), &b);
+          p1.SetExprCache(&cache);
+
+          // the second parser uses different variables
+          Parser<TValue, TString> p2;
+          p2.DefineVar(_SL("a"), &b);
+          p2.DefineVar(_SL("b"), &c);
+          p2.SetExprCache(&cache);
+
+          const TString sExpr[] = { _SL("a*b+1"), _SL("sin(a)+b^2"), _SL("a,b,a+b"), _SL("(b=a*2)+1") };
+          for (std::size_t i=0; i<sizeof(sExpr)/sizeof(sExpr[0]); ++i)
+          {
+            Parser<TValue, TString> q;
+            q.DefineVar(_SL("a"), &a);
+            q.DefineVar(_SL("b"), &b);
+            q.SetExpr(sExpr[i]);
+
+            for (int k=0; k<2; ++k)
+            {
+              TValue fRef = q.Eval();
+              b = 3;
+              p1.SetExpr(sExpr[i]);
+              if (p1.Eval()!=fRef)
+                iStat += 1;
+
+              b = 3;
+            }
+          }
+
+          if (cache.GetMisses()!=4 || cache.GetHits()!=4)
+            iStat += 1;
+
+          // leading and trailing whitespace does not matter, definitions do
+          p1.SetExpr(_SL("  a*b+1\t"));
+          if (p1.Eval()!=7 || cache.GetHits()!=5)
+            iStat += 1;
+
+          p2.SetExpr(_SL("a*b+1"));
+          if (p2.Eval()!=16 || cache.GetMisses()!=5)
+            iStat += 1;
+
+          p1.DefineConst(_SL("k"), 1);
+          p1.SetExpr(_SL("a*b+1"));
+          if (p1.Eval()!=7 || cache.GetMisses()!=6)
+            iStat += 1;
+
+          // the cache keeps working after all entries were replaced
+          for (int i=0; i<100; ++i)
+          {
+            stringstream_type ss;
+            ss << _SL("a*") << i;
+            p1.SetExpr(ss.str());
+            if (p1.Eval()!=a*i)
+              iStat += 1;
+          }
+
+          cache.Clear();
+          p1.SetExpr(_SL("a*b+1"));
+          if (p1.Eval()!=7)
+            iStat += 1;
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestStats()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing runtime statistics...");
+
+        try
+        {
+          ParserStatsRegistry<TString> reg;
+          TValue a = 2, b = 0;
+
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a);
+          p.DefineVar(_SL("b"), &b);
+          p.SetStatsRegistry(&reg);
+          p.SetExpr(_SL(" a*2 + 1 "));
+          for (int i=0; i<10; ++i)
+            iStat += (p.Eval()==5) ? 0 : 1;
+
+          // evaluations by another thread are recorded separately
+          std::thread([&]{ for (int i=0; i<5; ++i) p.Eval(); }).join();
+
+          std::string sJson = reg.GetJson();
+          if (sJson.find("\"expr\": \"a*2 + 1\", \"evals\": 15")==std::string::npos ||
+              sJson.find("\"compiles\": 1,")==std::string::npos ||
+              sJson.find("\"thread\": 1, \"evals\": 5, ")==std::string::npos)
+            iStat += 1;
+
+          // fallback reasons
+          const TString sExpr[] = { _SL("b=a*2"), _SL("a,a+1"), _SL("a*2+1") };
+          const EEngineFallback eFallback[] = { efASSIGNMENT, efMULTIPLE_RESULTS, efNONE };
+          for (std::size_t i=0; i<sizeof(sExpr)/sizeof(sExpr[0]); ++i)
+          {
+            p.SetExpr(sExpr[i]);
+            p.Eval();
+            if (p.GetEngineFallback()!=eFallback[i])
+              iStat += 1;
+          }
+
+          sJson = reg.GetJson();
+          if (sJson.find("\"fallback\": \"assignment\"")==std::string::npos ||
+              sJson.find("\"fallback\": \"multiple_results\"")==std::string::npos)
+            iStat += 1;
+
+          // copies record into the same registry, the counters can be reset
+          reg.Reset();
+          Parser<TValue, TString> q(p);
+          q.Eval();
+          q.SetStatsRegistry(nullptr);
+          q.Eval();
+          if (reg.GetJson().find("\"expr\": \"a*2+1\", \"evals\": 1,")==std::string::npos)
+            iStat += 1;
+
+          // compiled expressions record into the registry of the parser
+          CompiledExpression<TValue, TString> expr = p.Compile();
+          typename CompiledExpression<TValue, TString>::Context ctx(expr);
+          expr.Eval(ctx);
+          expr.Eval(ctx);
+          if (reg.GetJson().find("\"expr\": \"a*2+1\", \"evals\": 3,")==std::string::npos)
+            iStat += 1;
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestExplain()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing compiled plan report...");
+
+        try
+        {
+          TValue a = 2, b = 0, c = 3;
+
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a);
+          p.DefineVar(_SL("b"), &b);
+          p.DefineVar(_SL("c"), &c);
+
+          // folded into a single value instruction
+          p.SetExpr(_SL("2*a + 3*4"));
+          ParserExplain<TValue, TString> plan = p.Explain();
+          std::string sJson = plan.GetJson();
+          if (plan.GetCode().size()!=1 || plan.GetNumOptimized(opCONST_FOLD)!=1 || 
+              plan.GetNumOptimized(opJOIN_MUL)!=1 || plan.GetNumOptimized(opJOIN_ADD_SUB)!=1 ||
+              plan.GetVarNames().size()!=1 || plan.GetEngine()!=p.GetEngine() || 
+              plan.GetEngineName()!=p.GetEngineName() || plan.GetCode()[0].Ident!=_SL("a"))
+            iStat += 1;
+
+          if (sJson.find("\"expr\": \"2*a + 3*4\"")==std::string::npos ||
+              sJson.find("\"vars\": [ \"a\" ]")==std::string::npos ||
+              sJson.find("\"const_fold\": 1")==std::string::npos)
+            iStat += 1;
+
+          // the assignment prevents a precompiled engine
+          p.SetExpr(_SL("b=a*2"));
+          plan = p.Explain();
+          if (plan.GetEngineFallback()!=efASSIGNMENT || plan.GetHints().size()!=1 ||
+              plan.GetCode().back().Cmd!=cmASSIGN || plan.GetCode().back().Ident!=_SL("b") ||
+              plan.GetJson().find("\"fallback\": \"assignment\"")==std::string::npos)
+            iStat += 1;
+
+          // user callbacks prevent a specialized engine
+          p.SetExpr(_SL("sin(a)*b"));
+          plan = p.Explain();
+          if (plan.GetEngine()==enSPECIALIZED || plan.GetJson().find("sin")==std::string::npos ||
+              plan.GetHints().empty() || plan.GetVarNames().size()!=2)
+            iStat += 1;
+
+          // callbacks are estimated to be slower than builtin operators
+          const unsigned nCost = plan.GetCost();
+          p.SetExpr(_SL("a*a*b"));
+          plan = p.Explain();
+          if (plan.GetCost()==0 || plan.GetCost()>=nCost)
+            iStat += 1;
+
+          // the optimizer is not applied if disabled
+          p.EnableOptimizer(false);
+          plan = p.Explain();
+          if (plan.IsOptimizerEnabled() || plan.GetNumOptimized(opJOIN_MUL)!=0 || plan.GetHints().empty())
+            iStat += 1;
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
+        }
+
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestSerialization()
       {
         int iStat = 0;
-        _OUT << _SL("testing member functions...");
-   
-        // Test RemoveVar
-        TValue afVal[3] = {1,2,3};
-        Parser<TValue, TString> p;
-  
+        _OUT << _SL("testing bytecode serialization...");
+
+        const TString sExpr[] = 
+        { 
+          _SL("a*b+c"), 
+          _SL("a+(b+c)*(a-b/c)+b^3*a-(2*a+1)*3"), 
+          _SL("sum(a,b,c,1)*min(a,b)+ping()"),
+          _SL("-a{m}+b^2-sin(c)"),
+          _SL("a,b,a*b*c"),
+          _SL("(d=a*b)*2+d"),
+          _SL("_pi*2+(a<b)*(c!=3)")
+        };
+        const std::size_t nExpr = sizeof(sExpr)/sizeof(sExpr[0]);
+
         try
         {
-          p.DefineVar(_SL("a"), &afVal[0]);
-          p.DefineVar(_SL("b"), &afVal[1]);
-          p.DefineVar(_SL("c"), &afVal[2]);
-          p.SetExpr(_SL("a+b+c"));
-          p.Eval();
+          TValue a = 1, b = 2, c = 3, d = 0;
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a);
+          p.DefineVar(_SL("b"), &b);
+          p.DefineVar(_SL("c"), &c);
+          p.DefineVar(_SL("d"), &d);
+          p.DefineFun(_SL("ping"), Ping, 0);
+          p.DefineFun(_SL("min"), Min, 2);
+          p.DefinePostfixOprt(_SL("{m}"), Milli);
+
+          std::vector<unsigned char> vBlob;
+          for (std::size_t i=0; i<nExpr; ++i)
+          {
+            p.SetExpr(sExpr[i]);
+            p.SaveByteCode(vBlob);
+          }
+
+          // the loading parser binds the names to its own variables
+          TValue a2 = 1, b2 = 2, c2 = 3, d2 = 0;
+          Parser<TValue, TString> q;
+          q.DefineVar(_SL("a"), &a2);
+          q.DefineVar(_SL("b"), &b2);
+          q.DefineVar(_SL("c"), &c2);
+          q.DefineVar(_SL("d"), &d2);
+          q.DefineFun(_SL("ping"), Ping, 0);
+          q.DefineFun(_SL("min"), Min, 2);
+          q.DefinePostfixOprt(_SL("{m}"), Milli);
+
+          std::size_t nPos = 0;
+          for (std::size_t i=0; i<nExpr; ++i)
+          {
+            p.SetExpr(sExpr[i]);
+            nPos += q.LoadByteCode(&vBlob[nPos], vBlob.size() - nPos);
+
+            for (int k=0; k<3; ++k)
+            {
+              a = a2 = (TValue)(k + 1);
+              b = b2 = (TValue)(2 - k);
+
+              TValue fVal = p.Eval();
+              if (q.Eval()!=fVal || d!=d2 || q.GetExpr()!=p.GetExpr())
+                iStat += 1;
+            }
+          }
+
+          if (nPos!=vBlob.size())
+            iStat += 1;
+
+          // damaged data and undefined variables are detected
+          iStat += SerializationFailTest(q, std::vector<unsigned char>(vBlob.begin(), vBlob.begin() + vBlob.size() / 3));
+
+          Parser<TValue, TString> r;
+          r.DefineVar(_SL("a"), &a2);
+          iStat += SerializationFailTest(r, vBlob);
         }
-        catch(...)
+        catch(ParserError<TString> &e)
         {
-          iStat += 1;  // this is not supposed to happen 
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
         }
 
+        if (iStat==0)
+          _OUT << _SL("passed") << std::endl;
+        else 
+          _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
+
+        return iStat;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      int TestCatalogue()
+      {
+        int iStat = 0;
+        _OUT << _SL("testing formula catalogue...");
+
+        const char *szFile = "muparser_catalogue_test.txt",
+                   *szBadFile = "muparser_catalogue_bad.txt";
+
         try
         {
-          p.RemoveVar( _SL("c") );
-          p.Eval();
-          iStat += 1;  // not supposed to reach this, nonexisting variable "c" deleted...
+          {
+            std::ofstream file(szFile, std::ios::binary);
+            file << "# test formulas\n"
+                 << "sum_ab = a + b\r\n"
+                 << "\n"
+                 << "  cmp=(a<=b)*10+(a==b)\n"
+                 << "product = a*b*sin(0)\n"
+                 << "product = a*b";
+          }
+
+          TValue a = 2, b = 3;
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a);
+          p.DefineVar(_SL("b"), &b);
+
+          ParserCatalogue<TValue, TString> cat(&p);
+          cat.Open(szFile);
+
+          // formulas are only compiled when needed
+          if (cat.GetSize()!=3 || cat.GetNumCompiled()!=0 || !cat.Contains(_SL("cmp")))
+            iStat += 1;
+
+          if (cat.Eval(_SL("sum_ab"))!=5 || cat.Eval(_SL("cmp"))!=10 || cat.GetNumCompiled()!=2)
+            iStat += 1;
+
+          a = 3;
+          if (cat.Eval(_SL("product"))!=9 || cat.Eval(_SL("cmp"))!=11 || cat.GetNumCompiled()!=3)
+            iStat += 1;
+
+          if (cat.GetExpr(_SL("sum_ab"))!=_SL("a + b"))
+            iStat += 1;
+
+          try
+          {
+            cat.Eval(_SL("undefined"));
+            iStat += 1;
+          }
+          catch(ParserError<TString> &e)
+          {
+            iStat += (e.GetCode()==ecINVALID_NAME) ? 0 : 1;
+          }
+
+          {
+            std::ofstream file(szBadFile, std::ios::binary);
+            file << "x = 1\n"
+                 << "no formula\n";
+          }
+
+          try
+          {
+            cat.Open(szBadFile);
+            iStat += 1;
+          }
+          catch(ParserError<TString> &e)
+          {
+            iStat += (e.GetCode()==ecINVALID_CATALOGUE) ? 0 : 1;
+          }
+
+          // a file that failed to load must not leave entries behind
+          if (cat.Contains(_SL("x")) || cat.GetSize()!=3 || cat.GetExpr(_SL("sum_ab"))!=_SL("a + b"))
+            iStat += 1;
+
+          try
+          {
+            cat.GetExpr(_SL("x"));
+            iStat += 1;
+          }
+          catch(ParserError<TString> &e)
+          {
+            iStat += (e.GetCode()==ecINVALID_NAME) ? 0 : 1;
+          }
         }
-        catch(...)
+        catch(ParserError<TString> &e)
         {
-          // failure is expected...
+          _OUT << _SL("\n  ") << e.GetExpr() << _SL(" : ") << e.GetMsg();
+          iStat += 1;
         }
 
-        if (iStat==0) 
+        std::remove(szFile);
+        std::remove(szBadFile);
+
+        if (iStat==0)
           _OUT << _SL("passed") << std::endl;
         else 
           _OUT << _SL("\n  failed with ") << iStat << _SL(" errors") << std::endl;
@@ -150,6 +1044,23 @@ MUP_NAMESPACE_START
         return iStat;
       }
 
+      //---------------------------------------------------------------------------------------------
+      /** \brief Returns 0 if loading the bytecode of all expressions in a_vBlob fails. */
+      int SerializationFailTest(Parser<TValue, TString> &a_Parser, const std::vector<unsigned char> &a_vBlob)
+      {
+        try
+        {
+          for (std::size_t nPos=0; nPos<a_vBlob.size(); )
+            nPos += a_Parser.LoadByteCode(&a_vBlob[nPos], a_vBlob.size() - nPos);
+        }
+        catch(ParserError<TString> &e)
+        {
+          return (e.GetCode()==ecINVALID_BYTECODE) ? 0 : 1;
+        }
+
+        return 1;
+      }
+
       //---------------------------------------------------------------------------------------------
       int TestOptimizer()
       {
@@ -158,6 +1069,55 @@ MUP_NAMESPACE_START
     
         // Test substitution of consequtive binary operators:
         iStat += EqnTest(_SL("b*(a-b/a)"), -2, true);
+        iStat += OptimizerTest(_SL("a+(b+c)"), 5);
+        iStat += OptimizerTest(_SL("a-(b+c)"), 5);
+        iStat += OptimizerTest(_SL("a*(b*c)"), 5);
+        iStat += OptimizerTest(_SL("a/(b/c)"), 5);
+        iStat += OptimizerTest(_SL("a-(b/c)"), 5);
+        iStat += OptimizerTest(_SL("a*b^2"), 4);
+        iStat += OptimizerTest(_SL("a+b^3"), 4);
+
+        // Constant folding and merging of constants into value tokens
+        iStat += OptimizerTest(_SL("2*3+a"), 2);
+        iStat += OptimizerTest(_SL("a*2+3"), 2);
+        iStat += OptimizerTest(_SL("3-2*a"), 2);
+        iStat += OptimizerTest(_SL("(a+1)*2-a"), 2);
+        iStat += OptimizerTest(_SL("a+a+a"), 2);
+        iStat += OptimizerTest(_SL("sin(1)*cos(2)+a"), 2);
+        iStat += OptimizerTest(_SL("(1+2)*(3+4)"), 2);
+        iStat += OptimizerTest(_SL("a^2"), 3);
+        iStat += OptimizerTest(_SL("a^5"), 3);
+        iStat += OptimizerTest(_SL("a^6"), 4);
+        iStat += OptimizerTest(_SL("a*b"), 4);
+
+        // callbacks without arguments must not be folded
+        iStat += OptimizerTest(_SL("ping()+1"), 4);
+
+        // short arithmetic expressions are evaluated by the specialized engines
+        iStat += EqnTest(_SL("a+(b+c)"), 6, true);
+        iStat += EqnTest(_SL("a-(b+c)"), -4, true);
+        iStat += EqnTest(_SL("a+b*c"), 7, true);
+        iStat += EqnTest(_SL("a*(b+c)"), 5, true);
+        iStat += EqnTest(_SL("d*(b*c)"), -12, true);
+        iStat += EqnTest(_SL("c/(b/d)"), -3, true);
+        iStat += EqnTest(_SL("c/(b*d)"), (TValue)-0.75, true);
+        iStat += EqnTest(_SL("c*(b/d)"), -3, true);
+        iStat += EqnTest(_SL("a+c/b"), (TValue)2.5, true);
+        iStat += EqnTest(_SL("c/(a+b)"), 1, true);
+        iStat += EqnTest(_SL("a-c/b"), (TValue)-0.5, true);
+        iStat += EqnTest(_SL("c/(b-d)"), (TValue)0.75, true);
+        iStat += EqnTest(_SL("(a+b)*(c-d)"), 15, true);
+        iStat += EqnTest(_SL("a*b+c*d"), -4, true);
+        iStat += EqnTest(_SL("a/b-c/d"), 2, true);
+        iStat += EqnTest(_SL("(2*a-b)/(c+d)+1"), 1, true);
+
+        // comparisons, logical operators and builtin functions of variables
+        iStat += EqnTest(_SL("(a>=b)+(c<=3)*2+(a==1)*4+(b!=2)*8+(d<a)*16+(d>a)*32"), 22, true);
+        iStat += EqnTest(_SL("(a||0)+(d&&0)*2+(a&&d)*4+abs(d)*abs(a)-sqrt(b*2)"), 5, true);
+
+        // long expressions are evaluated by the register code, cover its specialized instructions
+        iStat += EqnTest(_SL("2/(a+b)+(a-b)*3-sqrt(c*3)+exp(a-1)*abs(d)-log(b/2)+cos(a-1)+tan(b-2)+sin(a-1)-(-a)"), (TValue)-1.3333333, true);
+        iStat += EqnTest(_SL("(a+b)/2-1/(c-a)*(2-b)+(4*c-1)*(a*b)+(d/(a-3))"), (TValue)24.5, true);
 
         if (iStat==0)
           _OUT << _SL("passed") << std::endl;
@@ -213,6 +1173,11 @@ MUP_NAMESPACE_START
         iStat += EqnTest(_SL("2*(a=b)"), 4, true);
         iStat += EqnTest(_SL("2*(a=b+1)"), 6, true);
         iStat += EqnTest(_SL("(a=b+1)*2"), 6, true);
+        iStat += EqnTest(_SL("(a=b)+a"), 4, true);
+
+        // variables must be read before they are overwritten
+        iStat += EqnTestWithVarChange(_SL("a+(a=2*a)"), 1, 3, 3, 9);
+        iStat += EqnTestWithVarChange(_SL("a*3+(a=a+1)*a"), 1, 7, 2, 15);
 
         iStat += EqnTest(_SL("2^2^3"), 256, true); 
         iStat += EqnTest(_SL("1/2/3"), (TValue)1.0/(TValue)6.0, true); 
@@ -502,7 +1467,7 @@ MUP_NAMESPACE_START
         iStat += EqnTest( _SL("(-3)^2"),9, true);
         iStat += EqnTest( _SL("-(-2^2)"),4, true);
         iStat += EqnTest( _SL("3+-3^2"),-6, true);
-        // The following assumes use of sqr as postfix operator ("") together
+        // The following assumes use of sqr as postfix operator ("�") together
         // with a sign operator of low priority:
         iStat += EqnTest( _SL("-2'"), -4, true);
         iStat += EqnTest( _SL("-(1+1)'"),-4, true);
@@ -711,6 +1676,7 @@ MUP_NAMESPACE_START
       //---------------------------------------------------------------------------------------------
       ParserTester()
         :m_vTestFun()
+        ,m_pEqnLog(nullptr)
       {
         AddTest(&ParserTester<TValue, TString>::TestSyntax);
         AddTest(&ParserTester<TValue, TString>::TestPostFix);
@@ -719,6 +1685,18 @@ MUP_NAMESPACE_START
         AddTest(&ParserTester<TValue, TString>::TestMultiArg);
         AddTest(&ParserTester<TValue, TString>::TestExpression);
         AddTest(&ParserTester<TValue, TString>::TestInterface);
+        AddTest(&ParserTester<TValue, TString>::TestSymbolTable);
+        AddTest(&ParserTester<TValue, TString>::TestNumLiterals);
+        AddTest(&ParserTester<TValue, TString>::TestRebind);
+        AddTest(&ParserTester<TValue, TString>::TestEvalStack);
+        AddTest(&ParserTester<TValue, TString>::TestBulkEval);
+        AddTest(&ParserTester<TValue, TString>::TestParallelEval);
+        AddTest(&ParserTester<TValue, TString>::TestCompiledExpr);
+        AddTest(&ParserTester<TValue, TString>::TestExprCache);
+        AddTest(&ParserTester<TValue, TString>::TestStats);
+        AddTest(&ParserTester<TValue, TString>::TestExplain);
+        AddTest(&ParserTester<TValue, TString>::TestSerialization);
+        AddTest(&ParserTester<TValue, TString>::TestCatalogue);
         AddTest(&ParserTester<TValue, TString>::TestBinOprt);
         AddTest(&ParserTester<TValue, TString>::TestOptimizer);
         AddTest(&ParserTester<TValue, TString>::TestException);
@@ -727,7 +1705,10 @@ MUP_NAMESPACE_START
       }
 
       //-------------------------------------------------------------------------------------------
-      void Run()
+      /** \brief Run all tests.
+          \return The number of failed tests.
+      */
+      int Run()
       {
         int iStat = 0;
         try
@@ -767,11 +1748,76 @@ MUP_NAMESPACE_START
                     << " expressions)" << std::endl;
         }
         ParserTester::c_iCount = 0;
+        return iStat;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Store all expressions EqnTest expects to be valid in a_pLog. 
+      
+        The expressions can be evaluated by parsers set up with InitEqnParser.
+      */
+      void SetEqnLog(std::vector<TString> *a_pLog)
+      {
+        m_pEqnLog = a_pLog;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Define the constants, variables, functions and operators used by EqnTest.
+          \param a_Parser The parser to set up.
+          \param a_pVar Array of four values bound to the variables a, b, c and d, aa is an alias of b.
+      */
+      static void InitEqnParser(Parser<TValue, TString> &a_Parser, TValue *a_pVar)
+      {
+        // Add constants
+        a_Parser.DefineConst(_SL("pi"), MathImpl<TValue, TString>::c_pi);
+        a_Parser.DefineConst(_SL("e"),  MathImpl<TValue, TString>::c_e);
+        a_Parser.DefineConst(_SL("const"), 1);
+        a_Parser.DefineConst(_SL("const1"), 2);
+        a_Parser.DefineConst(_SL("const2"), 3);
+          
+        // variables
+        a_Parser.DefineVar(_SL("a"),  &a_pVar[0]);
+        a_Parser.DefineVar(_SL("aa"), &a_pVar[1]);
+        a_Parser.DefineVar(_SL("b"),  &a_pVar[1]);
+        a_Parser.DefineVar(_SL("c"),  &a_pVar[2]);
+        a_Parser.DefineVar(_SL("d"),  &a_pVar[3]);
+        
+        // custom value ident functions
+        a_Parser.AddValIdent(&ParserTester<TValue, TString>::IsHexVal);        
+
+        // functions
+        a_Parser.DefineFun(_SL("ping"),  Ping, 0);
+        a_Parser.DefineFun(_SL("f1of1"), FirstArg, 1);
+        a_Parser.DefineFun(_SL("f1of2"), FirstArg, 2);
+        a_Parser.DefineFun(_SL("f2of2"), arg2, 2);
+
+        // binary operators
+        a_Parser.DefineOprt(_SL("add"), MathImpl<TValue, TString>::Add, 0);
+        a_Parser.DefineOprt(_SL("++"),  MathImpl<TValue, TString>::Add, 0);
+        a_Parser.DefineOprt(_SL("&"), land, prLAND);
+
+        // sample functions
+        a_Parser.DefineFun(_SL("min"), Min, 2);
+        a_Parser.DefineFun(_SL("max"), Max, 2);
+
+        // infix / postfix operator
+        // Note: Identifiers used here do not have any meaning 
+        //       they are mere placeholders to test certain features.
+        a_Parser.DefineInfixOprt(_SL("$"), MathImpl<TValue, TString>::UnaryMinus, prPOW+1);  // sign with high priority
+        a_Parser.DefineInfixOprt(_SL("~"), plus2);          // high priority
+        a_Parser.DefineInfixOprt(_SL("~~"), plus2);
+        a_Parser.DefinePostfixOprt(_SL("{m}"), Milli);
+        a_Parser.DefinePostfixOprt(_SL("{M}"), Mega);
+        a_Parser.DefinePostfixOprt(_SL("m"), Milli);
+        a_Parser.DefinePostfixOprt(_SL("meg"), Mega);
+        a_Parser.DefinePostfixOprt(_SL("#"), times3);
+        a_Parser.DefinePostfixOprt(_SL("'"), sqr); 
       }
 
     private:
 
       std::vector<testfun_typeype> m_vTestFun;
+      std::vector<TString> *m_pEqnLog;   ///< Receives the valid expressions of EqnTest, may be null
 
       //-------------------------------------------------------------------------------------------
       void AddTest(testfun_typeype a_pFun)
@@ -878,6 +1924,262 @@ MUP_NAMESPACE_START
         return 0;
       }
 
+      //---------------------------------------------------------------------------
+      /** \brief Compare the bulk evaluation of an expression with row by row evaluation. 
+
+          Variable "a" is bound to a contiguous column, "b" to an interleaved column with a 
+          stride of 3, "c" is the same for all rows and "d" is a column used as assignment target.
+          The number of rows is deliberately no multiple of the bulk block size.
+
+          \return 1 in case of a failure, 0 otherwise.
+      */
+      int BulkTest(const TString &a_str)
+      {
+        ParserTester<TValue, TString>::c_iCount++;
+
+        const std::size_t nRows = 2*MUP_BULK_SIZE + 7;
+        std::vector<TValue> vA(nRows), vB(3*nRows), vD(nRows), vRes(nRows), vResD(nRows);
+        TValue c = 3;
+
+        for (std::size_t i=0; i<nRows; ++i)
+        {
+          vA[i] = (TValue)(i % 13) + 1;
+          vB[3*i] = (TValue)(i % 7) + 2;
+          vB[3*i+1] = vB[3*i+2] = -999; // must never be read
+        }
+
+        try
+        {
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &vA[0], 1);
+          p.DefineVar(_SL("b"), &vB[0], 3);
+          p.DefineVar(_SL("c"), &c);
+          p.DefineVar(_SL("d"), &vD[0], 1);
+          p.DefineFun(_SL("ping"), Ping, 0);
+          p.DefineFun(_SL("min"), Min, 2);
+          p.DefineFun(_SL("max2"), Max, 2, VecMax);
+          p.DefinePostfixOprt(_SL("{m}"), Milli);
+          p.SetExpr(a_str);
+          p.Eval(&vRes[0], nRows);
+          vResD = vD;
+
+          // reference: the same expression evaluated row by row with scalar variables
+          TValue a, b, d;
+          Parser<TValue, TString> q;
+          q.DefineVar(_SL("a"), &a);
+          q.DefineVar(_SL("b"), &b);
+          q.DefineVar(_SL("c"), &c);
+          q.DefineVar(_SL("d"), &d);
+          q.DefineFun(_SL("ping"), Ping, 0);
+          q.DefineFun(_SL("min"), Min, 2);
+          q.DefineFun(_SL("max2"), Max, 2);
+          q.DefinePostfixOprt(_SL("{m}"), Milli);
+          q.SetExpr(a_str);
+
+          for (std::size_t i=0; i<nRows; ++i)
+          {
+            a = vA[i];
+            b = vB[3*i];
+            d = vD[i];
+
+            TValue fVal = q.Eval();
+            if (fabs(fVal-vRes[i]) > fabs(fVal*0.0001) || fabs(d-vResD[i]) > fabs(d*0.0001))
+              throw std::runtime_error("bulk evaluation differs from single evaluation");
+          }
+
+          if (vB[1]!=-999 || vB[2]!=-999)
+            throw std::runtime_error("bulk evaluation touched values outside of the column");
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.GetMsg() << _SL(")");
+          return 1;
+        }
+        catch(std::exception &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.what() << _SL(")");
+          return 1;
+        }
+
+        return 0;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      /** \brief Compare the parallel evaluation of an expression with the bulk evaluation. 
+
+          The number of rows spans several chunks of the parallel evaluation, both evaluations
+          must yield identical results and assignment targets.
+
+          \return 1 in case of a failure, 0 otherwise.
+      */
+      int ParallelTest(const TString &a_str)
+      {
+        ParserTester<TValue, TString>::c_iCount++;
+
+        const std::size_t nRows = 100000 + 7;
+        std::vector<TValue> vA(nRows), vB(2*nRows), vD(nRows), vRes(nRows), vResD(nRows), vPar(nRows);
+        TValue c = 3;
+
+        for (std::size_t i=0; i<nRows; ++i)
+        {
+          vA[i] = (TValue)(i % 13) + 1;
+          vB[2*i] = (TValue)(i % 7) + 2;
+        }
+
+        try
+        {
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &vA[0], 1);
+          p.DefineVar(_SL("b"), &vB[0], 2);
+          p.DefineVar(_SL("c"), &c);
+          p.DefineVar(_SL("d"), &vD[0], 1);
+          p.DefineFun(_SL("min"), Min, 2);
+          p.DefineFun(_SL("max2"), Max, 2, VecMax);
+          p.SetExpr(a_str);
+
+          p.Eval(&vRes[0], nRows);
+          vResD = vD;
+          c = 3;
+
+          for (int i=0; i<2; ++i)
+          {
+            std::fill(vD.begin(), vD.end(), (TValue)0);
+            std::fill(vPar.begin(), vPar.end(), (TValue)0);
+            p.EvalParallel(&vPar[0], nRows, i==1);
+            if (vPar!=vRes || vD!=vResD)
+              throw std::runtime_error("parallel evaluation differs from bulk evaluation");
+
+            c = 3;
+          }
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.GetMsg() << _SL(")");
+          return 1;
+        }
+        catch(std::exception &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.what() << _SL(")");
+          return 1;
+        }
+
+        return 0;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      /** \brief Compare the evaluation of a compiled expression with the parser. 
+      
+        The compiled expression is evaluated with its own copies of the variables.
+      */
+      int CompiledExprTest(const TString &a_str)
+      {
+        ParserTester<TValue, TString>::c_iCount++;
+
+        try
+        {
+          TValue a = 1, b = 2, c = 3, d = 0;
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a);
+          p.DefineVar(_SL("b"), &b);
+          p.DefineVar(_SL("c"), &c);
+          p.DefineVar(_SL("d"), &d);
+          p.DefineFun(_SL("ping"), Ping, 0);
+          p.DefineFun(_SL("min"), Min, 2);
+          p.SetExpr(a_str);
+
+          CompiledExpression<TValue, TString> expr = p.Compile();
+          typename CompiledExpression<TValue, TString>::Context ctx(expr);
+
+          TValue a2, b2, c2 = 3, d2 = 0;
+          std::vector<TString> vNames = expr.GetVarNames();
+          for (std::size_t i=0; i<vNames.size(); ++i)
+          {
+            if (vNames[i]==_SL("a")) ctx.Bind(vNames[i], &a2);
+            if (vNames[i]==_SL("b")) ctx.Bind(vNames[i], &b2);
+            if (vNames[i]==_SL("c")) ctx.Bind(vNames[i], &c2);
+            if (vNames[i]==_SL("d")) ctx.Bind(vNames[i], &d2);
+          }
+
+          for (int i=0; i<5; ++i)
+          {
+            a = a2 = (TValue)(i + 1);
+            b = b2 = (TValue)(2 - i);
+
+            TValue fVal = p.Eval();
+            TValue fRes = expr.Eval(ctx);
+            if (fabs(fVal-fRes) > fabs(fVal*0.0001) || d!=d2)
+              throw std::runtime_error("compiled expression differs from the parser");
+          }
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.GetMsg() << _SL(")");
+          return 1;
+        }
+        catch(std::exception &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.what() << _SL(")");
+          return 1;
+        }
+
+        return 0;
+      }
+
+      //---------------------------------------------------------------------------------------------
+      /** \brief Compare the optimized bytecode of an expression with the unoptimized one.
+
+          Both versions must yield the same result, in addition the optimized bytecode must 
+          consist of a_nTokens tokens including the terminating cmEND.
+
+          \return 1 in case of a failure, 0 otherwise.
+      */
+      int OptimizerTest(const TString &a_str, std::size_t a_nTokens)
+      {
+        ParserTester<TValue, TString>::c_iCount++;
+
+        try
+        {
+          TValue a = 1, b = 2, c = 3;
+          Parser<TValue, TString> p;
+          p.DefineVar(_SL("a"), &a);
+          p.DefineVar(_SL("b"), &b);
+          p.DefineVar(_SL("c"), &c);
+          p.DefineFun(_SL("ping"), Ping, 0);
+          p.SetExpr(a_str);
+
+          Parser<TValue, TString> q(p);
+          q.EnableOptimizer(false);
+
+          for (int i=0; i<3; ++i)
+          {
+            a = (TValue)(i + 1);
+            b = (TValue)(2*i - 3);
+
+            TValue fVal[2] = { p.Eval(), q.Eval() };
+            if (fabs(fVal[0]-fVal[1]) > fabs(fVal[1]*0.0001))
+              throw std::runtime_error("optimized and unoptimized bytecode differ");
+          }
+
+          if (p.GetByteCode().GetSize()!=a_nTokens)
+            throw std::runtime_error("unexpected size of the optimized bytecode");
+
+          if (q.GetByteCode().GetSize()<a_nTokens)
+            throw std::runtime_error("unoptimized bytecode is smaller than the optimized one");
+        }
+        catch(ParserError<TString> &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.GetMsg() << _SL(")");
+          return 1;
+        }
+        catch(std::exception &e)
+        {
+          _OUT << _SL("\n  fail: ") << a_str.c_str() << _SL(" (") << e.what() << _SL(")");
+          return 1;
+        }
+
+        return 0;
+      }
+
       //---------------------------------------------------------------------------
       /** \brief Evaluate a tet expression. 
 
@@ -886,6 +2188,9 @@ MUP_NAMESPACE_START
       int EqnTest(const TString &a_str, TValue a_fRes, bool a_fPass)
       {
         ParserTester<TValue, TString>::c_iCount++;
+        if (m_pEqnLog && a_fPass)
+          m_pEqnLog->push_back(a_str);
+
         int iRet(0);
         TValue fVal[4] = {-999, -998, -997, -996}; // initially should be different
 
@@ -900,51 +2205,8 @@ MUP_NAMESPACE_START
       
           p1.reset(new Parser<TValue, TString>()); 
 
-          // Add constants
-          p1->DefineConst(_SL("pi"), MathImpl<TValue, TString>::c_pi);
-          p1->DefineConst(_SL("e"),  MathImpl<TValue, TString>::c_e);
-          p1->DefineConst(_SL("const"), 1);
-          p1->DefineConst(_SL("const1"), 2);
-          p1->DefineConst(_SL("const2"), 3);
-          
-          // variables
           TValue vVarVal[] = { 1, 2, 3, -2};
-          p1->DefineVar(_SL("a"),  &vVarVal[0]);
-          p1->DefineVar(_SL("aa"), &vVarVal[1]);
-          p1->DefineVar(_SL("b"),  &vVarVal[1]);
-          p1->DefineVar(_SL("c"),  &vVarVal[2]);
-          p1->DefineVar(_SL("d"),  &vVarVal[3]);
-        
-          // custom value ident functions
-          p1->AddValIdent(&ParserTester<TValue, TString>::IsHexVal);        
-
-          // functions
-          p1->DefineFun(_SL("ping"),  Ping, 0);
-          p1->DefineFun(_SL("f1of1"), FirstArg, 1);
-          p1->DefineFun(_SL("f1of2"), FirstArg, 2);
-          p1->DefineFun(_SL("f2of2"), arg2, 2);
-
-          // binary operators
-          p1->DefineOprt(_SL("add"), MathImpl<TValue, TString>::Add, 0);
-          p1->DefineOprt(_SL("++"),  MathImpl<TValue, TString>::Add, 0);
-          p1->DefineOprt(_SL("&"), land, prLAND);
-
-          // sample functions
-          p1->DefineFun(_SL("min"), Min, 2);
-          p1->DefineFun(_SL("max"), Max, 2);
-
-          // infix / postfix operator
-          // Note: Identifiers used here do not have any meaning 
-          //       they are mere placeholders to test certain features.
-          p1->DefineInfixOprt(_SL("$"), MathImpl<TValue, TString>::UnaryMinus, prPOW+1);  // sign with high priority
-          p1->DefineInfixOprt(_SL("~"), plus2);          // high priority
-          p1->DefineInfixOprt(_SL("~~"), plus2);
-          p1->DefinePostfixOprt(_SL("{m}"), Milli);
-          p1->DefinePostfixOprt(_SL("{M}"), Mega);
-          p1->DefinePostfixOprt(_SL("m"), Milli);
-          p1->DefinePostfixOprt(_SL("meg"), Mega);
-          p1->DefinePostfixOprt(_SL("#"), times3);
-          p1->DefinePostfixOprt(_SL("'"), sqr); 
+          InitEqnParser(*p1, vVarVal);
           p1->SetExpr(a_str);
 
           // Test bytecode integrity
@@ -954,6 +2216,11 @@ MUP_NAMESPACE_START
           if (fVal[0]!=fVal[1])
             throw ParserError<TString>(_SL("Bytecode / string parsing mismatch."));
 
+          // A stack owned by the caller must yield the same result
+          std::vector<TValue> vStack(p1->GetMaxStackSize());
+          if (p1->EvalWithStack(vStack.data(), vStack.size())!=fVal[1])
+            throw ParserError<TString>(_SL("Caller stack / bytecode mismatch."));
+
           // Test copy and assignement operators
           try
           {
@@ -972,6 +2239,7 @@ MUP_NAMESPACE_START
             // additionally  disable Optimizer this time
             Parser<TValue, TString> p3;
             p3 = p2;
+            p3.EnableOptimizer(false);
             fVal[3] = p3.Eval();
           }
           catch(std::exception &e)
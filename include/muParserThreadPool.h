@@ -0,0 +1,264 @@
+/*
+                 __________
+    _____   __ __\______   \_____  _______  ______  ____ _______
+   /     \ |  |  \|     ___/\__  \ \_  __ \/  ___/_/ __ \\_  __ \
+  |  Y Y  \|  |  /|    |     / __ \_|  | \/\___ \ \  ___/ |  | \/
+  |__|_|  /|____/ |____|    (____  /|__|  /____  > \___  >|__|
+        \/                       \/            \/      \/
+  Copyright (C) 2004-2012 Ingo Berg
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this
+  software and associated documentation files (the "Software"), to deal in the Software
+  without restriction, including without limitation the rights to use, copy, modify,
+  merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+  permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or
+  substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+  NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MU_PARSER_THREAD_POOL_H
+#define MU_PARSER_THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+
+#include "muParserDef.h"
+
+/** \file
+    \brief Thread pool used by the parallel bulk evaluation.
+*/
+
+MUP_NAMESPACE_START
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Work stealing thread pool.
+
+    A job is a number of tasks identified by their index. Each worker owns a queue that is
+    initially filled with a contiguous range of the task indices. Workers take tasks from the
+    front of their own queue and, once it is empty, steal from the back of the queues of the
+    other workers. The calling thread waits until all tasks of the job are done.
+
+    Only one job runs at a time. Tasks must not start jobs of the same pool.
+  */
+  class ParserThreadPool
+  {
+  public:
+
+      /** \brief Task callback, receives the task index and the index of the worker. */
+      typedef std::function<void(std::size_t a_nTask, unsigned a_nWorker)> task_type;
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Create a pool.
+          \param a_nThreads Number of workers, 0 for one worker per hardware thread.
+      */
+      explicit ParserThreadPool(unsigned a_nThreads = 0)
+        :m_vQueue()
+        ,m_vThread()
+        ,m_RunMutex()
+        ,m_Mutex()
+        ,m_cvWork()
+        ,m_cvDone()
+        ,m_pTask(nullptr)
+        ,m_nJob(0)
+        ,m_nBusy(0)
+        ,m_bStop(false)
+        ,m_bAbort(false)
+        ,m_pException()
+      {
+        if (a_nThreads==0)
+          a_nThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        for (unsigned i=0; i<a_nThreads; ++i)
+          m_vQueue.push_back(std::unique_ptr<SQueue>(new SQueue()));
+
+        for (unsigned i=0; i<a_nThreads; ++i)
+          m_vThread.push_back(std::thread(&ParserThreadPool::WorkerMain, this, i));
+      }
+
+      ParserThreadPool(const ParserThreadPool&) = delete;
+      ParserThreadPool& operator=(const ParserThreadPool&) = delete;
+
+      //-------------------------------------------------------------------------------------------
+      ~ParserThreadPool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(m_Mutex);
+          m_bStop = true;
+        }
+
+        m_cvWork.notify_all();
+        for (std::size_t i=0; i<m_vThread.size(); ++i)
+          m_vThread[i].join();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the pool shared by all parsers. */
+      static ParserThreadPool& Instance()
+      {
+        static ParserThreadPool s_Pool;
+        return s_Pool;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      unsigned GetNumThreads() const
+      {
+        return (unsigned)m_vThread.size();
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Execute the tasks 0 ... a_nTasks-1 and wait for their completion.
+
+        If a task throws no further tasks are started and the first exception is rethrown
+        once all workers are idle.
+      */
+      void Run(std::size_t a_nTasks, const task_type &a_Task)
+      {
+        std::lock_guard<std::mutex> run(m_RunMutex);
+
+        const std::size_t nWorkers = m_vQueue.size();
+        for (std::size_t i=0; i<nWorkers; ++i)
+        {
+          SQueue &queue = *m_vQueue[i];
+          std::lock_guard<std::mutex> lock(queue.Mutex);
+          for (std::size_t nTask = a_nTasks*i/nWorkers; nTask<a_nTasks*(i+1)/nWorkers; ++nTask)
+            queue.Tasks.push_back(nTask);
+        }
+
+        std::exception_ptr pException;
+
+        {
+          std::unique_lock<std::mutex> lock(m_Mutex);
+          m_pTask = &a_Task;
+          m_nBusy = (unsigned)nWorkers;
+          m_bAbort = false;
+          m_pException = nullptr;
+          ++m_nJob;
+
+          m_cvWork.notify_all();
+          m_cvDone.wait(lock, [this]{ return m_nBusy==0; });
+
+          m_pTask = nullptr;
+          std::swap(pException, m_pException);
+        }
+
+        if (pException)
+          std::rethrow_exception(pException);
+      }
+
+  private:
+
+      /** \brief Task queue of a single worker. */
+      struct SQueue
+      {
+        std::mutex Mutex;
+        std::deque<std::size_t> Tasks;
+      };
+
+      //-------------------------------------------------------------------------------------------
+      void WorkerMain(unsigned a_nWorker)
+      {
+        std::size_t nJob = 0;
+
+        for (;;)
+        {
+          const task_type *pTask = nullptr;
+
+          {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_cvWork.wait(lock, [&]{ return m_bStop || m_nJob!=nJob; });
+            if (m_bStop)
+              return;
+
+            nJob = m_nJob;
+            pTask = m_pTask;
+          }
+
+          std::size_t nTask;
+          while (NextTask(a_nWorker, nTask))
+          {
+            if (m_bAbort)
+              continue;
+
+            try
+            {
+              (*pTask)(nTask, a_nWorker);
+            }
+            catch(...)
+            {
+              std::lock_guard<std::mutex> lock(m_Mutex);
+              if (!m_pException)
+                m_pException = std::current_exception();
+
+              m_bAbort = true;
+            }
+          }
+
+          std::lock_guard<std::mutex> lock(m_Mutex);
+          if (--m_nBusy==0)
+            m_cvDone.notify_one();
+        }
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Take a task from the own queue or steal one from another worker. */
+      bool NextTask(unsigned a_nWorker, std::size_t &a_nTask)
+      {
+        const std::size_t nWorkers = m_vQueue.size();
+
+        {
+          SQueue &queue = *m_vQueue[a_nWorker];
+          std::lock_guard<std::mutex> lock(queue.Mutex);
+          if (!queue.Tasks.empty())
+          {
+            a_nTask = queue.Tasks.front();
+            queue.Tasks.pop_front();
+            return true;
+          }
+        }
+
+        for (std::size_t i=1; i<nWorkers; ++i)
+        {
+          SQueue &queue = *m_vQueue[(a_nWorker + i) % nWorkers];
+          std::lock_guard<std::mutex> lock(queue.Mutex);
+          if (!queue.Tasks.empty())
+          {
+            a_nTask = queue.Tasks.back();
+            queue.Tasks.pop_back();
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      std::vector<std::unique_ptr<SQueue> > m_vQueue;
+      std::vector<std::thread> m_vThread;
+      std::mutex m_RunMutex;                 ///< Serializes the jobs
+      std::mutex m_Mutex;                    ///< Protects the job state below
+      std::condition_variable m_cvWork;
+      std::condition_variable m_cvDone;
+      const task_type *m_pTask;
+      std::size_t m_nJob;                    ///< Number of the current job
+      unsigned m_nBusy;                      ///< Workers not yet done with the current job
+      bool m_bStop;
+      std::atomic<bool> m_bAbort;
+      std::exception_ptr m_pException;       ///< First exception thrown by a task of the current job
+  };
+
+MUP_NAMESPACE_END
+
+#endif
@@ -42,6 +42,7 @@ MUP_NAMESPACE_START
     struct SFunDef 
     {
       typename parser_types<TValue, TString>::fun_type ptr;          ///> function pointers for up to three successive functions
+      typename parser_types<TValue, TString>::vfun_type vptr;        ///> optional version of ptr working on n lanes at once (bulk evaluation only)
       int argc;                      ///> number of arguments
       int prec;                      ///> precedence (only for operators)
       EOprtAssociativity asoc;       ///> associativity (only for operators)
@@ -55,13 +56,16 @@ MUP_NAMESPACE_START
     struct SValDef 
     {
       TValue *ptr;
+      TValue  mul;         ///< Factor applied to the variable, the token evaluates to *ptr * mul + fixed
       TValue  fixed;
+      std::size_t stride;  ///< Distance between two rows of a variable column (bulk evaluation only)
     };
 
     /** \brief Data for built in operators. */
     struct SOprtDef 
     {
       TValue *ptr;
+      std::size_t stride;  ///< Distance between two rows of the assignment target (bulk evaluation only)
     };
 
     ECmdCode Cmd;
@@ -81,7 +85,27 @@ MUP_NAMESPACE_START
       Cmd = cmVAL_EX;
       Ident = sIdent;
       Val.fixed = v;
+      Val.mul = 0;
       Val.ptr = &ParserBase<TValue, TString>::g_NullValue;
+      Val.stride = 0;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    void SetVar(TValue *pVar, const TString &sIdent, std::size_t nStride = 0)
+    {
+      Cmd = cmVAL_EX;
+      Ident = sIdent;
+      Val.ptr = pVar;
+      Val.mul = 1;
+      Val.fixed = 0;
+      Val.stride = nStride;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** rief Returns true if this is a value token without a variable part. */
+    bool IsConst() const
+    {
+      return Cmd==cmVAL_EX && Val.ptr==&ParserBase<TValue, TString>::g_NullValue;
     }
 
     //---------------------------------------------------------------------------------------------
@@ -90,7 +114,8 @@ MUP_NAMESPACE_START
                 int argc, 
                 EOprtAssociativity asoc, 
                 int prec, 
-                const TString &sIdent = TString())
+                const TString &sIdent = TString(),
+                typename parser_types<TValue, TString>::vfun_type pVFun = nullptr)
     {
       Token<TValue, TString> tok;
       Cmd = cmd;
@@ -99,6 +124,7 @@ MUP_NAMESPACE_START
       Fun.prec = prec;
       Fun.argc  = argc;
       Fun.ptr  = pFun;
+      Fun.vptr = pVFun;
     }
 
     //---------------------------------------------------------------------------------------------
@@ -107,6 +133,7 @@ MUP_NAMESPACE_START
       Cmd = eCmd;
       Ident = sIdent;
       Fun.ptr = nullptr;
+      Fun.vptr = nullptr;
     }
 
     //---------------------------------------------------------------------------------------------
@@ -114,6 +141,8 @@ MUP_NAMESPACE_START
     {
       assert(Cmd==cmVAL_EX);
       Val.ptr = &ParserBase<TValue, TString>::g_NullValue;
+      Val.mul = 0;
+      Val.stride = 0;
     }
   };
 } // namespace
@@ -29,12 +29,13 @@
 #include <list>
 #include <map>
 #include <string>
-#include <stack>
+#include <vector>
 
 //-------------------------------------------------------------------------------------------------
 #include "muParserDef.h"
 #include "muParserError.h"
 #include "muParserToken.h"
+#include "muParserSymbolTable.h"
 
 
 MUP_NAMESPACE_START
@@ -72,14 +73,26 @@ MUP_NAMESPACE_START
         ,m_pOprtDef(nullptr)
         ,m_pConstDef(nullptr)
         ,m_pVarDef(nullptr)
+        ,m_pVarStride(nullptr)
         ,m_pFactory(nullptr)
         ,m_pFactoryData(nullptr)
         ,m_vIdentFun()
         ,m_UsedVar()
+        ,m_vUsedConst()
         ,m_fZero(0)
         ,m_iBrackets(0)
         ,m_lastTok()
+        ,m_tok()
+        ,m_sTok()
         ,m_cArgSep(',')
+        ,m_bSymbolsValid(false)
+        ,m_OprtTrie()
+        ,m_InfixOprtTrie()
+        ,m_PostOprtTrie()
+        ,m_FunIndex()
+        ,m_ConstIndex()
+        ,m_VarIndex()
+        ,m_StrideIndex()
       {
         assert(m_pParser);
         SetParent(m_pParser);
@@ -156,18 +169,71 @@ MUP_NAMESPACE_START
         return m_UsedVar;
       }
 
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns true if a constant has been used by the formula read. */
+      bool IsUsedConst(const TString &a_sName) const
+      {
+        for (std::size_t i=0; i<m_vUsedConst.size(); ++i)
+        {
+          if (m_vUsedConst[i]->first==a_sName)
+            return true;
+        }
+
+        return false;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns true if the formula has been read completely.
+      
+        The used variables and constants are only known for a formula that has been read. 
+        Bytecode taken from a cache or loaded from a file does not pass the reader.
+      */
+      bool IsAtEnd() const
+      {
+        return m_iPos>0 && m_lastTok.Cmd==cmEND;
+      }
+
       //-------------------------------------------------------------------------------------------
       typename TString::value_type GetArgSep() const
       {
         return m_cArgSep;
       }
 
+      //-------------------------------------------------------------------------------------------
+      const std::list<identfun_type>& GetValIdent() const
+      {
+        return m_vIdentFun;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      facfun_type GetVarFactory() const
+      {
+        return m_pFactory;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      void* GetVarFactoryData() const
+      {
+        return m_pFactoryData;
+      }
+
       //-------------------------------------------------------------------------------------------
       void IgnoreUndefVar(bool bIgnore)
       {
         m_bIgnoreUndefVar = bIgnore;
       }
 
+      //-------------------------------------------------------------------------------------------
+      /** \brief Notify the reader of changed symbol definitions of the parent parser.
+      
+        The lookup structures are rebuilt before the next token is read. Rebuilding them 
+        lazily keeps the cost of defining many symbols in a row linear.
+      */
+      void InvalidateSymbols()
+      {
+        m_bSymbolsValid = false;
+      }
+
       //-------------------------------------------------------------------------------------------
       void ReInit()
       {
@@ -175,17 +241,27 @@ MUP_NAMESPACE_START
         m_iSynFlags = sfSTART_OF_LINE;
         m_iBrackets = 0;
         m_UsedVar.clear();
+        m_vUsedConst.clear();
         m_lastTok = token_type();
       }
 
       //-------------------------------------------------------------------------------------------
-      token_type ReadNextToken()
+      /** \brief Read the next token of the formula.
+      
+        The token returned is valid until the next call. Tokens are read in place from the
+        formula, the buffers of the reader are reused so reading does not allocate memory
+        once they have grown to the size of the longest identifier.
+      */
+      const token_type& ReadNextToken()
       {
         assert(m_pParser);
 
-        std::stack<int> FunArgs;
+        if (!m_bSymbolsValid)
+          BuildSymbols();
+
         const typename TString::value_type *szFormula = m_strFormula.c_str();
-        token_type tok;
+        token_type &tok = m_tok;
+        tok.Ident.clear();
 
         // Ignore all non printable characters when reading the expression
         while (szFormula[m_iPos]>0 && szFormula[m_iPos]<=0x20) 
@@ -215,13 +291,12 @@ MUP_NAMESPACE_START
         // 
         // !!! From this point on there is no exit without an exception possible...
         // 
-        TString strTok;
-        int iEnd = ExtractToken(m_pParser->c_sNameChars, strTok, m_iPos);
+        int iEnd = ExtractToken(m_pParser->c_sNameChars, m_iPos);
         if (iEnd!=m_iPos)
-          Error(ecUNASSIGNABLE_TOKEN, m_iPos, strTok);
+          Error(ecUNASSIGNABLE_TOKEN, m_iPos, GetTokStr(m_iPos, iEnd));
 
         Error(ecUNASSIGNABLE_TOKEN, m_iPos, m_strFormula.substr(m_iPos));
-        return token_type(); // never reached
+        return m_lastTok; // never reached
       }
 
 
@@ -276,9 +351,11 @@ MUP_NAMESPACE_START
         m_iSynFlags = a_Reader.m_iSynFlags;
     
         m_UsedVar         = a_Reader.m_UsedVar;
+        m_vUsedConst.clear();        // refers to the constants of the parser of a_Reader
         m_pFunDef         = a_Reader.m_pFunDef;
         m_pConstDef       = a_Reader.m_pConstDef;
         m_pVarDef         = a_Reader.m_pVarDef;
+        m_pVarStride      = a_Reader.m_pVarStride;
         m_pPostOprtDef    = a_Reader.m_pPostOprtDef;
         m_pInfixOprtDef   = a_Reader.m_pInfixOprtDef;
         m_pOprtDef        = a_Reader.m_pOprtDef;
@@ -288,6 +365,7 @@ MUP_NAMESPACE_START
         m_pFactoryData    = a_Reader.m_pFactoryData;
         m_iBrackets       = a_Reader.m_iBrackets;
         m_cArgSep         = a_Reader.m_cArgSep;
+        m_bSymbolsValid   = false;   // the lookup structures refer to the maps of a_Reader
       }
 
       //-------------------------------------------------------------------------------------------
@@ -299,45 +377,65 @@ MUP_NAMESPACE_START
         m_pInfixOprtDef = &a_pParent->m_InfixOprtDef;
         m_pPostOprtDef  = &a_pParent->m_PostOprtDef;
         m_pVarDef       = &a_pParent->m_VarDef;
+        m_pVarStride    = &a_pParent->m_VarStride;
         m_pConstDef     = &a_pParent->m_ConstDef;
+        m_bSymbolsValid = false;
       }
 
       //-------------------------------------------------------------------------------------------
-      int ExtractToken(const typename TString::value_type *a_szCharSet, TString &a_sTok, int a_iPos) const
+      /** \brief Create the lookup structures for the symbols of the parent parser. */
+      void BuildSymbols()
+      {
+        m_OprtTrie.Build(*m_pOprtDef);
+        m_InfixOprtTrie.Build(*m_pInfixOprtDef);
+        m_PostOprtTrie.Build(*m_pPostOprtDef);
+        m_FunIndex.Build(*m_pFunDef);
+        m_ConstIndex.Build(*m_pConstDef);
+        m_VarIndex.Build(*m_pVarDef);
+        m_StrideIndex.Build(*m_pVarStride);
+        m_bSymbolsValid = true;
+      }
+
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the end of the token starting at a_iPos made of characters in a_szCharSet.
+      
+        The token is the range [a_iPos, end) of the formula, use GetTokStr if its string is needed.
+      */
+      int ExtractToken(const typename TString::value_type *a_szCharSet, int a_iPos) const
       {
         int iEnd = (int)m_strFormula.find_first_not_of(a_szCharSet, a_iPos);
 
         if (iEnd==(int)TString::npos)
             iEnd = (int)m_strFormula.length();
     
-        // Assign token string if there was something found
-        if (a_iPos!=iEnd)
-          a_sTok = TString( m_strFormula.begin()+a_iPos, m_strFormula.begin()+iEnd);
-
         return iEnd;
       }
 
       //-------------------------------------------------------------------------------------------
-      int ExtractOperatorToken(TString &a_sTok, int a_iPos) const
+      int ExtractOperatorToken(int a_iPos) const
       {
-        int iEnd = (int)m_strFormula.find_first_not_of(m_pParser->c_sInfixOprtChars, a_iPos);
-        if (iEnd==(int)TString::npos)
-          iEnd = (int)m_strFormula.length();
-
-        // Assign token string if there was something found
+        int iEnd = ExtractToken(m_pParser->c_sInfixOprtChars, a_iPos);
         if (a_iPos!=iEnd)
-        {
-          a_sTok = TString( m_strFormula.begin() + a_iPos, m_strFormula.begin() + iEnd);
           return iEnd;
-        }
-        else
-        {
-          // There is still the chance of having to deal with an operator consisting exclusively
-          // of alphabetic characters.
-          return ExtractToken(_SL("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"), a_sTok, a_iPos);
-        }
+
+        // There is still the chance of having to deal with an operator consisting exclusively
+        // of alphabetic characters.
+        return ExtractToken(_SL("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"), a_iPos);
       }
 
+      //-------------------------------------------------------------------------------------------
+      /** \brief Returns the characters [a_iBegin, a_iEnd) of the formula.
+      
+        The string is stored in a buffer of the reader that is reused by the next call. Symbols
+        are looked up without it, it is only needed for names not defined in the parser.
+      */
+      const TString& GetTokStr(int a_iBegin, int a_iEnd)
+      {
+        m_sTok.assign(m_strFormula, a_iBegin, a_iEnd - a_iBegin);
+        return m_sTok;
+      }
+
+
       //-------------------------------------------------------------------------------------------
       /** \brief Check if a built in operator or other token can be found
           \param a_Tok  [out] Operator token if one is found. This can either be a binary operator or an infix operator token.
@@ -345,15 +443,14 @@ MUP_NAMESPACE_START
       */
       bool IsBuiltIn(token_type &a_Tok)
       {
-        const typename TString::value_type **const pOprtDef = m_pParser->c_DefaultOprt,
-                                            *const szFormula = m_strFormula.c_str();
+        const typename TString::value_type **const pOprtDef = m_pParser->c_DefaultOprt;
 
         // Compare token with function and operator strings
         // check string for operator/function
         for (int i=0; pOprtDef[i]; i++)
         {
           std::size_t len( std::char_traits<typename TString::value_type>::length(pOprtDef[i]) );
-          if ( TString(pOprtDef[i]) == TString(szFormula + m_iPos, szFormula + m_iPos + len) )
+          if ( m_strFormula.compare(m_iPos, len, pOprtDef[i])==0 )
           {
             switch(i)
             {
@@ -474,29 +571,23 @@ MUP_NAMESPACE_START
       */
       bool IsInfixOpTok(token_type &a_Tok)
       {
-        TString sTok;
-        int iEnd = ExtractToken(m_pParser->c_sInfixOprtChars, sTok, m_iPos);
+        int iEnd = ExtractToken(m_pParser->c_sInfixOprtChars, m_iPos);
         if (iEnd==m_iPos)
           return false;
 
-        // iteraterate over all postfix operator strings
-        auto it = m_pInfixOprtDef->rbegin();
-        for ( ; it!=m_pInfixOprtDef->rend(); ++it)
-        {
-          if (sTok.find(it->first)!=0)
-            continue;
+        // find the longest infix operator the token starts with
+        auto item = m_InfixOprtTrie.Match(m_strFormula.data() + m_iPos, iEnd - m_iPos);
+        if (item==nullptr)
+          return false;
 
-          a_Tok = it->second; //.Set(it->second, it->first);
-          m_iPos += (int)it->first.length();
+        a_Tok = item->second;
+        m_iPos += (int)item->first.length();
 
-          if (m_iSynFlags & noINFIXOP) 
-            Error(ecUNEXPECTED_OPERATOR, m_iPos, a_Tok.Ident);
+        if (m_iSynFlags & noINFIXOP) 
+          Error(ecUNEXPECTED_OPERATOR, m_iPos, a_Tok.Ident);
 
-          m_iSynFlags = noPOSTOP | noINFIXOP | noOPT | noBC | noASSIGN;
-          return true;
-        }
-
-        return false;
+        m_iSynFlags = noPOSTOP | noINFIXOP | noOPT | noBC | noASSIGN;
+        return true;
       }
 
       //-------------------------------------------------------------------------------------------
@@ -508,13 +599,12 @@ MUP_NAMESPACE_START
       */
       bool IsFunTok(token_type &a_Tok)
       {
-        TString strTok;
-        int iEnd = ExtractToken(m_pParser->c_sNameChars, strTok, m_iPos);
+        int iEnd = ExtractToken(m_pParser->c_sNameChars, m_iPos);
         if (iEnd==m_iPos)
           return false;
 
-        auto item = m_pFunDef->find(strTok);
-        if (item==m_pFunDef->end())
+        auto item = m_FunIndex.Find(m_strFormula.data() + m_iPos, iEnd - m_iPos);
+        if (item==nullptr)
           return false;
 
         // Check if the next sign is an opening bracket
@@ -539,10 +629,7 @@ MUP_NAMESPACE_START
       */
       bool IsOprt(token_type &a_Tok)
       {
-        const typename TString::value_type *const szExpr = m_strFormula.c_str();
-        TString strTok;
-
-        int iEnd = ExtractOperatorToken(strTok, m_iPos);
+        int iEnd = ExtractOperatorToken(m_iPos);
         if (iEnd==m_iPos)
           return false;
 
@@ -550,50 +637,34 @@ MUP_NAMESPACE_START
         const typename TString::value_type **const pOprtDef = m_pParser->c_DefaultOprt;
         for (int i=0; pOprtDef[i]; ++i)
         {
-          if (TString(pOprtDef[i])==strTok)
+          if (m_strFormula.compare(m_iPos, iEnd - m_iPos, pOprtDef[i])==0)
             return false;
         }
 
         // Note:
-        // All tokens in oprt_bin_maptype are have been sorted by their length
-        // Long operators must come first! Otherwise short names (like: "add") that
+        // Long operators must be found first! Otherwise short names (like: "add") that
         // are part of long token names (like: "add123") will be found instead 
-        // of the long ones.
-        // Length sorting is done with ascending length so we use a reverse iterator here.
-        auto it = m_pOprtDef->rbegin();
-        for ( ; it!=m_pOprtDef->rend(); ++it)
-        {
-          const TString &sID = it->first;
-          if ( sID == TString(szExpr + m_iPos, szExpr + m_iPos + sID.length()) )
-          {
-            a_Tok = it->second;
-            //a_Tok.Set(it->second, strTok);
+        // of the long ones. The trie returns the longest operator name at the current
+        // position.
+        auto item = m_OprtTrie.Match(m_strFormula.data() + m_iPos, m_strFormula.length() - m_iPos);
+        if (item==nullptr)
+          return false;
 
-            // operator was found
-            if (m_iSynFlags & noOPT) 
-            {
-              // An operator was found but is not expected to occur at
-              // this position of the formula, maybe it is an infix 
-              // operator, not a binary operator. Both operator types
-              // can share characters in their identifiers.
-              if ( IsInfixOpTok(a_Tok) ) 
-                return true;
-              else
-              {
-                // nope, no infix operator
-                return false;
-                //Error(ecUNEXPECTED_OPERATOR, m_iPos, a_Tok.GetAsString()); 
-              }
-
-            }
-
-            m_iPos += (int)sID.length();
-            m_iSynFlags  = noBC | noOPT | noARG_SEP | noPOSTOP | noEND | noBC | noASSIGN;
-            return true;
-          }
+        a_Tok = item->second;
+
+        // operator was found
+        if (m_iSynFlags & noOPT) 
+        {
+          // An operator was found but is not expected to occur at
+          // this position of the formula, maybe it is an infix 
+          // operator, not a binary operator. Both operator types
+          // can share characters in their identifiers.
+          return IsInfixOpTok(a_Tok);
         }
 
-        return false;
+        m_iPos += (int)item->first.length();
+        m_iSynFlags  = noBC | noOPT | noARG_SEP | noPOSTOP | noEND | noBC | noASSIGN;
+        return true;
       }
 
       //-------------------------------------------------------------------------------------------
@@ -620,28 +691,20 @@ MUP_NAMESPACE_START
         // token readers.
     
         // Test if there could be a postfix operator
-        TString sTok;
-        int iEnd = ExtractToken(m_pParser->c_sOprtChars, sTok, m_iPos);
+        int iEnd = ExtractToken(m_pParser->c_sOprtChars, m_iPos);
         if (iEnd==m_iPos)
           return false;
 
-        // iteraterate over all postfix operator strings
-        auto it = m_pPostOprtDef->rbegin();
-        for ( ; it!=m_pPostOprtDef->rend(); ++it)
-        {
-          if (sTok.find(it->first)!=0)
-            continue;
-
-          //a_Tok.Set(it->second, sTok);
-          a_Tok = it->second;
-
-  	      m_iPos += (int)it->first.length();
+        // find the longest postfix operator the token starts with
+        auto item = m_PostOprtTrie.Match(m_strFormula.data() + m_iPos, iEnd - m_iPos);
+        if (item==nullptr)
+          return false;
 
-          m_iSynFlags = noVAL | noVAR | noFUN | noBO | noPOSTOP | noASSIGN;
-          return true;
-        }
+        a_Tok = item->second;
+        m_iPos += (int)item->first.length();
 
-        return false;
+        m_iSynFlags = noVAL | noVAR | noFUN | noBO | noPOSTOP | noASSIGN;
+        return true;
       }
 
       //-------------------------------------------------------------------------------------------
@@ -657,18 +720,19 @@ MUP_NAMESPACE_START
         assert(m_pConstDef);
         assert(m_pParser);
 
-        TString strTok;
         TValue fVal(0);
         int iEnd(0);
     
         // 2.) Check for user defined constant
         // Read everything that could be a constant name
-        iEnd = ExtractToken(m_pParser->c_sNameChars, strTok, m_iPos);
+        iEnd = ExtractToken(m_pParser->c_sNameChars, m_iPos);
         if (iEnd!=m_iPos)
         {
-          auto item = m_pConstDef->find(strTok);
-          if (item!=m_pConstDef->end())
+          auto item = m_ConstIndex.Find(m_strFormula.data() + m_iPos, iEnd - m_iPos);
+          if (item!=nullptr)
           {
+            const TString &strTok = item->first;
+            m_vUsedConst.push_back(item);
             m_iPos = iEnd;
             a_Tok.SetVal(item->second, strTok);
 
@@ -688,7 +752,7 @@ MUP_NAMESPACE_START
           int iStart = m_iPos;
           if ( (*item)(m_strFormula.c_str() + m_iPos, &m_iPos, &fVal)==1 )
           {
-            strTok.assign(m_strFormula.c_str(), iStart, m_iPos);
+            const TString &strTok = GetTokStr(iStart, m_iPos);
             if (m_iSynFlags & noVAL)
               Error(ecUNEXPECTED_VAL, m_iPos - (int)strTok.length(), strTok);
 
@@ -711,25 +775,28 @@ MUP_NAMESPACE_START
         if (!m_pVarDef->size())
           return false;
 
-        TString strTok;
-        int iEnd = ExtractToken(m_pParser->c_sNameChars, strTok, m_iPos);
+        int iEnd = ExtractToken(m_pParser->c_sNameChars, m_iPos);
         if (iEnd==m_iPos)
           return false;
 
-        auto item =  m_pVarDef->find(strTok);
-        if (item==m_pVarDef->end())
+        auto item = m_VarIndex.Find(m_strFormula.data() + m_iPos, iEnd - m_iPos);
+        if (item==nullptr)
           return false;
 
+        const TString &strTok = item->first;
+
         if (m_iSynFlags & noVAR)
           Error(ecUNEXPECTED_VAR, m_iPos, strTok);
 
         m_iPos = iEnd;
-        a_Tok.Cmd = cmVAL_EX;
-        a_Tok.Ident = strTok;
-        a_Tok.Val.ptr = item->second;
-        a_Tok.Val.fixed = 0;
+        a_Tok.SetVar(item->second, strTok);
         m_UsedVar[item->first] = item->second;  // Add variable to used-var-list
 
+        // Variables bound to a column carry their stride for bulk evaluation
+        auto stride = m_StrideIndex.Find(strTok.data(), strTok.length());
+        if (stride!=nullptr)
+          a_Tok.Val.stride = stride->second;
+
         m_iSynFlags = noVAL | noVAR | noFUN | noBO | noINFIXOP;
         return true;
       }
@@ -743,11 +810,12 @@ MUP_NAMESPACE_START
       */
       bool IsUndefVarTok(token_type &a_Tok)
       {
-        TString strTok;
-        int iEnd( ExtractToken(m_pParser->c_sNameChars, strTok, m_iPos) );
+        int iEnd( ExtractToken(m_pParser->c_sNameChars, m_iPos) );
         if ( iEnd==m_iPos )
           return false;
 
+        const TString &strTok = GetTokStr(m_iPos, iEnd);
+
         if (m_iSynFlags & noVAR)
           Error(ecUNEXPECTED_VAR, m_iPos - (int)a_Tok.Ident.length(), strTok);
 
@@ -755,9 +823,7 @@ MUP_NAMESPACE_START
         if (m_pFactory)
         {
           TValue *pVar = m_pFactory(strTok.c_str(), m_pFactoryData);
-          a_Tok.Cmd = cmVAL_EX;
-          a_Tok.Ident = strTok;
-          a_Tok.Val.ptr = pVar;
+          a_Tok.SetVar(pVar, strTok);
 
           // Do not use m_pParser->DefineVar( strTok, fVar );
           // in order to define the new variable, it will clear the
@@ -766,13 +832,12 @@ MUP_NAMESPACE_START
           // This is safe because the new variable can never override an existing one
           // because they are checked first!
           (*m_pVarDef)[strTok] = pVar;
+          m_VarIndex.Insert(&*m_pVarDef->find(strTok));
           m_UsedVar[strTok] = pVar;  // Add variable to used-var-list
         }
         else
         {
-          a_Tok.Cmd = cmVAL_EX;
-          a_Tok.Ident = strTok;
-          a_Tok.Val.ptr = (TValue*)&m_fZero;
+          a_Tok.SetVar((TValue*)&m_fZero, strTok);
           m_UsedVar[strTok] = 0;  // Add variable to used-var-list
         }
 
@@ -801,7 +866,7 @@ MUP_NAMESPACE_START
       }
 
       //---------------------------------------------------------------------------
-      token_type& SaveBeforeReturn(const token_type &tok)
+      const token_type& SaveBeforeReturn(const token_type &tok)
       {
         m_lastTok = tok;
         return m_lastTok;
@@ -819,14 +884,28 @@ MUP_NAMESPACE_START
       const std::map<TString, token_type> *m_pOprtDef;
       const std::map<TString, TValue> *m_pConstDef;
       std::map<TString, TValue*> *m_pVarDef;  ///< The only non const pointer to parser internals
+      const std::map<TString, std::size_t> *m_pVarStride;
       facfun_type m_pFactory;
       void *m_pFactoryData;
       std::list<identfun_type> m_vIdentFun;   ///< Value token identification function
       std::map<TString, TValue*> m_UsedVar;   ///< A map with pointers to all variables used in the current expression
+      std::vector<const typename std::map<TString, TValue>::value_type*> m_vUsedConst;  ///< Constants used in the current expression
       TValue m_fZero;                         ///< Dummy value of zero, referenced by undefined variables
       int m_iBrackets;
       token_type m_lastTok;                   ///< A buffer for storing the last token read for reference in the next parsing step
+      token_type m_tok;                       ///< The token being read, reused to avoid allocations
+      TString m_sTok;                         ///< Buffer for the string of the current token, see GetTokStr
       typename TString::value_type m_cArgSep;          ///< The character used for separating function arguments
+
+      // Lookup structures for the symbols of the parent parser, see BuildSymbols
+      bool m_bSymbolsValid;
+      ParserSymbolTrie<TString, token_type> m_OprtTrie;
+      ParserSymbolTrie<TString, token_type> m_InfixOprtTrie;
+      ParserSymbolTrie<TString, token_type> m_PostOprtTrie;
+      ParserSymbolIndex<TString, token_type> m_FunIndex;
+      ParserSymbolIndex<TString, TValue> m_ConstIndex;
+      ParserSymbolIndex<TString, TValue*> m_VarIndex;
+      ParserSymbolIndex<TString, std::size_t> m_StrideIndex;
   };
 } // namespace mu
 
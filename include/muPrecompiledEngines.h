@@ -1,2056 +1,172 @@
-  /*   0|   1|   1*/ ParseFunc1(         V, VAL);
-  /*   1|   2|   2*/ ParseFunc2(        VF, VAL, FUN);
-  /*   2|   4|   3*/ ParseFunc3(       VFF, VAL, FUN, FUN);
-  /*   3|   6|   3*/ ParseFunc3(       VVF, VAL, VAL, FUN);
-  /*   4|   8|   4*/ ParseFunc4(      VFFF, VAL, FUN, FUN, FUN);
-  /*   5|  10|   4*/ ParseFunc4(      VFVF, VAL, FUN, VAL, FUN);
-  /*   6|  12|   4*/ ParseFunc4(      VVFF, VAL, VAL, FUN, FUN);
-  /*   7|  14|   4*/ ParseFunc4(      VVVF, VAL, VAL, VAL, FUN);
-  /*   8|  16|   5*/ ParseFunc5(     VFFFF, VAL, FUN, FUN, FUN, FUN);
-  /*   9|  18|   5*/ ParseFunc5(     VFFVF, VAL, FUN, FUN, VAL, FUN);
-  /*  10|  20|   5*/ ParseFunc5(     VFVFF, VAL, FUN, VAL, FUN, FUN);
-  /*  11|  22|   5*/ ParseFunc5(     VFVVF, VAL, FUN, VAL, VAL, FUN);
-  /*  12|  24|   5*/ ParseFunc5(     VVFFF, VAL, VAL, FUN, FUN, FUN);
-  /*  13|  26|   5*/ ParseFunc5(     VVFVF, VAL, VAL, FUN, VAL, FUN);
-  /*  14|  28|   5*/ ParseFunc5(     VVVFF, VAL, VAL, VAL, FUN, FUN);
-  /*  15|  30|   5*/ ParseFunc5(     VVVVF, VAL, VAL, VAL, VAL, FUN);
-  /*  16|  32|   6*/ ParseFunc6(    VFFFFF, VAL, FUN, FUN, FUN, FUN, FUN);
-  /*  17|  34|   6*/ ParseFunc6(    VFFFVF, VAL, FUN, FUN, FUN, VAL, FUN);
-  /*  18|  36|   6*/ ParseFunc6(    VFFVFF, VAL, FUN, FUN, VAL, FUN, FUN);
-  /*  19|  38|   6*/ ParseFunc6(    VFFVVF, VAL, FUN, FUN, VAL, VAL, FUN);
-  /*  20|  40|   6*/ ParseFunc6(    VFVFFF, VAL, FUN, VAL, FUN, FUN, FUN);
-  /*  21|  42|   6*/ ParseFunc6(    VFVFVF, VAL, FUN, VAL, FUN, VAL, FUN);
-  /*  22|  44|   6*/ ParseFunc6(    VFVVFF, VAL, FUN, VAL, VAL, FUN, FUN);
-  /*  23|  46|   6*/ ParseFunc6(    VFVVVF, VAL, FUN, VAL, VAL, VAL, FUN);
-  /*  24|  48|   6*/ ParseFunc6(    VVFFFF, VAL, VAL, FUN, FUN, FUN, FUN);
-  /*  25|  50|   6*/ ParseFunc6(    VVFFVF, VAL, VAL, FUN, FUN, VAL, FUN);
-  /*  26|  52|   6*/ ParseFunc6(    VVFVFF, VAL, VAL, FUN, VAL, FUN, FUN);
-  /*  27|  54|   6*/ ParseFunc6(    VVFVVF, VAL, VAL, FUN, VAL, VAL, FUN);
-  /*  28|  56|   6*/ ParseFunc6(    VVVFFF, VAL, VAL, VAL, FUN, FUN, FUN);
-  /*  29|  58|   6*/ ParseFunc6(    VVVFVF, VAL, VAL, VAL, FUN, VAL, FUN);
-  /*  30|  60|   6*/ ParseFunc6(    VVVVFF, VAL, VAL, VAL, VAL, FUN, FUN);
-  /*  31|  62|   6*/ ParseFunc6(    VVVVVF, VAL, VAL, VAL, VAL, VAL, FUN);
-  /*  32|  64|   7*/ ParseFunc7(   VFFFFFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /*  33|  66|   7*/ ParseFunc7(   VFFFFVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /*  34|  68|   7*/ ParseFunc7(   VFFFVFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /*  35|  70|   7*/ ParseFunc7(   VFFFVVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /*  36|  72|   7*/ ParseFunc7(   VFFVFFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /*  37|  74|   7*/ ParseFunc7(   VFFVFVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /*  38|  76|   7*/ ParseFunc7(   VFFVVFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /*  39|  78|   7*/ ParseFunc7(   VFFVVVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /*  40|  80|   7*/ ParseFunc7(   VFVFFFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /*  41|  82|   7*/ ParseFunc7(   VFVFFVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /*  42|  84|   7*/ ParseFunc7(   VFVFVFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /*  43|  86|   7*/ ParseFunc7(   VFVFVVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /*  44|  88|   7*/ ParseFunc7(   VFVVFFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /*  45|  90|   7*/ ParseFunc7(   VFVVFVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /*  46|  92|   7*/ ParseFunc7(   VFVVVFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /*  47|  94|   7*/ ParseFunc7(   VFVVVVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /*  48|  96|   7*/ ParseFunc7(   VVFFFFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /*  49|  98|   7*/ ParseFunc7(   VVFFFVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /*  50| 100|   7*/ ParseFunc7(   VVFFVFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /*  51| 102|   7*/ ParseFunc7(   VVFFVVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /*  52| 104|   7*/ ParseFunc7(   VVFVFFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /*  53| 106|   7*/ ParseFunc7(   VVFVFVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /*  54| 108|   7*/ ParseFunc7(   VVFVVFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /*  55| 110|   7*/ ParseFunc7(   VVFVVVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /*  56| 112|   7*/ ParseFunc7(   VVVFFFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /*  57| 114|   7*/ ParseFunc7(   VVVFFVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /*  58| 116|   7*/ ParseFunc7(   VVVFVFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /*  59| 118|   7*/ ParseFunc7(   VVVFVVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /*  60| 120|   7*/ ParseFunc7(   VVVVFFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /*  61| 122|   7*/ ParseFunc7(   VVVVFVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /*  62| 124|   7*/ ParseFunc7(   VVVVVFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /*  63| 126|   7*/ ParseFunc7(   VVVVVVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /*  64| 128|   8*/ ParseFunc8(  VFFFFFFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /*  65| 130|   8*/ ParseFunc8(  VFFFFFVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /*  66| 132|   8*/ ParseFunc8(  VFFFFVFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /*  67| 134|   8*/ ParseFunc8(  VFFFFVVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /*  68| 136|   8*/ ParseFunc8(  VFFFVFFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /*  69| 138|   8*/ ParseFunc8(  VFFFVFVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /*  70| 140|   8*/ ParseFunc8(  VFFFVVFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /*  71| 142|   8*/ ParseFunc8(  VFFFVVVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /*  72| 144|   8*/ ParseFunc8(  VFFVFFFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /*  73| 146|   8*/ ParseFunc8(  VFFVFFVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /*  74| 148|   8*/ ParseFunc8(  VFFVFVFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /*  75| 150|   8*/ ParseFunc8(  VFFVFVVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /*  76| 152|   8*/ ParseFunc8(  VFFVVFFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /*  77| 154|   8*/ ParseFunc8(  VFFVVFVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /*  78| 156|   8*/ ParseFunc8(  VFFVVVFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /*  79| 158|   8*/ ParseFunc8(  VFFVVVVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /*  80| 160|   8*/ ParseFunc8(  VFVFFFFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /*  81| 162|   8*/ ParseFunc8(  VFVFFFVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /*  82| 164|   8*/ ParseFunc8(  VFVFFVFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /*  83| 166|   8*/ ParseFunc8(  VFVFFVVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /*  84| 168|   8*/ ParseFunc8(  VFVFVFFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /*  85| 170|   8*/ ParseFunc8(  VFVFVFVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /*  86| 172|   8*/ ParseFunc8(  VFVFVVFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /*  87| 174|   8*/ ParseFunc8(  VFVFVVVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /*  88| 176|   8*/ ParseFunc8(  VFVVFFFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /*  89| 178|   8*/ ParseFunc8(  VFVVFFVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /*  90| 180|   8*/ ParseFunc8(  VFVVFVFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /*  91| 182|   8*/ ParseFunc8(  VFVVFVVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /*  92| 184|   8*/ ParseFunc8(  VFVVVFFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /*  93| 186|   8*/ ParseFunc8(  VFVVVFVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /*  94| 188|   8*/ ParseFunc8(  VFVVVVFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /*  95| 190|   8*/ ParseFunc8(  VFVVVVVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /*  96| 192|   8*/ ParseFunc8(  VVFFFFFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /*  97| 194|   8*/ ParseFunc8(  VVFFFFVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /*  98| 196|   8*/ ParseFunc8(  VVFFFVFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /*  99| 198|   8*/ ParseFunc8(  VVFFFVVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 100| 200|   8*/ ParseFunc8(  VVFFVFFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 101| 202|   8*/ ParseFunc8(  VVFFVFVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 102| 204|   8*/ ParseFunc8(  VVFFVVFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 103| 206|   8*/ ParseFunc8(  VVFFVVVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 104| 208|   8*/ ParseFunc8(  VVFVFFFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 105| 210|   8*/ ParseFunc8(  VVFVFFVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 106| 212|   8*/ ParseFunc8(  VVFVFVFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 107| 214|   8*/ ParseFunc8(  VVFVFVVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 108| 216|   8*/ ParseFunc8(  VVFVVFFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 109| 218|   8*/ ParseFunc8(  VVFVVFVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 110| 220|   8*/ ParseFunc8(  VVFVVVFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 111| 222|   8*/ ParseFunc8(  VVFVVVVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 112| 224|   8*/ ParseFunc8(  VVVFFFFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 113| 226|   8*/ ParseFunc8(  VVVFFFVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 114| 228|   8*/ ParseFunc8(  VVVFFVFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 115| 230|   8*/ ParseFunc8(  VVVFFVVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 116| 232|   8*/ ParseFunc8(  VVVFVFFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 117| 234|   8*/ ParseFunc8(  VVVFVFVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 118| 236|   8*/ ParseFunc8(  VVVFVVFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 119| 238|   8*/ ParseFunc8(  VVVFVVVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 120| 240|   8*/ ParseFunc8(  VVVVFFFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 121| 242|   8*/ ParseFunc8(  VVVVFFVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 122| 244|   8*/ ParseFunc8(  VVVVFVFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 123| 246|   8*/ ParseFunc8(  VVVVFVVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 124| 248|   8*/ ParseFunc8(  VVVVVFFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 125| 250|   8*/ ParseFunc8(  VVVVVFVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 126| 252|   8*/ ParseFunc8(  VVVVVVFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 127| 254|   8*/ ParseFunc8(  VVVVVVVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 128| 256|   9*/ ParseFunc9( VFFFFFFFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 129| 258|   9*/ ParseFunc9( VFFFFFFVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 130| 260|   9*/ ParseFunc9( VFFFFFVFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 131| 262|   9*/ ParseFunc9( VFFFFFVVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 132| 264|   9*/ ParseFunc9( VFFFFVFFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 133| 266|   9*/ ParseFunc9( VFFFFVFVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 134| 268|   9*/ ParseFunc9( VFFFFVVFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 135| 270|   9*/ ParseFunc9( VFFFFVVVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 136| 272|   9*/ ParseFunc9( VFFFVFFFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 137| 274|   9*/ ParseFunc9( VFFFVFFVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 138| 276|   9*/ ParseFunc9( VFFFVFVFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 139| 278|   9*/ ParseFunc9( VFFFVFVVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 140| 280|   9*/ ParseFunc9( VFFFVVFFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 141| 282|   9*/ ParseFunc9( VFFFVVFVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 142| 284|   9*/ ParseFunc9( VFFFVVVFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 143| 286|   9*/ ParseFunc9( VFFFVVVVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 144| 288|   9*/ ParseFunc9( VFFVFFFFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 145| 290|   9*/ ParseFunc9( VFFVFFFVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 146| 292|   9*/ ParseFunc9( VFFVFFVFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 147| 294|   9*/ ParseFunc9( VFFVFFVVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 148| 296|   9*/ ParseFunc9( VFFVFVFFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 149| 298|   9*/ ParseFunc9( VFFVFVFVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 150| 300|   9*/ ParseFunc9( VFFVFVVFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 151| 302|   9*/ ParseFunc9( VFFVFVVVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 152| 304|   9*/ ParseFunc9( VFFVVFFFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 153| 306|   9*/ ParseFunc9( VFFVVFFVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 154| 308|   9*/ ParseFunc9( VFFVVFVFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 155| 310|   9*/ ParseFunc9( VFFVVFVVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 156| 312|   9*/ ParseFunc9( VFFVVVFFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 157| 314|   9*/ ParseFunc9( VFFVVVFVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 158| 316|   9*/ ParseFunc9( VFFVVVVFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 159| 318|   9*/ ParseFunc9( VFFVVVVVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 160| 320|   9*/ ParseFunc9( VFVFFFFFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 161| 322|   9*/ ParseFunc9( VFVFFFFVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 162| 324|   9*/ ParseFunc9( VFVFFFVFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 163| 326|   9*/ ParseFunc9( VFVFFFVVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 164| 328|   9*/ ParseFunc9( VFVFFVFFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 165| 330|   9*/ ParseFunc9( VFVFFVFVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 166| 332|   9*/ ParseFunc9( VFVFFVVFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 167| 334|   9*/ ParseFunc9( VFVFFVVVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 168| 336|   9*/ ParseFunc9( VFVFVFFFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 169| 338|   9*/ ParseFunc9( VFVFVFFVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 170| 340|   9*/ ParseFunc9( VFVFVFVFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 171| 342|   9*/ ParseFunc9( VFVFVFVVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 172| 344|   9*/ ParseFunc9( VFVFVVFFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 173| 346|   9*/ ParseFunc9( VFVFVVFVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 174| 348|   9*/ ParseFunc9( VFVFVVVFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 175| 350|   9*/ ParseFunc9( VFVFVVVVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 176| 352|   9*/ ParseFunc9( VFVVFFFFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 177| 354|   9*/ ParseFunc9( VFVVFFFVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 178| 356|   9*/ ParseFunc9( VFVVFFVFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 179| 358|   9*/ ParseFunc9( VFVVFFVVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 180| 360|   9*/ ParseFunc9( VFVVFVFFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 181| 362|   9*/ ParseFunc9( VFVVFVFVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 182| 364|   9*/ ParseFunc9( VFVVFVVFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 183| 366|   9*/ ParseFunc9( VFVVFVVVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 184| 368|   9*/ ParseFunc9( VFVVVFFFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 185| 370|   9*/ ParseFunc9( VFVVVFFVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 186| 372|   9*/ ParseFunc9( VFVVVFVFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 187| 374|   9*/ ParseFunc9( VFVVVFVVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 188| 376|   9*/ ParseFunc9( VFVVVVFFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 189| 378|   9*/ ParseFunc9( VFVVVVFVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 190| 380|   9*/ ParseFunc9( VFVVVVVFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 191| 382|   9*/ ParseFunc9( VFVVVVVVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 192| 384|   9*/ ParseFunc9( VVFFFFFFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 193| 386|   9*/ ParseFunc9( VVFFFFFVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 194| 388|   9*/ ParseFunc9( VVFFFFVFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 195| 390|   9*/ ParseFunc9( VVFFFFVVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 196| 392|   9*/ ParseFunc9( VVFFFVFFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 197| 394|   9*/ ParseFunc9( VVFFFVFVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 198| 396|   9*/ ParseFunc9( VVFFFVVFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 199| 398|   9*/ ParseFunc9( VVFFFVVVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 200| 400|   9*/ ParseFunc9( VVFFVFFFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 201| 402|   9*/ ParseFunc9( VVFFVFFVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 202| 404|   9*/ ParseFunc9( VVFFVFVFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 203| 406|   9*/ ParseFunc9( VVFFVFVVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 204| 408|   9*/ ParseFunc9( VVFFVVFFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 205| 410|   9*/ ParseFunc9( VVFFVVFVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 206| 412|   9*/ ParseFunc9( VVFFVVVFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 207| 414|   9*/ ParseFunc9( VVFFVVVVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 208| 416|   9*/ ParseFunc9( VVFVFFFFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 209| 418|   9*/ ParseFunc9( VVFVFFFVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 210| 420|   9*/ ParseFunc9( VVFVFFVFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 211| 422|   9*/ ParseFunc9( VVFVFFVVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 212| 424|   9*/ ParseFunc9( VVFVFVFFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 213| 426|   9*/ ParseFunc9( VVFVFVFVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 214| 428|   9*/ ParseFunc9( VVFVFVVFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 215| 430|   9*/ ParseFunc9( VVFVFVVVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 216| 432|   9*/ ParseFunc9( VVFVVFFFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 217| 434|   9*/ ParseFunc9( VVFVVFFVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 218| 436|   9*/ ParseFunc9( VVFVVFVFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 219| 438|   9*/ ParseFunc9( VVFVVFVVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 220| 440|   9*/ ParseFunc9( VVFVVVFFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 221| 442|   9*/ ParseFunc9( VVFVVVFVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 222| 444|   9*/ ParseFunc9( VVFVVVVFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 223| 446|   9*/ ParseFunc9( VVFVVVVVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 224| 448|   9*/ ParseFunc9( VVVFFFFFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 225| 450|   9*/ ParseFunc9( VVVFFFFVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 226| 452|   9*/ ParseFunc9( VVVFFFVFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 227| 454|   9*/ ParseFunc9( VVVFFFVVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 228| 456|   9*/ ParseFunc9( VVVFFVFFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 229| 458|   9*/ ParseFunc9( VVVFFVFVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 230| 460|   9*/ ParseFunc9( VVVFFVVFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 231| 462|   9*/ ParseFunc9( VVVFFVVVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 232| 464|   9*/ ParseFunc9( VVVFVFFFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 233| 466|   9*/ ParseFunc9( VVVFVFFVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 234| 468|   9*/ ParseFunc9( VVVFVFVFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 235| 470|   9*/ ParseFunc9( VVVFVFVVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 236| 472|   9*/ ParseFunc9( VVVFVVFFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 237| 474|   9*/ ParseFunc9( VVVFVVFVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 238| 476|   9*/ ParseFunc9( VVVFVVVFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 239| 478|   9*/ ParseFunc9( VVVFVVVVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 240| 480|   9*/ ParseFunc9( VVVVFFFFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 241| 482|   9*/ ParseFunc9( VVVVFFFVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 242| 484|   9*/ ParseFunc9( VVVVFFVFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 243| 486|   9*/ ParseFunc9( VVVVFFVVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 244| 488|   9*/ ParseFunc9( VVVVFVFFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 245| 490|   9*/ ParseFunc9( VVVVFVFVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 246| 492|   9*/ ParseFunc9( VVVVFVVFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 247| 494|   9*/ ParseFunc9( VVVVFVVVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 248| 496|   9*/ ParseFunc9( VVVVVFFFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 249| 498|   9*/ ParseFunc9( VVVVVFFVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 250| 500|   9*/ ParseFunc9( VVVVVFVFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 251| 502|   9*/ ParseFunc9( VVVVVFVVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 252| 504|   9*/ ParseFunc9( VVVVVVFFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 253| 506|   9*/ ParseFunc9( VVVVVVFVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 254| 508|   9*/ ParseFunc9( VVVVVVVFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 255| 510|   9*/ ParseFunc9( VVVVVVVVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 256| 512|  10*/ ParseFunc10(VFFFFFFFFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 257| 514|  10*/ ParseFunc10(VFFFFFFFVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 258| 516|  10*/ ParseFunc10(VFFFFFFVFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 259| 518|  10*/ ParseFunc10(VFFFFFFVVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 260| 520|  10*/ ParseFunc10(VFFFFFVFFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 261| 522|  10*/ ParseFunc10(VFFFFFVFVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 262| 524|  10*/ ParseFunc10(VFFFFFVVFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 263| 526|  10*/ ParseFunc10(VFFFFFVVVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 264| 528|  10*/ ParseFunc10(VFFFFVFFFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 265| 530|  10*/ ParseFunc10(VFFFFVFFVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 266| 532|  10*/ ParseFunc10(VFFFFVFVFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 267| 534|  10*/ ParseFunc10(VFFFFVFVVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 268| 536|  10*/ ParseFunc10(VFFFFVVFFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 269| 538|  10*/ ParseFunc10(VFFFFVVFVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 270| 540|  10*/ ParseFunc10(VFFFFVVVFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 271| 542|  10*/ ParseFunc10(VFFFFVVVVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 272| 544|  10*/ ParseFunc10(VFFFVFFFFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 273| 546|  10*/ ParseFunc10(VFFFVFFFVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 274| 548|  10*/ ParseFunc10(VFFFVFFVFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 275| 550|  10*/ ParseFunc10(VFFFVFFVVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 276| 552|  10*/ ParseFunc10(VFFFVFVFFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 277| 554|  10*/ ParseFunc10(VFFFVFVFVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 278| 556|  10*/ ParseFunc10(VFFFVFVVFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 279| 558|  10*/ ParseFunc10(VFFFVFVVVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 280| 560|  10*/ ParseFunc10(VFFFVVFFFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 281| 562|  10*/ ParseFunc10(VFFFVVFFVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 282| 564|  10*/ ParseFunc10(VFFFVVFVFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 283| 566|  10*/ ParseFunc10(VFFFVVFVVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 284| 568|  10*/ ParseFunc10(VFFFVVVFFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 285| 570|  10*/ ParseFunc10(VFFFVVVFVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 286| 572|  10*/ ParseFunc10(VFFFVVVVFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 287| 574|  10*/ ParseFunc10(VFFFVVVVVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 288| 576|  10*/ ParseFunc10(VFFVFFFFFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 289| 578|  10*/ ParseFunc10(VFFVFFFFVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 290| 580|  10*/ ParseFunc10(VFFVFFFVFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 291| 582|  10*/ ParseFunc10(VFFVFFFVVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 292| 584|  10*/ ParseFunc10(VFFVFFVFFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 293| 586|  10*/ ParseFunc10(VFFVFFVFVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 294| 588|  10*/ ParseFunc10(VFFVFFVVFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 295| 590|  10*/ ParseFunc10(VFFVFFVVVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 296| 592|  10*/ ParseFunc10(VFFVFVFFFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 297| 594|  10*/ ParseFunc10(VFFVFVFFVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 298| 596|  10*/ ParseFunc10(VFFVFVFVFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 299| 598|  10*/ ParseFunc10(VFFVFVFVVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 300| 600|  10*/ ParseFunc10(VFFVFVVFFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 301| 602|  10*/ ParseFunc10(VFFVFVVFVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 302| 604|  10*/ ParseFunc10(VFFVFVVVFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 303| 606|  10*/ ParseFunc10(VFFVFVVVVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 304| 608|  10*/ ParseFunc10(VFFVVFFFFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 305| 610|  10*/ ParseFunc10(VFFVVFFFVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 306| 612|  10*/ ParseFunc10(VFFVVFFVFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 307| 614|  10*/ ParseFunc10(VFFVVFFVVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 308| 616|  10*/ ParseFunc10(VFFVVFVFFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 309| 618|  10*/ ParseFunc10(VFFVVFVFVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 310| 620|  10*/ ParseFunc10(VFFVVFVVFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 311| 622|  10*/ ParseFunc10(VFFVVFVVVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 312| 624|  10*/ ParseFunc10(VFFVVVFFFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 313| 626|  10*/ ParseFunc10(VFFVVVFFVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 314| 628|  10*/ ParseFunc10(VFFVVVFVFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 315| 630|  10*/ ParseFunc10(VFFVVVFVVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 316| 632|  10*/ ParseFunc10(VFFVVVVFFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 317| 634|  10*/ ParseFunc10(VFFVVVVFVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 318| 636|  10*/ ParseFunc10(VFFVVVVVFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 319| 638|  10*/ ParseFunc10(VFFVVVVVVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 320| 640|  10*/ ParseFunc10(VFVFFFFFFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 321| 642|  10*/ ParseFunc10(VFVFFFFFVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 322| 644|  10*/ ParseFunc10(VFVFFFFVFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 323| 646|  10*/ ParseFunc10(VFVFFFFVVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 324| 648|  10*/ ParseFunc10(VFVFFFVFFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 325| 650|  10*/ ParseFunc10(VFVFFFVFVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 326| 652|  10*/ ParseFunc10(VFVFFFVVFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 327| 654|  10*/ ParseFunc10(VFVFFFVVVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 328| 656|  10*/ ParseFunc10(VFVFFVFFFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 329| 658|  10*/ ParseFunc10(VFVFFVFFVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 330| 660|  10*/ ParseFunc10(VFVFFVFVFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 331| 662|  10*/ ParseFunc10(VFVFFVFVVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 332| 664|  10*/ ParseFunc10(VFVFFVVFFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 333| 666|  10*/ ParseFunc10(VFVFFVVFVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 334| 668|  10*/ ParseFunc10(VFVFFVVVFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 335| 670|  10*/ ParseFunc10(VFVFFVVVVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 336| 672|  10*/ ParseFunc10(VFVFVFFFFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 337| 674|  10*/ ParseFunc10(VFVFVFFFVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 338| 676|  10*/ ParseFunc10(VFVFVFFVFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 339| 678|  10*/ ParseFunc10(VFVFVFFVVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 340| 680|  10*/ ParseFunc10(VFVFVFVFFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 341| 682|  10*/ ParseFunc10(VFVFVFVFVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 342| 684|  10*/ ParseFunc10(VFVFVFVVFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 343| 686|  10*/ ParseFunc10(VFVFVFVVVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 344| 688|  10*/ ParseFunc10(VFVFVVFFFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 345| 690|  10*/ ParseFunc10(VFVFVVFFVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 346| 692|  10*/ ParseFunc10(VFVFVVFVFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 347| 694|  10*/ ParseFunc10(VFVFVVFVVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 348| 696|  10*/ ParseFunc10(VFVFVVVFFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 349| 698|  10*/ ParseFunc10(VFVFVVVFVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 350| 700|  10*/ ParseFunc10(VFVFVVVVFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 351| 702|  10*/ ParseFunc10(VFVFVVVVVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 352| 704|  10*/ ParseFunc10(VFVVFFFFFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 353| 706|  10*/ ParseFunc10(VFVVFFFFVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 354| 708|  10*/ ParseFunc10(VFVVFFFVFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 355| 710|  10*/ ParseFunc10(VFVVFFFVVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 356| 712|  10*/ ParseFunc10(VFVVFFVFFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 357| 714|  10*/ ParseFunc10(VFVVFFVFVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 358| 716|  10*/ ParseFunc10(VFVVFFVVFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 359| 718|  10*/ ParseFunc10(VFVVFFVVVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 360| 720|  10*/ ParseFunc10(VFVVFVFFFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 361| 722|  10*/ ParseFunc10(VFVVFVFFVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 362| 724|  10*/ ParseFunc10(VFVVFVFVFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 363| 726|  10*/ ParseFunc10(VFVVFVFVVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 364| 728|  10*/ ParseFunc10(VFVVFVVFFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 365| 730|  10*/ ParseFunc10(VFVVFVVFVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 366| 732|  10*/ ParseFunc10(VFVVFVVVFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 367| 734|  10*/ ParseFunc10(VFVVFVVVVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 368| 736|  10*/ ParseFunc10(VFVVVFFFFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 369| 738|  10*/ ParseFunc10(VFVVVFFFVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 370| 740|  10*/ ParseFunc10(VFVVVFFVFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 371| 742|  10*/ ParseFunc10(VFVVVFFVVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 372| 744|  10*/ ParseFunc10(VFVVVFVFFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 373| 746|  10*/ ParseFunc10(VFVVVFVFVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 374| 748|  10*/ ParseFunc10(VFVVVFVVFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 375| 750|  10*/ ParseFunc10(VFVVVFVVVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 376| 752|  10*/ ParseFunc10(VFVVVVFFFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 377| 754|  10*/ ParseFunc10(VFVVVVFFVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 378| 756|  10*/ ParseFunc10(VFVVVVFVFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 379| 758|  10*/ ParseFunc10(VFVVVVFVVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 380| 760|  10*/ ParseFunc10(VFVVVVVFFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 381| 762|  10*/ ParseFunc10(VFVVVVVFVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 382| 764|  10*/ ParseFunc10(VFVVVVVVFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 383| 766|  10*/ ParseFunc10(VFVVVVVVVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 384| 768|  10*/ ParseFunc10(VVFFFFFFFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 385| 770|  10*/ ParseFunc10(VVFFFFFFVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 386| 772|  10*/ ParseFunc10(VVFFFFFVFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 387| 774|  10*/ ParseFunc10(VVFFFFFVVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 388| 776|  10*/ ParseFunc10(VVFFFFVFFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 389| 778|  10*/ ParseFunc10(VVFFFFVFVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 390| 780|  10*/ ParseFunc10(VVFFFFVVFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 391| 782|  10*/ ParseFunc10(VVFFFFVVVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 392| 784|  10*/ ParseFunc10(VVFFFVFFFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 393| 786|  10*/ ParseFunc10(VVFFFVFFVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 394| 788|  10*/ ParseFunc10(VVFFFVFVFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 395| 790|  10*/ ParseFunc10(VVFFFVFVVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 396| 792|  10*/ ParseFunc10(VVFFFVVFFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 397| 794|  10*/ ParseFunc10(VVFFFVVFVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 398| 796|  10*/ ParseFunc10(VVFFFVVVFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 399| 798|  10*/ ParseFunc10(VVFFFVVVVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 400| 800|  10*/ ParseFunc10(VVFFVFFFFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 401| 802|  10*/ ParseFunc10(VVFFVFFFVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 402| 804|  10*/ ParseFunc10(VVFFVFFVFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 403| 806|  10*/ ParseFunc10(VVFFVFFVVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 404| 808|  10*/ ParseFunc10(VVFFVFVFFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 405| 810|  10*/ ParseFunc10(VVFFVFVFVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 406| 812|  10*/ ParseFunc10(VVFFVFVVFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 407| 814|  10*/ ParseFunc10(VVFFVFVVVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 408| 816|  10*/ ParseFunc10(VVFFVVFFFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 409| 818|  10*/ ParseFunc10(VVFFVVFFVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 410| 820|  10*/ ParseFunc10(VVFFVVFVFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 411| 822|  10*/ ParseFunc10(VVFFVVFVVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 412| 824|  10*/ ParseFunc10(VVFFVVVFFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 413| 826|  10*/ ParseFunc10(VVFFVVVFVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 414| 828|  10*/ ParseFunc10(VVFFVVVVFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 415| 830|  10*/ ParseFunc10(VVFFVVVVVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 416| 832|  10*/ ParseFunc10(VVFVFFFFFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 417| 834|  10*/ ParseFunc10(VVFVFFFFVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 418| 836|  10*/ ParseFunc10(VVFVFFFVFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 419| 838|  10*/ ParseFunc10(VVFVFFFVVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 420| 840|  10*/ ParseFunc10(VVFVFFVFFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 421| 842|  10*/ ParseFunc10(VVFVFFVFVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 422| 844|  10*/ ParseFunc10(VVFVFFVVFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 423| 846|  10*/ ParseFunc10(VVFVFFVVVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 424| 848|  10*/ ParseFunc10(VVFVFVFFFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 425| 850|  10*/ ParseFunc10(VVFVFVFFVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 426| 852|  10*/ ParseFunc10(VVFVFVFVFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 427| 854|  10*/ ParseFunc10(VVFVFVFVVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 428| 856|  10*/ ParseFunc10(VVFVFVVFFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 429| 858|  10*/ ParseFunc10(VVFVFVVFVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 430| 860|  10*/ ParseFunc10(VVFVFVVVFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 431| 862|  10*/ ParseFunc10(VVFVFVVVVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 432| 864|  10*/ ParseFunc10(VVFVVFFFFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 433| 866|  10*/ ParseFunc10(VVFVVFFFVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 434| 868|  10*/ ParseFunc10(VVFVVFFVFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 435| 870|  10*/ ParseFunc10(VVFVVFFVVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 436| 872|  10*/ ParseFunc10(VVFVVFVFFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 437| 874|  10*/ ParseFunc10(VVFVVFVFVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 438| 876|  10*/ ParseFunc10(VVFVVFVVFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 439| 878|  10*/ ParseFunc10(VVFVVFVVVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 440| 880|  10*/ ParseFunc10(VVFVVVFFFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 441| 882|  10*/ ParseFunc10(VVFVVVFFVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 442| 884|  10*/ ParseFunc10(VVFVVVFVFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 443| 886|  10*/ ParseFunc10(VVFVVVFVVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 444| 888|  10*/ ParseFunc10(VVFVVVVFFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 445| 890|  10*/ ParseFunc10(VVFVVVVFVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 446| 892|  10*/ ParseFunc10(VVFVVVVVFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 447| 894|  10*/ ParseFunc10(VVFVVVVVVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 448| 896|  10*/ ParseFunc10(VVVFFFFFFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 449| 898|  10*/ ParseFunc10(VVVFFFFFVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 450| 900|  10*/ ParseFunc10(VVVFFFFVFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 451| 902|  10*/ ParseFunc10(VVVFFFFVVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 452| 904|  10*/ ParseFunc10(VVVFFFVFFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 453| 906|  10*/ ParseFunc10(VVVFFFVFVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 454| 908|  10*/ ParseFunc10(VVVFFFVVFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 455| 910|  10*/ ParseFunc10(VVVFFFVVVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 456| 912|  10*/ ParseFunc10(VVVFFVFFFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 457| 914|  10*/ ParseFunc10(VVVFFVFFVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 458| 916|  10*/ ParseFunc10(VVVFFVFVFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 459| 918|  10*/ ParseFunc10(VVVFFVFVVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 460| 920|  10*/ ParseFunc10(VVVFFVVFFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 461| 922|  10*/ ParseFunc10(VVVFFVVFVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 462| 924|  10*/ ParseFunc10(VVVFFVVVFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 463| 926|  10*/ ParseFunc10(VVVFFVVVVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 464| 928|  10*/ ParseFunc10(VVVFVFFFFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 465| 930|  10*/ ParseFunc10(VVVFVFFFVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 466| 932|  10*/ ParseFunc10(VVVFVFFVFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 467| 934|  10*/ ParseFunc10(VVVFVFFVVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 468| 936|  10*/ ParseFunc10(VVVFVFVFFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 469| 938|  10*/ ParseFunc10(VVVFVFVFVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 470| 940|  10*/ ParseFunc10(VVVFVFVVFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 471| 942|  10*/ ParseFunc10(VVVFVFVVVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 472| 944|  10*/ ParseFunc10(VVVFVVFFFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 473| 946|  10*/ ParseFunc10(VVVFVVFFVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 474| 948|  10*/ ParseFunc10(VVVFVVFVFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 475| 950|  10*/ ParseFunc10(VVVFVVFVVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 476| 952|  10*/ ParseFunc10(VVVFVVVFFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 477| 954|  10*/ ParseFunc10(VVVFVVVFVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 478| 956|  10*/ ParseFunc10(VVVFVVVVFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 479| 958|  10*/ ParseFunc10(VVVFVVVVVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 480| 960|  10*/ ParseFunc10(VVVVFFFFFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 481| 962|  10*/ ParseFunc10(VVVVFFFFVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 482| 964|  10*/ ParseFunc10(VVVVFFFVFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 483| 966|  10*/ ParseFunc10(VVVVFFFVVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 484| 968|  10*/ ParseFunc10(VVVVFFVFFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 485| 970|  10*/ ParseFunc10(VVVVFFVFVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 486| 972|  10*/ ParseFunc10(VVVVFFVVFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 487| 974|  10*/ ParseFunc10(VVVVFFVVVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 488| 976|  10*/ ParseFunc10(VVVVFVFFFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 489| 978|  10*/ ParseFunc10(VVVVFVFFVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 490| 980|  10*/ ParseFunc10(VVVVFVFVFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 491| 982|  10*/ ParseFunc10(VVVVFVFVVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 492| 984|  10*/ ParseFunc10(VVVVFVVFFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 493| 986|  10*/ ParseFunc10(VVVVFVVFVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 494| 988|  10*/ ParseFunc10(VVVVFVVVFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 495| 990|  10*/ ParseFunc10(VVVVFVVVVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 496| 992|  10*/ ParseFunc10(VVVVVFFFFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 497| 994|  10*/ ParseFunc10(VVVVVFFFVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 498| 996|  10*/ ParseFunc10(VVVVVFFVFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 499| 998|  10*/ ParseFunc10(VVVVVFFVVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 500|1000|  10*/ ParseFunc10(VVVVVFVFFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 501|1002|  10*/ ParseFunc10(VVVVVFVFVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 502|1004|  10*/ ParseFunc10(VVVVVFVVFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 503|1006|  10*/ ParseFunc10(VVVVVFVVVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 504|1008|  10*/ ParseFunc10(VVVVVVFFFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 505|1010|  10*/ ParseFunc10(VVVVVVFFVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 506|1012|  10*/ ParseFunc10(VVVVVVFVFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 507|1014|  10*/ ParseFunc10(VVVVVVFVVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 508|1016|  10*/ ParseFunc10(VVVVVVVFFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 509|1018|  10*/ ParseFunc10(VVVVVVVFVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 510|1020|  10*/ ParseFunc10(VVVVVVVVFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 511|1022|  10*/ ParseFunc10(VVVVVVVVVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 512|1024|  11*/ ParseFunc11(VFFFFFFFFFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 513|1026|  11*/ ParseFunc11(VFFFFFFFFVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 514|1028|  11*/ ParseFunc11(VFFFFFFFVFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 515|1030|  11*/ ParseFunc11(VFFFFFFFVVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 516|1032|  11*/ ParseFunc11(VFFFFFFVFFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 517|1034|  11*/ ParseFunc11(VFFFFFFVFVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 518|1036|  11*/ ParseFunc11(VFFFFFFVVFF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 519|1038|  11*/ ParseFunc11(VFFFFFFVVVF, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 520|1040|  11*/ ParseFunc11(VFFFFFVFFFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 521|1042|  11*/ ParseFunc11(VFFFFFVFFVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 522|1044|  11*/ ParseFunc11(VFFFFFVFVFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 523|1046|  11*/ ParseFunc11(VFFFFFVFVVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 524|1048|  11*/ ParseFunc11(VFFFFFVVFFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 525|1050|  11*/ ParseFunc11(VFFFFFVVFVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 526|1052|  11*/ ParseFunc11(VFFFFFVVVFF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 527|1054|  11*/ ParseFunc11(VFFFFFVVVVF, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 528|1056|  11*/ ParseFunc11(VFFFFVFFFFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 529|1058|  11*/ ParseFunc11(VFFFFVFFFVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 530|1060|  11*/ ParseFunc11(VFFFFVFFVFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 531|1062|  11*/ ParseFunc11(VFFFFVFFVVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 532|1064|  11*/ ParseFunc11(VFFFFVFVFFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 533|1066|  11*/ ParseFunc11(VFFFFVFVFVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 534|1068|  11*/ ParseFunc11(VFFFFVFVVFF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 535|1070|  11*/ ParseFunc11(VFFFFVFVVVF, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 536|1072|  11*/ ParseFunc11(VFFFFVVFFFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 537|1074|  11*/ ParseFunc11(VFFFFVVFFVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 538|1076|  11*/ ParseFunc11(VFFFFVVFVFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 539|1078|  11*/ ParseFunc11(VFFFFVVFVVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 540|1080|  11*/ ParseFunc11(VFFFFVVVFFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 541|1082|  11*/ ParseFunc11(VFFFFVVVFVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 542|1084|  11*/ ParseFunc11(VFFFFVVVVFF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 543|1086|  11*/ ParseFunc11(VFFFFVVVVVF, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 544|1088|  11*/ ParseFunc11(VFFFVFFFFFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 545|1090|  11*/ ParseFunc11(VFFFVFFFFVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 546|1092|  11*/ ParseFunc11(VFFFVFFFVFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 547|1094|  11*/ ParseFunc11(VFFFVFFFVVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 548|1096|  11*/ ParseFunc11(VFFFVFFVFFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 549|1098|  11*/ ParseFunc11(VFFFVFFVFVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 550|1100|  11*/ ParseFunc11(VFFFVFFVVFF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 551|1102|  11*/ ParseFunc11(VFFFVFFVVVF, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 552|1104|  11*/ ParseFunc11(VFFFVFVFFFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 553|1106|  11*/ ParseFunc11(VFFFVFVFFVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 554|1108|  11*/ ParseFunc11(VFFFVFVFVFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 555|1110|  11*/ ParseFunc11(VFFFVFVFVVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 556|1112|  11*/ ParseFunc11(VFFFVFVVFFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 557|1114|  11*/ ParseFunc11(VFFFVFVVFVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 558|1116|  11*/ ParseFunc11(VFFFVFVVVFF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 559|1118|  11*/ ParseFunc11(VFFFVFVVVVF, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 560|1120|  11*/ ParseFunc11(VFFFVVFFFFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 561|1122|  11*/ ParseFunc11(VFFFVVFFFVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 562|1124|  11*/ ParseFunc11(VFFFVVFFVFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 563|1126|  11*/ ParseFunc11(VFFFVVFFVVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 564|1128|  11*/ ParseFunc11(VFFFVVFVFFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 565|1130|  11*/ ParseFunc11(VFFFVVFVFVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 566|1132|  11*/ ParseFunc11(VFFFVVFVVFF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 567|1134|  11*/ ParseFunc11(VFFFVVFVVVF, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 568|1136|  11*/ ParseFunc11(VFFFVVVFFFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 569|1138|  11*/ ParseFunc11(VFFFVVVFFVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 570|1140|  11*/ ParseFunc11(VFFFVVVFVFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 571|1142|  11*/ ParseFunc11(VFFFVVVFVVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 572|1144|  11*/ ParseFunc11(VFFFVVVVFFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 573|1146|  11*/ ParseFunc11(VFFFVVVVFVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 574|1148|  11*/ ParseFunc11(VFFFVVVVVFF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 575|1150|  11*/ ParseFunc11(VFFFVVVVVVF, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 576|1152|  11*/ ParseFunc11(VFFVFFFFFFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 577|1154|  11*/ ParseFunc11(VFFVFFFFFVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 578|1156|  11*/ ParseFunc11(VFFVFFFFVFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 579|1158|  11*/ ParseFunc11(VFFVFFFFVVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 580|1160|  11*/ ParseFunc11(VFFVFFFVFFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 581|1162|  11*/ ParseFunc11(VFFVFFFVFVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 582|1164|  11*/ ParseFunc11(VFFVFFFVVFF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 583|1166|  11*/ ParseFunc11(VFFVFFFVVVF, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 584|1168|  11*/ ParseFunc11(VFFVFFVFFFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 585|1170|  11*/ ParseFunc11(VFFVFFVFFVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 586|1172|  11*/ ParseFunc11(VFFVFFVFVFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 587|1174|  11*/ ParseFunc11(VFFVFFVFVVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 588|1176|  11*/ ParseFunc11(VFFVFFVVFFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 589|1178|  11*/ ParseFunc11(VFFVFFVVFVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 590|1180|  11*/ ParseFunc11(VFFVFFVVVFF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 591|1182|  11*/ ParseFunc11(VFFVFFVVVVF, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 592|1184|  11*/ ParseFunc11(VFFVFVFFFFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 593|1186|  11*/ ParseFunc11(VFFVFVFFFVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 594|1188|  11*/ ParseFunc11(VFFVFVFFVFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 595|1190|  11*/ ParseFunc11(VFFVFVFFVVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 596|1192|  11*/ ParseFunc11(VFFVFVFVFFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 597|1194|  11*/ ParseFunc11(VFFVFVFVFVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 598|1196|  11*/ ParseFunc11(VFFVFVFVVFF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 599|1198|  11*/ ParseFunc11(VFFVFVFVVVF, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 600|1200|  11*/ ParseFunc11(VFFVFVVFFFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 601|1202|  11*/ ParseFunc11(VFFVFVVFFVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 602|1204|  11*/ ParseFunc11(VFFVFVVFVFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 603|1206|  11*/ ParseFunc11(VFFVFVVFVVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 604|1208|  11*/ ParseFunc11(VFFVFVVVFFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 605|1210|  11*/ ParseFunc11(VFFVFVVVFVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 606|1212|  11*/ ParseFunc11(VFFVFVVVVFF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 607|1214|  11*/ ParseFunc11(VFFVFVVVVVF, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 608|1216|  11*/ ParseFunc11(VFFVVFFFFFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 609|1218|  11*/ ParseFunc11(VFFVVFFFFVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 610|1220|  11*/ ParseFunc11(VFFVVFFFVFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 611|1222|  11*/ ParseFunc11(VFFVVFFFVVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 612|1224|  11*/ ParseFunc11(VFFVVFFVFFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 613|1226|  11*/ ParseFunc11(VFFVVFFVFVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 614|1228|  11*/ ParseFunc11(VFFVVFFVVFF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 615|1230|  11*/ ParseFunc11(VFFVVFFVVVF, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 616|1232|  11*/ ParseFunc11(VFFVVFVFFFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 617|1234|  11*/ ParseFunc11(VFFVVFVFFVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 618|1236|  11*/ ParseFunc11(VFFVVFVFVFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 619|1238|  11*/ ParseFunc11(VFFVVFVFVVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 620|1240|  11*/ ParseFunc11(VFFVVFVVFFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 621|1242|  11*/ ParseFunc11(VFFVVFVVFVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 622|1244|  11*/ ParseFunc11(VFFVVFVVVFF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 623|1246|  11*/ ParseFunc11(VFFVVFVVVVF, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 624|1248|  11*/ ParseFunc11(VFFVVVFFFFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 625|1250|  11*/ ParseFunc11(VFFVVVFFFVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 626|1252|  11*/ ParseFunc11(VFFVVVFFVFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 627|1254|  11*/ ParseFunc11(VFFVVVFFVVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 628|1256|  11*/ ParseFunc11(VFFVVVFVFFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 629|1258|  11*/ ParseFunc11(VFFVVVFVFVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 630|1260|  11*/ ParseFunc11(VFFVVVFVVFF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 631|1262|  11*/ ParseFunc11(VFFVVVFVVVF, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 632|1264|  11*/ ParseFunc11(VFFVVVVFFFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 633|1266|  11*/ ParseFunc11(VFFVVVVFFVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 634|1268|  11*/ ParseFunc11(VFFVVVVFVFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 635|1270|  11*/ ParseFunc11(VFFVVVVFVVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 636|1272|  11*/ ParseFunc11(VFFVVVVVFFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 637|1274|  11*/ ParseFunc11(VFFVVVVVFVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 638|1276|  11*/ ParseFunc11(VFFVVVVVVFF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 639|1278|  11*/ ParseFunc11(VFFVVVVVVVF, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 640|1280|  11*/ ParseFunc11(VFVFFFFFFFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 641|1282|  11*/ ParseFunc11(VFVFFFFFFVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 642|1284|  11*/ ParseFunc11(VFVFFFFFVFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 643|1286|  11*/ ParseFunc11(VFVFFFFFVVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 644|1288|  11*/ ParseFunc11(VFVFFFFVFFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 645|1290|  11*/ ParseFunc11(VFVFFFFVFVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 646|1292|  11*/ ParseFunc11(VFVFFFFVVFF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 647|1294|  11*/ ParseFunc11(VFVFFFFVVVF, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 648|1296|  11*/ ParseFunc11(VFVFFFVFFFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 649|1298|  11*/ ParseFunc11(VFVFFFVFFVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 650|1300|  11*/ ParseFunc11(VFVFFFVFVFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 651|1302|  11*/ ParseFunc11(VFVFFFVFVVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 652|1304|  11*/ ParseFunc11(VFVFFFVVFFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 653|1306|  11*/ ParseFunc11(VFVFFFVVFVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 654|1308|  11*/ ParseFunc11(VFVFFFVVVFF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 655|1310|  11*/ ParseFunc11(VFVFFFVVVVF, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 656|1312|  11*/ ParseFunc11(VFVFFVFFFFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 657|1314|  11*/ ParseFunc11(VFVFFVFFFVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 658|1316|  11*/ ParseFunc11(VFVFFVFFVFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 659|1318|  11*/ ParseFunc11(VFVFFVFFVVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 660|1320|  11*/ ParseFunc11(VFVFFVFVFFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 661|1322|  11*/ ParseFunc11(VFVFFVFVFVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 662|1324|  11*/ ParseFunc11(VFVFFVFVVFF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 663|1326|  11*/ ParseFunc11(VFVFFVFVVVF, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 664|1328|  11*/ ParseFunc11(VFVFFVVFFFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 665|1330|  11*/ ParseFunc11(VFVFFVVFFVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 666|1332|  11*/ ParseFunc11(VFVFFVVFVFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 667|1334|  11*/ ParseFunc11(VFVFFVVFVVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 668|1336|  11*/ ParseFunc11(VFVFFVVVFFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 669|1338|  11*/ ParseFunc11(VFVFFVVVFVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 670|1340|  11*/ ParseFunc11(VFVFFVVVVFF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 671|1342|  11*/ ParseFunc11(VFVFFVVVVVF, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 672|1344|  11*/ ParseFunc11(VFVFVFFFFFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 673|1346|  11*/ ParseFunc11(VFVFVFFFFVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 674|1348|  11*/ ParseFunc11(VFVFVFFFVFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 675|1350|  11*/ ParseFunc11(VFVFVFFFVVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 676|1352|  11*/ ParseFunc11(VFVFVFFVFFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 677|1354|  11*/ ParseFunc11(VFVFVFFVFVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 678|1356|  11*/ ParseFunc11(VFVFVFFVVFF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 679|1358|  11*/ ParseFunc11(VFVFVFFVVVF, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 680|1360|  11*/ ParseFunc11(VFVFVFVFFFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 681|1362|  11*/ ParseFunc11(VFVFVFVFFVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 682|1364|  11*/ ParseFunc11(VFVFVFVFVFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 683|1366|  11*/ ParseFunc11(VFVFVFVFVVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 684|1368|  11*/ ParseFunc11(VFVFVFVVFFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 685|1370|  11*/ ParseFunc11(VFVFVFVVFVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 686|1372|  11*/ ParseFunc11(VFVFVFVVVFF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 687|1374|  11*/ ParseFunc11(VFVFVFVVVVF, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 688|1376|  11*/ ParseFunc11(VFVFVVFFFFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 689|1378|  11*/ ParseFunc11(VFVFVVFFFVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 690|1380|  11*/ ParseFunc11(VFVFVVFFVFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 691|1382|  11*/ ParseFunc11(VFVFVVFFVVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 692|1384|  11*/ ParseFunc11(VFVFVVFVFFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 693|1386|  11*/ ParseFunc11(VFVFVVFVFVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 694|1388|  11*/ ParseFunc11(VFVFVVFVVFF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 695|1390|  11*/ ParseFunc11(VFVFVVFVVVF, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 696|1392|  11*/ ParseFunc11(VFVFVVVFFFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 697|1394|  11*/ ParseFunc11(VFVFVVVFFVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 698|1396|  11*/ ParseFunc11(VFVFVVVFVFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 699|1398|  11*/ ParseFunc11(VFVFVVVFVVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 700|1400|  11*/ ParseFunc11(VFVFVVVVFFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 701|1402|  11*/ ParseFunc11(VFVFVVVVFVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 702|1404|  11*/ ParseFunc11(VFVFVVVVVFF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 703|1406|  11*/ ParseFunc11(VFVFVVVVVVF, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 704|1408|  11*/ ParseFunc11(VFVVFFFFFFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 705|1410|  11*/ ParseFunc11(VFVVFFFFFVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 706|1412|  11*/ ParseFunc11(VFVVFFFFVFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 707|1414|  11*/ ParseFunc11(VFVVFFFFVVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 708|1416|  11*/ ParseFunc11(VFVVFFFVFFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 709|1418|  11*/ ParseFunc11(VFVVFFFVFVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 710|1420|  11*/ ParseFunc11(VFVVFFFVVFF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 711|1422|  11*/ ParseFunc11(VFVVFFFVVVF, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 712|1424|  11*/ ParseFunc11(VFVVFFVFFFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 713|1426|  11*/ ParseFunc11(VFVVFFVFFVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 714|1428|  11*/ ParseFunc11(VFVVFFVFVFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 715|1430|  11*/ ParseFunc11(VFVVFFVFVVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 716|1432|  11*/ ParseFunc11(VFVVFFVVFFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 717|1434|  11*/ ParseFunc11(VFVVFFVVFVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 718|1436|  11*/ ParseFunc11(VFVVFFVVVFF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 719|1438|  11*/ ParseFunc11(VFVVFFVVVVF, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 720|1440|  11*/ ParseFunc11(VFVVFVFFFFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 721|1442|  11*/ ParseFunc11(VFVVFVFFFVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 722|1444|  11*/ ParseFunc11(VFVVFVFFVFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 723|1446|  11*/ ParseFunc11(VFVVFVFFVVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 724|1448|  11*/ ParseFunc11(VFVVFVFVFFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 725|1450|  11*/ ParseFunc11(VFVVFVFVFVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 726|1452|  11*/ ParseFunc11(VFVVFVFVVFF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 727|1454|  11*/ ParseFunc11(VFVVFVFVVVF, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 728|1456|  11*/ ParseFunc11(VFVVFVVFFFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 729|1458|  11*/ ParseFunc11(VFVVFVVFFVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 730|1460|  11*/ ParseFunc11(VFVVFVVFVFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 731|1462|  11*/ ParseFunc11(VFVVFVVFVVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 732|1464|  11*/ ParseFunc11(VFVVFVVVFFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 733|1466|  11*/ ParseFunc11(VFVVFVVVFVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 734|1468|  11*/ ParseFunc11(VFVVFVVVVFF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 735|1470|  11*/ ParseFunc11(VFVVFVVVVVF, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 736|1472|  11*/ ParseFunc11(VFVVVFFFFFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 737|1474|  11*/ ParseFunc11(VFVVVFFFFVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 738|1476|  11*/ ParseFunc11(VFVVVFFFVFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 739|1478|  11*/ ParseFunc11(VFVVVFFFVVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 740|1480|  11*/ ParseFunc11(VFVVVFFVFFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 741|1482|  11*/ ParseFunc11(VFVVVFFVFVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 742|1484|  11*/ ParseFunc11(VFVVVFFVVFF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 743|1486|  11*/ ParseFunc11(VFVVVFFVVVF, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 744|1488|  11*/ ParseFunc11(VFVVVFVFFFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 745|1490|  11*/ ParseFunc11(VFVVVFVFFVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 746|1492|  11*/ ParseFunc11(VFVVVFVFVFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 747|1494|  11*/ ParseFunc11(VFVVVFVFVVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 748|1496|  11*/ ParseFunc11(VFVVVFVVFFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 749|1498|  11*/ ParseFunc11(VFVVVFVVFVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 750|1500|  11*/ ParseFunc11(VFVVVFVVVFF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 751|1502|  11*/ ParseFunc11(VFVVVFVVVVF, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 752|1504|  11*/ ParseFunc11(VFVVVVFFFFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 753|1506|  11*/ ParseFunc11(VFVVVVFFFVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 754|1508|  11*/ ParseFunc11(VFVVVVFFVFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 755|1510|  11*/ ParseFunc11(VFVVVVFFVVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 756|1512|  11*/ ParseFunc11(VFVVVVFVFFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 757|1514|  11*/ ParseFunc11(VFVVVVFVFVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 758|1516|  11*/ ParseFunc11(VFVVVVFVVFF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 759|1518|  11*/ ParseFunc11(VFVVVVFVVVF, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 760|1520|  11*/ ParseFunc11(VFVVVVVFFFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 761|1522|  11*/ ParseFunc11(VFVVVVVFFVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 762|1524|  11*/ ParseFunc11(VFVVVVVFVFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 763|1526|  11*/ ParseFunc11(VFVVVVVFVVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 764|1528|  11*/ ParseFunc11(VFVVVVVVFFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 765|1530|  11*/ ParseFunc11(VFVVVVVVFVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 766|1532|  11*/ ParseFunc11(VFVVVVVVVFF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 767|1534|  11*/ ParseFunc11(VFVVVVVVVVF, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 768|1536|  11*/ ParseFunc11(VVFFFFFFFFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 769|1538|  11*/ ParseFunc11(VVFFFFFFFVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 770|1540|  11*/ ParseFunc11(VVFFFFFFVFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 771|1542|  11*/ ParseFunc11(VVFFFFFFVVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 772|1544|  11*/ ParseFunc11(VVFFFFFVFFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 773|1546|  11*/ ParseFunc11(VVFFFFFVFVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 774|1548|  11*/ ParseFunc11(VVFFFFFVVFF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 775|1550|  11*/ ParseFunc11(VVFFFFFVVVF, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 776|1552|  11*/ ParseFunc11(VVFFFFVFFFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 777|1554|  11*/ ParseFunc11(VVFFFFVFFVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 778|1556|  11*/ ParseFunc11(VVFFFFVFVFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 779|1558|  11*/ ParseFunc11(VVFFFFVFVVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 780|1560|  11*/ ParseFunc11(VVFFFFVVFFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 781|1562|  11*/ ParseFunc11(VVFFFFVVFVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 782|1564|  11*/ ParseFunc11(VVFFFFVVVFF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 783|1566|  11*/ ParseFunc11(VVFFFFVVVVF, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 784|1568|  11*/ ParseFunc11(VVFFFVFFFFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 785|1570|  11*/ ParseFunc11(VVFFFVFFFVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 786|1572|  11*/ ParseFunc11(VVFFFVFFVFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 787|1574|  11*/ ParseFunc11(VVFFFVFFVVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 788|1576|  11*/ ParseFunc11(VVFFFVFVFFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 789|1578|  11*/ ParseFunc11(VVFFFVFVFVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 790|1580|  11*/ ParseFunc11(VVFFFVFVVFF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 791|1582|  11*/ ParseFunc11(VVFFFVFVVVF, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 792|1584|  11*/ ParseFunc11(VVFFFVVFFFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 793|1586|  11*/ ParseFunc11(VVFFFVVFFVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 794|1588|  11*/ ParseFunc11(VVFFFVVFVFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 795|1590|  11*/ ParseFunc11(VVFFFVVFVVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 796|1592|  11*/ ParseFunc11(VVFFFVVVFFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 797|1594|  11*/ ParseFunc11(VVFFFVVVFVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 798|1596|  11*/ ParseFunc11(VVFFFVVVVFF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 799|1598|  11*/ ParseFunc11(VVFFFVVVVVF, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 800|1600|  11*/ ParseFunc11(VVFFVFFFFFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 801|1602|  11*/ ParseFunc11(VVFFVFFFFVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 802|1604|  11*/ ParseFunc11(VVFFVFFFVFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 803|1606|  11*/ ParseFunc11(VVFFVFFFVVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 804|1608|  11*/ ParseFunc11(VVFFVFFVFFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 805|1610|  11*/ ParseFunc11(VVFFVFFVFVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 806|1612|  11*/ ParseFunc11(VVFFVFFVVFF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 807|1614|  11*/ ParseFunc11(VVFFVFFVVVF, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 808|1616|  11*/ ParseFunc11(VVFFVFVFFFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 809|1618|  11*/ ParseFunc11(VVFFVFVFFVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 810|1620|  11*/ ParseFunc11(VVFFVFVFVFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 811|1622|  11*/ ParseFunc11(VVFFVFVFVVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 812|1624|  11*/ ParseFunc11(VVFFVFVVFFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 813|1626|  11*/ ParseFunc11(VVFFVFVVFVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 814|1628|  11*/ ParseFunc11(VVFFVFVVVFF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 815|1630|  11*/ ParseFunc11(VVFFVFVVVVF, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 816|1632|  11*/ ParseFunc11(VVFFVVFFFFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 817|1634|  11*/ ParseFunc11(VVFFVVFFFVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 818|1636|  11*/ ParseFunc11(VVFFVVFFVFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 819|1638|  11*/ ParseFunc11(VVFFVVFFVVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 820|1640|  11*/ ParseFunc11(VVFFVVFVFFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 821|1642|  11*/ ParseFunc11(VVFFVVFVFVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 822|1644|  11*/ ParseFunc11(VVFFVVFVVFF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 823|1646|  11*/ ParseFunc11(VVFFVVFVVVF, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 824|1648|  11*/ ParseFunc11(VVFFVVVFFFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 825|1650|  11*/ ParseFunc11(VVFFVVVFFVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 826|1652|  11*/ ParseFunc11(VVFFVVVFVFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 827|1654|  11*/ ParseFunc11(VVFFVVVFVVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 828|1656|  11*/ ParseFunc11(VVFFVVVVFFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 829|1658|  11*/ ParseFunc11(VVFFVVVVFVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 830|1660|  11*/ ParseFunc11(VVFFVVVVVFF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 831|1662|  11*/ ParseFunc11(VVFFVVVVVVF, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 832|1664|  11*/ ParseFunc11(VVFVFFFFFFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 833|1666|  11*/ ParseFunc11(VVFVFFFFFVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 834|1668|  11*/ ParseFunc11(VVFVFFFFVFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 835|1670|  11*/ ParseFunc11(VVFVFFFFVVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 836|1672|  11*/ ParseFunc11(VVFVFFFVFFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 837|1674|  11*/ ParseFunc11(VVFVFFFVFVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 838|1676|  11*/ ParseFunc11(VVFVFFFVVFF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 839|1678|  11*/ ParseFunc11(VVFVFFFVVVF, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 840|1680|  11*/ ParseFunc11(VVFVFFVFFFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 841|1682|  11*/ ParseFunc11(VVFVFFVFFVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 842|1684|  11*/ ParseFunc11(VVFVFFVFVFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 843|1686|  11*/ ParseFunc11(VVFVFFVFVVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 844|1688|  11*/ ParseFunc11(VVFVFFVVFFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 845|1690|  11*/ ParseFunc11(VVFVFFVVFVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 846|1692|  11*/ ParseFunc11(VVFVFFVVVFF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 847|1694|  11*/ ParseFunc11(VVFVFFVVVVF, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 848|1696|  11*/ ParseFunc11(VVFVFVFFFFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 849|1698|  11*/ ParseFunc11(VVFVFVFFFVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 850|1700|  11*/ ParseFunc11(VVFVFVFFVFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 851|1702|  11*/ ParseFunc11(VVFVFVFFVVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 852|1704|  11*/ ParseFunc11(VVFVFVFVFFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 853|1706|  11*/ ParseFunc11(VVFVFVFVFVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 854|1708|  11*/ ParseFunc11(VVFVFVFVVFF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 855|1710|  11*/ ParseFunc11(VVFVFVFVVVF, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 856|1712|  11*/ ParseFunc11(VVFVFVVFFFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 857|1714|  11*/ ParseFunc11(VVFVFVVFFVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 858|1716|  11*/ ParseFunc11(VVFVFVVFVFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 859|1718|  11*/ ParseFunc11(VVFVFVVFVVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 860|1720|  11*/ ParseFunc11(VVFVFVVVFFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 861|1722|  11*/ ParseFunc11(VVFVFVVVFVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 862|1724|  11*/ ParseFunc11(VVFVFVVVVFF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 863|1726|  11*/ ParseFunc11(VVFVFVVVVVF, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 864|1728|  11*/ ParseFunc11(VVFVVFFFFFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 865|1730|  11*/ ParseFunc11(VVFVVFFFFVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 866|1732|  11*/ ParseFunc11(VVFVVFFFVFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 867|1734|  11*/ ParseFunc11(VVFVVFFFVVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 868|1736|  11*/ ParseFunc11(VVFVVFFVFFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 869|1738|  11*/ ParseFunc11(VVFVVFFVFVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 870|1740|  11*/ ParseFunc11(VVFVVFFVVFF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 871|1742|  11*/ ParseFunc11(VVFVVFFVVVF, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 872|1744|  11*/ ParseFunc11(VVFVVFVFFFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 873|1746|  11*/ ParseFunc11(VVFVVFVFFVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 874|1748|  11*/ ParseFunc11(VVFVVFVFVFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 875|1750|  11*/ ParseFunc11(VVFVVFVFVVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 876|1752|  11*/ ParseFunc11(VVFVVFVVFFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 877|1754|  11*/ ParseFunc11(VVFVVFVVFVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 878|1756|  11*/ ParseFunc11(VVFVVFVVVFF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 879|1758|  11*/ ParseFunc11(VVFVVFVVVVF, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 880|1760|  11*/ ParseFunc11(VVFVVVFFFFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 881|1762|  11*/ ParseFunc11(VVFVVVFFFVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 882|1764|  11*/ ParseFunc11(VVFVVVFFVFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 883|1766|  11*/ ParseFunc11(VVFVVVFFVVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 884|1768|  11*/ ParseFunc11(VVFVVVFVFFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 885|1770|  11*/ ParseFunc11(VVFVVVFVFVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 886|1772|  11*/ ParseFunc11(VVFVVVFVVFF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 887|1774|  11*/ ParseFunc11(VVFVVVFVVVF, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 888|1776|  11*/ ParseFunc11(VVFVVVVFFFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 889|1778|  11*/ ParseFunc11(VVFVVVVFFVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 890|1780|  11*/ ParseFunc11(VVFVVVVFVFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 891|1782|  11*/ ParseFunc11(VVFVVVVFVVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 892|1784|  11*/ ParseFunc11(VVFVVVVVFFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 893|1786|  11*/ ParseFunc11(VVFVVVVVFVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 894|1788|  11*/ ParseFunc11(VVFVVVVVVFF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 895|1790|  11*/ ParseFunc11(VVFVVVVVVVF, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 896|1792|  11*/ ParseFunc11(VVVFFFFFFFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 897|1794|  11*/ ParseFunc11(VVVFFFFFFVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 898|1796|  11*/ ParseFunc11(VVVFFFFFVFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 899|1798|  11*/ ParseFunc11(VVVFFFFFVVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 900|1800|  11*/ ParseFunc11(VVVFFFFVFFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 901|1802|  11*/ ParseFunc11(VVVFFFFVFVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 902|1804|  11*/ ParseFunc11(VVVFFFFVVFF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 903|1806|  11*/ ParseFunc11(VVVFFFFVVVF, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 904|1808|  11*/ ParseFunc11(VVVFFFVFFFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 905|1810|  11*/ ParseFunc11(VVVFFFVFFVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 906|1812|  11*/ ParseFunc11(VVVFFFVFVFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 907|1814|  11*/ ParseFunc11(VVVFFFVFVVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 908|1816|  11*/ ParseFunc11(VVVFFFVVFFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 909|1818|  11*/ ParseFunc11(VVVFFFVVFVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 910|1820|  11*/ ParseFunc11(VVVFFFVVVFF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 911|1822|  11*/ ParseFunc11(VVVFFFVVVVF, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 912|1824|  11*/ ParseFunc11(VVVFFVFFFFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 913|1826|  11*/ ParseFunc11(VVVFFVFFFVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 914|1828|  11*/ ParseFunc11(VVVFFVFFVFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 915|1830|  11*/ ParseFunc11(VVVFFVFFVVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 916|1832|  11*/ ParseFunc11(VVVFFVFVFFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 917|1834|  11*/ ParseFunc11(VVVFFVFVFVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 918|1836|  11*/ ParseFunc11(VVVFFVFVVFF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 919|1838|  11*/ ParseFunc11(VVVFFVFVVVF, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 920|1840|  11*/ ParseFunc11(VVVFFVVFFFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 921|1842|  11*/ ParseFunc11(VVVFFVVFFVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 922|1844|  11*/ ParseFunc11(VVVFFVVFVFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 923|1846|  11*/ ParseFunc11(VVVFFVVFVVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 924|1848|  11*/ ParseFunc11(VVVFFVVVFFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 925|1850|  11*/ ParseFunc11(VVVFFVVVFVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 926|1852|  11*/ ParseFunc11(VVVFFVVVVFF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 927|1854|  11*/ ParseFunc11(VVVFFVVVVVF, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 928|1856|  11*/ ParseFunc11(VVVFVFFFFFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 929|1858|  11*/ ParseFunc11(VVVFVFFFFVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 930|1860|  11*/ ParseFunc11(VVVFVFFFVFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 931|1862|  11*/ ParseFunc11(VVVFVFFFVVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 932|1864|  11*/ ParseFunc11(VVVFVFFVFFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 933|1866|  11*/ ParseFunc11(VVVFVFFVFVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 934|1868|  11*/ ParseFunc11(VVVFVFFVVFF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 935|1870|  11*/ ParseFunc11(VVVFVFFVVVF, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 936|1872|  11*/ ParseFunc11(VVVFVFVFFFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 937|1874|  11*/ ParseFunc11(VVVFVFVFFVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 938|1876|  11*/ ParseFunc11(VVVFVFVFVFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 939|1878|  11*/ ParseFunc11(VVVFVFVFVVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 940|1880|  11*/ ParseFunc11(VVVFVFVVFFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 941|1882|  11*/ ParseFunc11(VVVFVFVVFVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 942|1884|  11*/ ParseFunc11(VVVFVFVVVFF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 943|1886|  11*/ ParseFunc11(VVVFVFVVVVF, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 944|1888|  11*/ ParseFunc11(VVVFVVFFFFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 945|1890|  11*/ ParseFunc11(VVVFVVFFFVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 946|1892|  11*/ ParseFunc11(VVVFVVFFVFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 947|1894|  11*/ ParseFunc11(VVVFVVFFVVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 948|1896|  11*/ ParseFunc11(VVVFVVFVFFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 949|1898|  11*/ ParseFunc11(VVVFVVFVFVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 950|1900|  11*/ ParseFunc11(VVVFVVFVVFF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 951|1902|  11*/ ParseFunc11(VVVFVVFVVVF, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 952|1904|  11*/ ParseFunc11(VVVFVVVFFFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 953|1906|  11*/ ParseFunc11(VVVFVVVFFVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 954|1908|  11*/ ParseFunc11(VVVFVVVFVFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 955|1910|  11*/ ParseFunc11(VVVFVVVFVVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 956|1912|  11*/ ParseFunc11(VVVFVVVVFFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 957|1914|  11*/ ParseFunc11(VVVFVVVVFVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 958|1916|  11*/ ParseFunc11(VVVFVVVVVFF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 959|1918|  11*/ ParseFunc11(VVVFVVVVVVF, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 960|1920|  11*/ ParseFunc11(VVVVFFFFFFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 961|1922|  11*/ ParseFunc11(VVVVFFFFFVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 962|1924|  11*/ ParseFunc11(VVVVFFFFVFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 963|1926|  11*/ ParseFunc11(VVVVFFFFVVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 964|1928|  11*/ ParseFunc11(VVVVFFFVFFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 965|1930|  11*/ ParseFunc11(VVVVFFFVFVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 966|1932|  11*/ ParseFunc11(VVVVFFFVVFF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 967|1934|  11*/ ParseFunc11(VVVVFFFVVVF, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, VAL, FUN);
-  /* 968|1936|  11*/ ParseFunc11(VVVVFFVFFFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN, FUN);
-  /* 969|1938|  11*/ ParseFunc11(VVVVFFVFFVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, VAL, FUN);
-  /* 970|1940|  11*/ ParseFunc11(VVVVFFVFVFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN, FUN);
-  /* 971|1942|  11*/ ParseFunc11(VVVVFFVFVVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, VAL, FUN);
-  /* 972|1944|  11*/ ParseFunc11(VVVVFFVVFFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN, FUN);
-  /* 973|1946|  11*/ ParseFunc11(VVVVFFVVFVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, VAL, FUN);
-  /* 974|1948|  11*/ ParseFunc11(VVVVFFVVVFF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN, FUN);
-  /* 975|1950|  11*/ ParseFunc11(VVVVFFVVVVF, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, VAL, FUN);
-  /* 976|1952|  11*/ ParseFunc11(VVVVFVFFFFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN, FUN);
-  /* 977|1954|  11*/ ParseFunc11(VVVVFVFFFVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, VAL, FUN);
-  /* 978|1956|  11*/ ParseFunc11(VVVVFVFFVFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN, FUN);
-  /* 979|1958|  11*/ ParseFunc11(VVVVFVFFVVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, VAL, FUN);
-  /* 980|1960|  11*/ ParseFunc11(VVVVFVFVFFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN, FUN);
-  /* 981|1962|  11*/ ParseFunc11(VVVVFVFVFVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, VAL, FUN);
-  /* 982|1964|  11*/ ParseFunc11(VVVVFVFVVFF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN, FUN);
-  /* 983|1966|  11*/ ParseFunc11(VVVVFVFVVVF, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, VAL, FUN);
-  /* 984|1968|  11*/ ParseFunc11(VVVVFVVFFFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN, FUN);
-  /* 985|1970|  11*/ ParseFunc11(VVVVFVVFFVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, VAL, FUN);
-  /* 986|1972|  11*/ ParseFunc11(VVVVFVVFVFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN, FUN);
-  /* 987|1974|  11*/ ParseFunc11(VVVVFVVFVVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, VAL, FUN);
-  /* 988|1976|  11*/ ParseFunc11(VVVVFVVVFFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN, FUN);
-  /* 989|1978|  11*/ ParseFunc11(VVVVFVVVFVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, VAL, FUN);
-  /* 990|1980|  11*/ ParseFunc11(VVVVFVVVVFF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN, FUN);
-  /* 991|1982|  11*/ ParseFunc11(VVVVFVVVVVF, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, VAL, FUN);
-  /* 992|1984|  11*/ ParseFunc11(VVVVVFFFFFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN, FUN);
-  /* 993|1986|  11*/ ParseFunc11(VVVVVFFFFVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, VAL, FUN);
-  /* 994|1988|  11*/ ParseFunc11(VVVVVFFFVFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN, FUN);
-  /* 995|1990|  11*/ ParseFunc11(VVVVVFFFVVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, VAL, FUN);
-  /* 996|1992|  11*/ ParseFunc11(VVVVVFFVFFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN, FUN);
-  /* 997|1994|  11*/ ParseFunc11(VVVVVFFVFVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, VAL, FUN);
-  /* 998|1996|  11*/ ParseFunc11(VVVVVFFVVFF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN, FUN);
-  /* 999|1998|  11*/ ParseFunc11(VVVVVFFVVVF, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, VAL, FUN);
-  /*1000|2000|  11*/ ParseFunc11(VVVVVFVFFFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN, FUN);
-  /*1001|2002|  11*/ ParseFunc11(VVVVVFVFFVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, VAL, FUN);
-  /*1002|2004|  11*/ ParseFunc11(VVVVVFVFVFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN, FUN);
-  /*1003|2006|  11*/ ParseFunc11(VVVVVFVFVVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, VAL, FUN);
-  /*1004|2008|  11*/ ParseFunc11(VVVVVFVVFFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN, FUN);
-  /*1005|2010|  11*/ ParseFunc11(VVVVVFVVFVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, VAL, FUN);
-  /*1006|2012|  11*/ ParseFunc11(VVVVVFVVVFF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN, FUN);
-  /*1007|2014|  11*/ ParseFunc11(VVVVVFVVVVF, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, VAL, FUN);
-  /*1008|2016|  11*/ ParseFunc11(VVVVVVFFFFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN, FUN);
-  /*1009|2018|  11*/ ParseFunc11(VVVVVVFFFVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, VAL, FUN);
-  /*1010|2020|  11*/ ParseFunc11(VVVVVVFFVFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN, FUN);
-  /*1011|2022|  11*/ ParseFunc11(VVVVVVFFVVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, VAL, FUN);
-  /*1012|2024|  11*/ ParseFunc11(VVVVVVFVFFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN, FUN);
-  /*1013|2026|  11*/ ParseFunc11(VVVVVVFVFVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, VAL, FUN);
-  /*1014|2028|  11*/ ParseFunc11(VVVVVVFVVFF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN, FUN);
-  /*1015|2030|  11*/ ParseFunc11(VVVVVVFVVVF, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, VAL, FUN);
-  /*1016|2032|  11*/ ParseFunc11(VVVVVVVFFFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN, FUN);
-  /*1017|2034|  11*/ ParseFunc11(VVVVVVVFFVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, VAL, FUN);
-  /*1018|2036|  11*/ ParseFunc11(VVVVVVVFVFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN, FUN);
-  /*1019|2038|  11*/ ParseFunc11(VVVVVVVFVVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, VAL, FUN);
-  /*1020|2040|  11*/ ParseFunc11(VVVVVVVVFFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN, FUN);
-  /*1021|2042|  11*/ ParseFunc11(VVVVVVVVFVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, VAL, FUN);
-  /*1022|2044|  11*/ ParseFunc11(VVVVVVVVVFF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN, FUN);
-  /*1023|2046|  11*/ ParseFunc11(VVVVVVVVVVF, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, VAL, FUN);
+#ifndef MU_PRECOMPILED_ENGINES_H
+#define MU_PRECOMPILED_ENGINES_H
 
-  static const int s_nNumPrecompiledEngines = 1024;
+//--- muparser framework --------------------------------------------------------------------------
+#include "muParserDef.h"
 
-  ParseFunction m_pPrecompiledEngines[1024];
+/** \file
+    \brief Generator of the precompiled engines.
 
-  void InitPrecompiledEngined()
+  A precompiled engine evaluates bytecode of a single shape, that is a fixed sequence of value
+  and function tokens, without a loop or a dispatch on the token type. The engines for all
+  shapes of up to MUP_PRECOMPILED_MAX_LEN tokens are instantiated from the templates in this
+  file.
+
+  The shape is encoded in a bit mask with one bit per token, the first token is the most
+  significant bit. A set bit denotes a value token, a cleared bit a function. Since all shapes
+  start with a value the leading bit doubles as length marker. With the exception of a single
+  value all shapes end with a function so the last bit is dropped. The result is the engine
+  ID computed by ParserByteCode.
+
+  Specialized engines are keyed on the shape and the builtin arithmetic operators of the
+  bytecode. The operators are evaluated inline and the stack is a local array the compiler
+  can keep in registers. They are instantiated for all bytecode with up to 
+  MUP_SPECIALIZED_MAX_OPS operators.
+*/
+
+MUP_NAMESPACE_START
+
+  namespace details
+  {
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the number of tokens of a shape. */
+    constexpr int ShapeLength(unsigned a_nBits)
+    {
+      return (a_nBits) ? 1 + ShapeLength(a_nBits >> 1) : 0;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    /** \brief Returns the shape of an engine ID. */
+    constexpr unsigned EngineShape(unsigned a_nEngineID)
+    {
+      return (a_nEngineID) ? a_nEngineID * 2 : 1;
+    }
+  } // namespace details
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Evaluation of the tokens NTok and above of a bytecode shape.
+
+    Each token is handled by a separate instantiation. The test of the token type is a
+    compile time constant so the resulting engine is straight line code.
+  */
+  template<typename TValue,
+           typename TInstr,
+           unsigned NBits,
+           int NTok = 0,
+           int NLen = details::ShapeLength(NBits)>
+  struct PrecompiledShape
+  {
+    static MUP_INLINE void Exec(const TInstr *a_pRPN, TValue *a_pStack, int &sidx)
+    {
+      const TInstr &tok = a_pRPN[NTok];
+      if (NBits & (1u << (NLen - 1 - NTok)))
+      {
+        a_pStack[++sidx] = *tok.Val.ptr * tok.Val.mul + tok.Val.fixed;
+      }
+      else
+      {
+        sidx -= tok.Fun.argc - 1;
+        (*tok.Fun.ptr)(&a_pStack[sidx], tok.Fun.argc);
+      }
+
+      PrecompiledShape<TValue, TInstr, NBits, NTok + 1, NLen>::Exec(a_pRPN, a_pStack, sidx);
+    }
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  template<typename TValue, typename TInstr, unsigned NBits, int NLen>
+  struct PrecompiledShape<TValue, TInstr, NBits, NLen, NLen>
+  {
+    static MUP_INLINE void Exec(const TInstr*, TValue*, int&)
+    {}
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Inline evaluation of a single bytecode token by a specialized engine. 
+  
+    Next describes the stack depth and the number of operators after the token, given 
+    NDepth and NWeight in front of it. Tokens that would exceed the limits are not valid.
+  */
+  template<typename TValue, int NOp>
+  struct InlineOp;
+
+  //-----------------------------------------------------------------------------------------------
+  template<typename TValue>
+  struct InlineOp<TValue, ioVAL>
+  {
+    template<int NDepth, int NWeight> struct Next
+    {
+      // Each operator can reduce the stack depth by at most the number of operators it counts as
+      static const bool valid = NDepth + NWeight <= MUP_SPECIALIZED_MAX_OPS;
+      static const int depth  = NDepth + 1;
+      static const int weight = NWeight;
+    };
+
+    template<typename TInstr>
+    static MUP_INLINE void Exec(const TInstr &tok, TValue *a_pTop)
+    {
+      a_pTop[1] = *tok.Val.ptr * tok.Val.mul + tok.Val.fixed;
+    }
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Common part of the inline operator NOp with NArgs arguments. */
+  template<typename TValue, int NOp, int NArgs>
+  struct InlineFun
   {
-    m_pPrecompiledEngines[    0] = &ParserBase::PrecompiledExpr_V;
-    m_pPrecompiledEngines[    1] = &ParserBase::PrecompiledExpr_VF;
-    m_pPrecompiledEngines[    2] = &ParserBase::PrecompiledExpr_VFF;
-    m_pPrecompiledEngines[    3] = &ParserBase::PrecompiledExpr_VVF;
-    m_pPrecompiledEngines[    4] = &ParserBase::PrecompiledExpr_VFFF;
-    m_pPrecompiledEngines[    5] = &ParserBase::PrecompiledExpr_VFVF;
-    m_pPrecompiledEngines[    6] = &ParserBase::PrecompiledExpr_VVFF;
-    m_pPrecompiledEngines[    7] = &ParserBase::PrecompiledExpr_VVVF;
-    m_pPrecompiledEngines[    8] = &ParserBase::PrecompiledExpr_VFFFF;
-    m_pPrecompiledEngines[    9] = &ParserBase::PrecompiledExpr_VFFVF;
-    m_pPrecompiledEngines[   10] = &ParserBase::PrecompiledExpr_VFVFF;
-    m_pPrecompiledEngines[   11] = &ParserBase::PrecompiledExpr_VFVVF;
-    m_pPrecompiledEngines[   12] = &ParserBase::PrecompiledExpr_VVFFF;
-    m_pPrecompiledEngines[   13] = &ParserBase::PrecompiledExpr_VVFVF;
-    m_pPrecompiledEngines[   14] = &ParserBase::PrecompiledExpr_VVVFF;
-    m_pPrecompiledEngines[   15] = &ParserBase::PrecompiledExpr_VVVVF;
-    m_pPrecompiledEngines[   16] = &ParserBase::PrecompiledExpr_VFFFFF;
-    m_pPrecompiledEngines[   17] = &ParserBase::PrecompiledExpr_VFFFVF;
-    m_pPrecompiledEngines[   18] = &ParserBase::PrecompiledExpr_VFFVFF;
-    m_pPrecompiledEngines[   19] = &ParserBase::PrecompiledExpr_VFFVVF;
-    m_pPrecompiledEngines[   20] = &ParserBase::PrecompiledExpr_VFVFFF;
-    m_pPrecompiledEngines[   21] = &ParserBase::PrecompiledExpr_VFVFVF;
-    m_pPrecompiledEngines[   22] = &ParserBase::PrecompiledExpr_VFVVFF;
-    m_pPrecompiledEngines[   23] = &ParserBase::PrecompiledExpr_VFVVVF;
-    m_pPrecompiledEngines[   24] = &ParserBase::PrecompiledExpr_VVFFFF;
-    m_pPrecompiledEngines[   25] = &ParserBase::PrecompiledExpr_VVFFVF;
-    m_pPrecompiledEngines[   26] = &ParserBase::PrecompiledExpr_VVFVFF;
-    m_pPrecompiledEngines[   27] = &ParserBase::PrecompiledExpr_VVFVVF;
-    m_pPrecompiledEngines[   28] = &ParserBase::PrecompiledExpr_VVVFFF;
-    m_pPrecompiledEngines[   29] = &ParserBase::PrecompiledExpr_VVVFVF;
-    m_pPrecompiledEngines[   30] = &ParserBase::PrecompiledExpr_VVVVFF;
-    m_pPrecompiledEngines[   31] = &ParserBase::PrecompiledExpr_VVVVVF;
-    m_pPrecompiledEngines[   32] = &ParserBase::PrecompiledExpr_VFFFFFF;
-    m_pPrecompiledEngines[   33] = &ParserBase::PrecompiledExpr_VFFFFVF;
-    m_pPrecompiledEngines[   34] = &ParserBase::PrecompiledExpr_VFFFVFF;
-    m_pPrecompiledEngines[   35] = &ParserBase::PrecompiledExpr_VFFFVVF;
-    m_pPrecompiledEngines[   36] = &ParserBase::PrecompiledExpr_VFFVFFF;
-    m_pPrecompiledEngines[   37] = &ParserBase::PrecompiledExpr_VFFVFVF;
-    m_pPrecompiledEngines[   38] = &ParserBase::PrecompiledExpr_VFFVVFF;
-    m_pPrecompiledEngines[   39] = &ParserBase::PrecompiledExpr_VFFVVVF;
-    m_pPrecompiledEngines[   40] = &ParserBase::PrecompiledExpr_VFVFFFF;
-    m_pPrecompiledEngines[   41] = &ParserBase::PrecompiledExpr_VFVFFVF;
-    m_pPrecompiledEngines[   42] = &ParserBase::PrecompiledExpr_VFVFVFF;
-    m_pPrecompiledEngines[   43] = &ParserBase::PrecompiledExpr_VFVFVVF;
-    m_pPrecompiledEngines[   44] = &ParserBase::PrecompiledExpr_VFVVFFF;
-    m_pPrecompiledEngines[   45] = &ParserBase::PrecompiledExpr_VFVVFVF;
-    m_pPrecompiledEngines[   46] = &ParserBase::PrecompiledExpr_VFVVVFF;
-    m_pPrecompiledEngines[   47] = &ParserBase::PrecompiledExpr_VFVVVVF;
-    m_pPrecompiledEngines[   48] = &ParserBase::PrecompiledExpr_VVFFFFF;
-    m_pPrecompiledEngines[   49] = &ParserBase::PrecompiledExpr_VVFFFVF;
-    m_pPrecompiledEngines[   50] = &ParserBase::PrecompiledExpr_VVFFVFF;
-    m_pPrecompiledEngines[   51] = &ParserBase::PrecompiledExpr_VVFFVVF;
-    m_pPrecompiledEngines[   52] = &ParserBase::PrecompiledExpr_VVFVFFF;
-    m_pPrecompiledEngines[   53] = &ParserBase::PrecompiledExpr_VVFVFVF;
-    m_pPrecompiledEngines[   54] = &ParserBase::PrecompiledExpr_VVFVVFF;
-    m_pPrecompiledEngines[   55] = &ParserBase::PrecompiledExpr_VVFVVVF;
-    m_pPrecompiledEngines[   56] = &ParserBase::PrecompiledExpr_VVVFFFF;
-    m_pPrecompiledEngines[   57] = &ParserBase::PrecompiledExpr_VVVFFVF;
-    m_pPrecompiledEngines[   58] = &ParserBase::PrecompiledExpr_VVVFVFF;
-    m_pPrecompiledEngines[   59] = &ParserBase::PrecompiledExpr_VVVFVVF;
-    m_pPrecompiledEngines[   60] = &ParserBase::PrecompiledExpr_VVVVFFF;
-    m_pPrecompiledEngines[   61] = &ParserBase::PrecompiledExpr_VVVVFVF;
-    m_pPrecompiledEngines[   62] = &ParserBase::PrecompiledExpr_VVVVVFF;
-    m_pPrecompiledEngines[   63] = &ParserBase::PrecompiledExpr_VVVVVVF;
-    m_pPrecompiledEngines[   64] = &ParserBase::PrecompiledExpr_VFFFFFFF;
-    m_pPrecompiledEngines[   65] = &ParserBase::PrecompiledExpr_VFFFFFVF;
-    m_pPrecompiledEngines[   66] = &ParserBase::PrecompiledExpr_VFFFFVFF;
-    m_pPrecompiledEngines[   67] = &ParserBase::PrecompiledExpr_VFFFFVVF;
-    m_pPrecompiledEngines[   68] = &ParserBase::PrecompiledExpr_VFFFVFFF;
-    m_pPrecompiledEngines[   69] = &ParserBase::PrecompiledExpr_VFFFVFVF;
-    m_pPrecompiledEngines[   70] = &ParserBase::PrecompiledExpr_VFFFVVFF;
-    m_pPrecompiledEngines[   71] = &ParserBase::PrecompiledExpr_VFFFVVVF;
-    m_pPrecompiledEngines[   72] = &ParserBase::PrecompiledExpr_VFFVFFFF;
-    m_pPrecompiledEngines[   73] = &ParserBase::PrecompiledExpr_VFFVFFVF;
-    m_pPrecompiledEngines[   74] = &ParserBase::PrecompiledExpr_VFFVFVFF;
-    m_pPrecompiledEngines[   75] = &ParserBase::PrecompiledExpr_VFFVFVVF;
-    m_pPrecompiledEngines[   76] = &ParserBase::PrecompiledExpr_VFFVVFFF;
-    m_pPrecompiledEngines[   77] = &ParserBase::PrecompiledExpr_VFFVVFVF;
-    m_pPrecompiledEngines[   78] = &ParserBase::PrecompiledExpr_VFFVVVFF;
-    m_pPrecompiledEngines[   79] = &ParserBase::PrecompiledExpr_VFFVVVVF;
-    m_pPrecompiledEngines[   80] = &ParserBase::PrecompiledExpr_VFVFFFFF;
-    m_pPrecompiledEngines[   81] = &ParserBase::PrecompiledExpr_VFVFFFVF;
-    m_pPrecompiledEngines[   82] = &ParserBase::PrecompiledExpr_VFVFFVFF;
-    m_pPrecompiledEngines[   83] = &ParserBase::PrecompiledExpr_VFVFFVVF;
-    m_pPrecompiledEngines[   84] = &ParserBase::PrecompiledExpr_VFVFVFFF;
-    m_pPrecompiledEngines[   85] = &ParserBase::PrecompiledExpr_VFVFVFVF;
-    m_pPrecompiledEngines[   86] = &ParserBase::PrecompiledExpr_VFVFVVFF;
-    m_pPrecompiledEngines[   87] = &ParserBase::PrecompiledExpr_VFVFVVVF;
-    m_pPrecompiledEngines[   88] = &ParserBase::PrecompiledExpr_VFVVFFFF;
-    m_pPrecompiledEngines[   89] = &ParserBase::PrecompiledExpr_VFVVFFVF;
-    m_pPrecompiledEngines[   90] = &ParserBase::PrecompiledExpr_VFVVFVFF;
-    m_pPrecompiledEngines[   91] = &ParserBase::PrecompiledExpr_VFVVFVVF;
-    m_pPrecompiledEngines[   92] = &ParserBase::PrecompiledExpr_VFVVVFFF;
-    m_pPrecompiledEngines[   93] = &ParserBase::PrecompiledExpr_VFVVVFVF;
-    m_pPrecompiledEngines[   94] = &ParserBase::PrecompiledExpr_VFVVVVFF;
-    m_pPrecompiledEngines[   95] = &ParserBase::PrecompiledExpr_VFVVVVVF;
-    m_pPrecompiledEngines[   96] = &ParserBase::PrecompiledExpr_VVFFFFFF;
-    m_pPrecompiledEngines[   97] = &ParserBase::PrecompiledExpr_VVFFFFVF;
-    m_pPrecompiledEngines[   98] = &ParserBase::PrecompiledExpr_VVFFFVFF;
-    m_pPrecompiledEngines[   99] = &ParserBase::PrecompiledExpr_VVFFFVVF;
-    m_pPrecompiledEngines[  100] = &ParserBase::PrecompiledExpr_VVFFVFFF;
-    m_pPrecompiledEngines[  101] = &ParserBase::PrecompiledExpr_VVFFVFVF;
-    m_pPrecompiledEngines[  102] = &ParserBase::PrecompiledExpr_VVFFVVFF;
-    m_pPrecompiledEngines[  103] = &ParserBase::PrecompiledExpr_VVFFVVVF;
-    m_pPrecompiledEngines[  104] = &ParserBase::PrecompiledExpr_VVFVFFFF;
-    m_pPrecompiledEngines[  105] = &ParserBase::PrecompiledExpr_VVFVFFVF;
-    m_pPrecompiledEngines[  106] = &ParserBase::PrecompiledExpr_VVFVFVFF;
-    m_pPrecompiledEngines[  107] = &ParserBase::PrecompiledExpr_VVFVFVVF;
-    m_pPrecompiledEngines[  108] = &ParserBase::PrecompiledExpr_VVFVVFFF;
-    m_pPrecompiledEngines[  109] = &ParserBase::PrecompiledExpr_VVFVVFVF;
-    m_pPrecompiledEngines[  110] = &ParserBase::PrecompiledExpr_VVFVVVFF;
-    m_pPrecompiledEngines[  111] = &ParserBase::PrecompiledExpr_VVFVVVVF;
-    m_pPrecompiledEngines[  112] = &ParserBase::PrecompiledExpr_VVVFFFFF;
-    m_pPrecompiledEngines[  113] = &ParserBase::PrecompiledExpr_VVVFFFVF;
-    m_pPrecompiledEngines[  114] = &ParserBase::PrecompiledExpr_VVVFFVFF;
-    m_pPrecompiledEngines[  115] = &ParserBase::PrecompiledExpr_VVVFFVVF;
-    m_pPrecompiledEngines[  116] = &ParserBase::PrecompiledExpr_VVVFVFFF;
-    m_pPrecompiledEngines[  117] = &ParserBase::PrecompiledExpr_VVVFVFVF;
-    m_pPrecompiledEngines[  118] = &ParserBase::PrecompiledExpr_VVVFVVFF;
-    m_pPrecompiledEngines[  119] = &ParserBase::PrecompiledExpr_VVVFVVVF;
-    m_pPrecompiledEngines[  120] = &ParserBase::PrecompiledExpr_VVVVFFFF;
-    m_pPrecompiledEngines[  121] = &ParserBase::PrecompiledExpr_VVVVFFVF;
-    m_pPrecompiledEngines[  122] = &ParserBase::PrecompiledExpr_VVVVFVFF;
-    m_pPrecompiledEngines[  123] = &ParserBase::PrecompiledExpr_VVVVFVVF;
-    m_pPrecompiledEngines[  124] = &ParserBase::PrecompiledExpr_VVVVVFFF;
-    m_pPrecompiledEngines[  125] = &ParserBase::PrecompiledExpr_VVVVVFVF;
-    m_pPrecompiledEngines[  126] = &ParserBase::PrecompiledExpr_VVVVVVFF;
-    m_pPrecompiledEngines[  127] = &ParserBase::PrecompiledExpr_VVVVVVVF;
-    m_pPrecompiledEngines[  128] = &ParserBase::PrecompiledExpr_VFFFFFFFF;
-    m_pPrecompiledEngines[  129] = &ParserBase::PrecompiledExpr_VFFFFFFVF;
-    m_pPrecompiledEngines[  130] = &ParserBase::PrecompiledExpr_VFFFFFVFF;
-    m_pPrecompiledEngines[  131] = &ParserBase::PrecompiledExpr_VFFFFFVVF;
-    m_pPrecompiledEngines[  132] = &ParserBase::PrecompiledExpr_VFFFFVFFF;
-    m_pPrecompiledEngines[  133] = &ParserBase::PrecompiledExpr_VFFFFVFVF;
-    m_pPrecompiledEngines[  134] = &ParserBase::PrecompiledExpr_VFFFFVVFF;
-    m_pPrecompiledEngines[  135] = &ParserBase::PrecompiledExpr_VFFFFVVVF;
-    m_pPrecompiledEngines[  136] = &ParserBase::PrecompiledExpr_VFFFVFFFF;
-    m_pPrecompiledEngines[  137] = &ParserBase::PrecompiledExpr_VFFFVFFVF;
-    m_pPrecompiledEngines[  138] = &ParserBase::PrecompiledExpr_VFFFVFVFF;
-    m_pPrecompiledEngines[  139] = &ParserBase::PrecompiledExpr_VFFFVFVVF;
-    m_pPrecompiledEngines[  140] = &ParserBase::PrecompiledExpr_VFFFVVFFF;
-    m_pPrecompiledEngines[  141] = &ParserBase::PrecompiledExpr_VFFFVVFVF;
-    m_pPrecompiledEngines[  142] = &ParserBase::PrecompiledExpr_VFFFVVVFF;
-    m_pPrecompiledEngines[  143] = &ParserBase::PrecompiledExpr_VFFFVVVVF;
-    m_pPrecompiledEngines[  144] = &ParserBase::PrecompiledExpr_VFFVFFFFF;
-    m_pPrecompiledEngines[  145] = &ParserBase::PrecompiledExpr_VFFVFFFVF;
-    m_pPrecompiledEngines[  146] = &ParserBase::PrecompiledExpr_VFFVFFVFF;
-    m_pPrecompiledEngines[  147] = &ParserBase::PrecompiledExpr_VFFVFFVVF;
-    m_pPrecompiledEngines[  148] = &ParserBase::PrecompiledExpr_VFFVFVFFF;
-    m_pPrecompiledEngines[  149] = &ParserBase::PrecompiledExpr_VFFVFVFVF;
-    m_pPrecompiledEngines[  150] = &ParserBase::PrecompiledExpr_VFFVFVVFF;
-    m_pPrecompiledEngines[  151] = &ParserBase::PrecompiledExpr_VFFVFVVVF;
-    m_pPrecompiledEngines[  152] = &ParserBase::PrecompiledExpr_VFFVVFFFF;
-    m_pPrecompiledEngines[  153] = &ParserBase::PrecompiledExpr_VFFVVFFVF;
-    m_pPrecompiledEngines[  154] = &ParserBase::PrecompiledExpr_VFFVVFVFF;
-    m_pPrecompiledEngines[  155] = &ParserBase::PrecompiledExpr_VFFVVFVVF;
-    m_pPrecompiledEngines[  156] = &ParserBase::PrecompiledExpr_VFFVVVFFF;
-    m_pPrecompiledEngines[  157] = &ParserBase::PrecompiledExpr_VFFVVVFVF;
-    m_pPrecompiledEngines[  158] = &ParserBase::PrecompiledExpr_VFFVVVVFF;
-    m_pPrecompiledEngines[  159] = &ParserBase::PrecompiledExpr_VFFVVVVVF;
-    m_pPrecompiledEngines[  160] = &ParserBase::PrecompiledExpr_VFVFFFFFF;
-    m_pPrecompiledEngines[  161] = &ParserBase::PrecompiledExpr_VFVFFFFVF;
-    m_pPrecompiledEngines[  162] = &ParserBase::PrecompiledExpr_VFVFFFVFF;
-    m_pPrecompiledEngines[  163] = &ParserBase::PrecompiledExpr_VFVFFFVVF;
-    m_pPrecompiledEngines[  164] = &ParserBase::PrecompiledExpr_VFVFFVFFF;
-    m_pPrecompiledEngines[  165] = &ParserBase::PrecompiledExpr_VFVFFVFVF;
-    m_pPrecompiledEngines[  166] = &ParserBase::PrecompiledExpr_VFVFFVVFF;
-    m_pPrecompiledEngines[  167] = &ParserBase::PrecompiledExpr_VFVFFVVVF;
-    m_pPrecompiledEngines[  168] = &ParserBase::PrecompiledExpr_VFVFVFFFF;
-    m_pPrecompiledEngines[  169] = &ParserBase::PrecompiledExpr_VFVFVFFVF;
-    m_pPrecompiledEngines[  170] = &ParserBase::PrecompiledExpr_VFVFVFVFF;
-    m_pPrecompiledEngines[  171] = &ParserBase::PrecompiledExpr_VFVFVFVVF;
-    m_pPrecompiledEngines[  172] = &ParserBase::PrecompiledExpr_VFVFVVFFF;
-    m_pPrecompiledEngines[  173] = &ParserBase::PrecompiledExpr_VFVFVVFVF;
-    m_pPrecompiledEngines[  174] = &ParserBase::PrecompiledExpr_VFVFVVVFF;
-    m_pPrecompiledEngines[  175] = &ParserBase::PrecompiledExpr_VFVFVVVVF;
-    m_pPrecompiledEngines[  176] = &ParserBase::PrecompiledExpr_VFVVFFFFF;
-    m_pPrecompiledEngines[  177] = &ParserBase::PrecompiledExpr_VFVVFFFVF;
-    m_pPrecompiledEngines[  178] = &ParserBase::PrecompiledExpr_VFVVFFVFF;
-    m_pPrecompiledEngines[  179] = &ParserBase::PrecompiledExpr_VFVVFFVVF;
-    m_pPrecompiledEngines[  180] = &ParserBase::PrecompiledExpr_VFVVFVFFF;
-    m_pPrecompiledEngines[  181] = &ParserBase::PrecompiledExpr_VFVVFVFVF;
-    m_pPrecompiledEngines[  182] = &ParserBase::PrecompiledExpr_VFVVFVVFF;
-    m_pPrecompiledEngines[  183] = &ParserBase::PrecompiledExpr_VFVVFVVVF;
-    m_pPrecompiledEngines[  184] = &ParserBase::PrecompiledExpr_VFVVVFFFF;
-    m_pPrecompiledEngines[  185] = &ParserBase::PrecompiledExpr_VFVVVFFVF;
-    m_pPrecompiledEngines[  186] = &ParserBase::PrecompiledExpr_VFVVVFVFF;
-    m_pPrecompiledEngines[  187] = &ParserBase::PrecompiledExpr_VFVVVFVVF;
-    m_pPrecompiledEngines[  188] = &ParserBase::PrecompiledExpr_VFVVVVFFF;
-    m_pPrecompiledEngines[  189] = &ParserBase::PrecompiledExpr_VFVVVVFVF;
-    m_pPrecompiledEngines[  190] = &ParserBase::PrecompiledExpr_VFVVVVVFF;
-    m_pPrecompiledEngines[  191] = &ParserBase::PrecompiledExpr_VFVVVVVVF;
-    m_pPrecompiledEngines[  192] = &ParserBase::PrecompiledExpr_VVFFFFFFF;
-    m_pPrecompiledEngines[  193] = &ParserBase::PrecompiledExpr_VVFFFFFVF;
-    m_pPrecompiledEngines[  194] = &ParserBase::PrecompiledExpr_VVFFFFVFF;
-    m_pPrecompiledEngines[  195] = &ParserBase::PrecompiledExpr_VVFFFFVVF;
-    m_pPrecompiledEngines[  196] = &ParserBase::PrecompiledExpr_VVFFFVFFF;
-    m_pPrecompiledEngines[  197] = &ParserBase::PrecompiledExpr_VVFFFVFVF;
-    m_pPrecompiledEngines[  198] = &ParserBase::PrecompiledExpr_VVFFFVVFF;
-    m_pPrecompiledEngines[  199] = &ParserBase::PrecompiledExpr_VVFFFVVVF;
-    m_pPrecompiledEngines[  200] = &ParserBase::PrecompiledExpr_VVFFVFFFF;
-    m_pPrecompiledEngines[  201] = &ParserBase::PrecompiledExpr_VVFFVFFVF;
-    m_pPrecompiledEngines[  202] = &ParserBase::PrecompiledExpr_VVFFVFVFF;
-    m_pPrecompiledEngines[  203] = &ParserBase::PrecompiledExpr_VVFFVFVVF;
-    m_pPrecompiledEngines[  204] = &ParserBase::PrecompiledExpr_VVFFVVFFF;
-    m_pPrecompiledEngines[  205] = &ParserBase::PrecompiledExpr_VVFFVVFVF;
-    m_pPrecompiledEngines[  206] = &ParserBase::PrecompiledExpr_VVFFVVVFF;
-    m_pPrecompiledEngines[  207] = &ParserBase::PrecompiledExpr_VVFFVVVVF;
-    m_pPrecompiledEngines[  208] = &ParserBase::PrecompiledExpr_VVFVFFFFF;
-    m_pPrecompiledEngines[  209] = &ParserBase::PrecompiledExpr_VVFVFFFVF;
-    m_pPrecompiledEngines[  210] = &ParserBase::PrecompiledExpr_VVFVFFVFF;
-    m_pPrecompiledEngines[  211] = &ParserBase::PrecompiledExpr_VVFVFFVVF;
-    m_pPrecompiledEngines[  212] = &ParserBase::PrecompiledExpr_VVFVFVFFF;
-    m_pPrecompiledEngines[  213] = &ParserBase::PrecompiledExpr_VVFVFVFVF;
-    m_pPrecompiledEngines[  214] = &ParserBase::PrecompiledExpr_VVFVFVVFF;
-    m_pPrecompiledEngines[  215] = &ParserBase::PrecompiledExpr_VVFVFVVVF;
-    m_pPrecompiledEngines[  216] = &ParserBase::PrecompiledExpr_VVFVVFFFF;
-    m_pPrecompiledEngines[  217] = &ParserBase::PrecompiledExpr_VVFVVFFVF;
-    m_pPrecompiledEngines[  218] = &ParserBase::PrecompiledExpr_VVFVVFVFF;
-    m_pPrecompiledEngines[  219] = &ParserBase::PrecompiledExpr_VVFVVFVVF;
-    m_pPrecompiledEngines[  220] = &ParserBase::PrecompiledExpr_VVFVVVFFF;
-    m_pPrecompiledEngines[  221] = &ParserBase::PrecompiledExpr_VVFVVVFVF;
-    m_pPrecompiledEngines[  222] = &ParserBase::PrecompiledExpr_VVFVVVVFF;
-    m_pPrecompiledEngines[  223] = &ParserBase::PrecompiledExpr_VVFVVVVVF;
-    m_pPrecompiledEngines[  224] = &ParserBase::PrecompiledExpr_VVVFFFFFF;
-    m_pPrecompiledEngines[  225] = &ParserBase::PrecompiledExpr_VVVFFFFVF;
-    m_pPrecompiledEngines[  226] = &ParserBase::PrecompiledExpr_VVVFFFVFF;
-    m_pPrecompiledEngines[  227] = &ParserBase::PrecompiledExpr_VVVFFFVVF;
-    m_pPrecompiledEngines[  228] = &ParserBase::PrecompiledExpr_VVVFFVFFF;
-    m_pPrecompiledEngines[  229] = &ParserBase::PrecompiledExpr_VVVFFVFVF;
-    m_pPrecompiledEngines[  230] = &ParserBase::PrecompiledExpr_VVVFFVVFF;
-    m_pPrecompiledEngines[  231] = &ParserBase::PrecompiledExpr_VVVFFVVVF;
-    m_pPrecompiledEngines[  232] = &ParserBase::PrecompiledExpr_VVVFVFFFF;
-    m_pPrecompiledEngines[  233] = &ParserBase::PrecompiledExpr_VVVFVFFVF;
-    m_pPrecompiledEngines[  234] = &ParserBase::PrecompiledExpr_VVVFVFVFF;
-    m_pPrecompiledEngines[  235] = &ParserBase::PrecompiledExpr_VVVFVFVVF;
-    m_pPrecompiledEngines[  236] = &ParserBase::PrecompiledExpr_VVVFVVFFF;
-    m_pPrecompiledEngines[  237] = &ParserBase::PrecompiledExpr_VVVFVVFVF;
-    m_pPrecompiledEngines[  238] = &ParserBase::PrecompiledExpr_VVVFVVVFF;
-    m_pPrecompiledEngines[  239] = &ParserBase::PrecompiledExpr_VVVFVVVVF;
-    m_pPrecompiledEngines[  240] = &ParserBase::PrecompiledExpr_VVVVFFFFF;
-    m_pPrecompiledEngines[  241] = &ParserBase::PrecompiledExpr_VVVVFFFVF;
-    m_pPrecompiledEngines[  242] = &ParserBase::PrecompiledExpr_VVVVFFVFF;
-    m_pPrecompiledEngines[  243] = &ParserBase::PrecompiledExpr_VVVVFFVVF;
-    m_pPrecompiledEngines[  244] = &ParserBase::PrecompiledExpr_VVVVFVFFF;
-    m_pPrecompiledEngines[  245] = &ParserBase::PrecompiledExpr_VVVVFVFVF;
-    m_pPrecompiledEngines[  246] = &ParserBase::PrecompiledExpr_VVVVFVVFF;
-    m_pPrecompiledEngines[  247] = &ParserBase::PrecompiledExpr_VVVVFVVVF;
-    m_pPrecompiledEngines[  248] = &ParserBase::PrecompiledExpr_VVVVVFFFF;
-    m_pPrecompiledEngines[  249] = &ParserBase::PrecompiledExpr_VVVVVFFVF;
-    m_pPrecompiledEngines[  250] = &ParserBase::PrecompiledExpr_VVVVVFVFF;
-    m_pPrecompiledEngines[  251] = &ParserBase::PrecompiledExpr_VVVVVFVVF;
-    m_pPrecompiledEngines[  252] = &ParserBase::PrecompiledExpr_VVVVVVFFF;
-    m_pPrecompiledEngines[  253] = &ParserBase::PrecompiledExpr_VVVVVVFVF;
-    m_pPrecompiledEngines[  254] = &ParserBase::PrecompiledExpr_VVVVVVVFF;
-    m_pPrecompiledEngines[  255] = &ParserBase::PrecompiledExpr_VVVVVVVVF;
-    m_pPrecompiledEngines[  256] = &ParserBase::PrecompiledExpr_VFFFFFFFFF;
-    m_pPrecompiledEngines[  257] = &ParserBase::PrecompiledExpr_VFFFFFFFVF;
-    m_pPrecompiledEngines[  258] = &ParserBase::PrecompiledExpr_VFFFFFFVFF;
-    m_pPrecompiledEngines[  259] = &ParserBase::PrecompiledExpr_VFFFFFFVVF;
-    m_pPrecompiledEngines[  260] = &ParserBase::PrecompiledExpr_VFFFFFVFFF;
-    m_pPrecompiledEngines[  261] = &ParserBase::PrecompiledExpr_VFFFFFVFVF;
-    m_pPrecompiledEngines[  262] = &ParserBase::PrecompiledExpr_VFFFFFVVFF;
-    m_pPrecompiledEngines[  263] = &ParserBase::PrecompiledExpr_VFFFFFVVVF;
-    m_pPrecompiledEngines[  264] = &ParserBase::PrecompiledExpr_VFFFFVFFFF;
-    m_pPrecompiledEngines[  265] = &ParserBase::PrecompiledExpr_VFFFFVFFVF;
-    m_pPrecompiledEngines[  266] = &ParserBase::PrecompiledExpr_VFFFFVFVFF;
-    m_pPrecompiledEngines[  267] = &ParserBase::PrecompiledExpr_VFFFFVFVVF;
-    m_pPrecompiledEngines[  268] = &ParserBase::PrecompiledExpr_VFFFFVVFFF;
-    m_pPrecompiledEngines[  269] = &ParserBase::PrecompiledExpr_VFFFFVVFVF;
-    m_pPrecompiledEngines[  270] = &ParserBase::PrecompiledExpr_VFFFFVVVFF;
-    m_pPrecompiledEngines[  271] = &ParserBase::PrecompiledExpr_VFFFFVVVVF;
-    m_pPrecompiledEngines[  272] = &ParserBase::PrecompiledExpr_VFFFVFFFFF;
-    m_pPrecompiledEngines[  273] = &ParserBase::PrecompiledExpr_VFFFVFFFVF;
-    m_pPrecompiledEngines[  274] = &ParserBase::PrecompiledExpr_VFFFVFFVFF;
-    m_pPrecompiledEngines[  275] = &ParserBase::PrecompiledExpr_VFFFVFFVVF;
-    m_pPrecompiledEngines[  276] = &ParserBase::PrecompiledExpr_VFFFVFVFFF;
-    m_pPrecompiledEngines[  277] = &ParserBase::PrecompiledExpr_VFFFVFVFVF;
-    m_pPrecompiledEngines[  278] = &ParserBase::PrecompiledExpr_VFFFVFVVFF;
-    m_pPrecompiledEngines[  279] = &ParserBase::PrecompiledExpr_VFFFVFVVVF;
-    m_pPrecompiledEngines[  280] = &ParserBase::PrecompiledExpr_VFFFVVFFFF;
-    m_pPrecompiledEngines[  281] = &ParserBase::PrecompiledExpr_VFFFVVFFVF;
-    m_pPrecompiledEngines[  282] = &ParserBase::PrecompiledExpr_VFFFVVFVFF;
-    m_pPrecompiledEngines[  283] = &ParserBase::PrecompiledExpr_VFFFVVFVVF;
-    m_pPrecompiledEngines[  284] = &ParserBase::PrecompiledExpr_VFFFVVVFFF;
-    m_pPrecompiledEngines[  285] = &ParserBase::PrecompiledExpr_VFFFVVVFVF;
-    m_pPrecompiledEngines[  286] = &ParserBase::PrecompiledExpr_VFFFVVVVFF;
-    m_pPrecompiledEngines[  287] = &ParserBase::PrecompiledExpr_VFFFVVVVVF;
-    m_pPrecompiledEngines[  288] = &ParserBase::PrecompiledExpr_VFFVFFFFFF;
-    m_pPrecompiledEngines[  289] = &ParserBase::PrecompiledExpr_VFFVFFFFVF;
-    m_pPrecompiledEngines[  290] = &ParserBase::PrecompiledExpr_VFFVFFFVFF;
-    m_pPrecompiledEngines[  291] = &ParserBase::PrecompiledExpr_VFFVFFFVVF;
-    m_pPrecompiledEngines[  292] = &ParserBase::PrecompiledExpr_VFFVFFVFFF;
-    m_pPrecompiledEngines[  293] = &ParserBase::PrecompiledExpr_VFFVFFVFVF;
-    m_pPrecompiledEngines[  294] = &ParserBase::PrecompiledExpr_VFFVFFVVFF;
-    m_pPrecompiledEngines[  295] = &ParserBase::PrecompiledExpr_VFFVFFVVVF;
-    m_pPrecompiledEngines[  296] = &ParserBase::PrecompiledExpr_VFFVFVFFFF;
-    m_pPrecompiledEngines[  297] = &ParserBase::PrecompiledExpr_VFFVFVFFVF;
-    m_pPrecompiledEngines[  298] = &ParserBase::PrecompiledExpr_VFFVFVFVFF;
-    m_pPrecompiledEngines[  299] = &ParserBase::PrecompiledExpr_VFFVFVFVVF;
-    m_pPrecompiledEngines[  300] = &ParserBase::PrecompiledExpr_VFFVFVVFFF;
-    m_pPrecompiledEngines[  301] = &ParserBase::PrecompiledExpr_VFFVFVVFVF;
-    m_pPrecompiledEngines[  302] = &ParserBase::PrecompiledExpr_VFFVFVVVFF;
-    m_pPrecompiledEngines[  303] = &ParserBase::PrecompiledExpr_VFFVFVVVVF;
-    m_pPrecompiledEngines[  304] = &ParserBase::PrecompiledExpr_VFFVVFFFFF;
-    m_pPrecompiledEngines[  305] = &ParserBase::PrecompiledExpr_VFFVVFFFVF;
-    m_pPrecompiledEngines[  306] = &ParserBase::PrecompiledExpr_VFFVVFFVFF;
-    m_pPrecompiledEngines[  307] = &ParserBase::PrecompiledExpr_VFFVVFFVVF;
-    m_pPrecompiledEngines[  308] = &ParserBase::PrecompiledExpr_VFFVVFVFFF;
-    m_pPrecompiledEngines[  309] = &ParserBase::PrecompiledExpr_VFFVVFVFVF;
-    m_pPrecompiledEngines[  310] = &ParserBase::PrecompiledExpr_VFFVVFVVFF;
-    m_pPrecompiledEngines[  311] = &ParserBase::PrecompiledExpr_VFFVVFVVVF;
-    m_pPrecompiledEngines[  312] = &ParserBase::PrecompiledExpr_VFFVVVFFFF;
-    m_pPrecompiledEngines[  313] = &ParserBase::PrecompiledExpr_VFFVVVFFVF;
-    m_pPrecompiledEngines[  314] = &ParserBase::PrecompiledExpr_VFFVVVFVFF;
-    m_pPrecompiledEngines[  315] = &ParserBase::PrecompiledExpr_VFFVVVFVVF;
-    m_pPrecompiledEngines[  316] = &ParserBase::PrecompiledExpr_VFFVVVVFFF;
-    m_pPrecompiledEngines[  317] = &ParserBase::PrecompiledExpr_VFFVVVVFVF;
-    m_pPrecompiledEngines[  318] = &ParserBase::PrecompiledExpr_VFFVVVVVFF;
-    m_pPrecompiledEngines[  319] = &ParserBase::PrecompiledExpr_VFFVVVVVVF;
-    m_pPrecompiledEngines[  320] = &ParserBase::PrecompiledExpr_VFVFFFFFFF;
-    m_pPrecompiledEngines[  321] = &ParserBase::PrecompiledExpr_VFVFFFFFVF;
-    m_pPrecompiledEngines[  322] = &ParserBase::PrecompiledExpr_VFVFFFFVFF;
-    m_pPrecompiledEngines[  323] = &ParserBase::PrecompiledExpr_VFVFFFFVVF;
-    m_pPrecompiledEngines[  324] = &ParserBase::PrecompiledExpr_VFVFFFVFFF;
-    m_pPrecompiledEngines[  325] = &ParserBase::PrecompiledExpr_VFVFFFVFVF;
-    m_pPrecompiledEngines[  326] = &ParserBase::PrecompiledExpr_VFVFFFVVFF;
-    m_pPrecompiledEngines[  327] = &ParserBase::PrecompiledExpr_VFVFFFVVVF;
-    m_pPrecompiledEngines[  328] = &ParserBase::PrecompiledExpr_VFVFFVFFFF;
-    m_pPrecompiledEngines[  329] = &ParserBase::PrecompiledExpr_VFVFFVFFVF;
-    m_pPrecompiledEngines[  330] = &ParserBase::PrecompiledExpr_VFVFFVFVFF;
-    m_pPrecompiledEngines[  331] = &ParserBase::PrecompiledExpr_VFVFFVFVVF;
-    m_pPrecompiledEngines[  332] = &ParserBase::PrecompiledExpr_VFVFFVVFFF;
-    m_pPrecompiledEngines[  333] = &ParserBase::PrecompiledExpr_VFVFFVVFVF;
-    m_pPrecompiledEngines[  334] = &ParserBase::PrecompiledExpr_VFVFFVVVFF;
-    m_pPrecompiledEngines[  335] = &ParserBase::PrecompiledExpr_VFVFFVVVVF;
-    m_pPrecompiledEngines[  336] = &ParserBase::PrecompiledExpr_VFVFVFFFFF;
-    m_pPrecompiledEngines[  337] = &ParserBase::PrecompiledExpr_VFVFVFFFVF;
-    m_pPrecompiledEngines[  338] = &ParserBase::PrecompiledExpr_VFVFVFFVFF;
-    m_pPrecompiledEngines[  339] = &ParserBase::PrecompiledExpr_VFVFVFFVVF;
-    m_pPrecompiledEngines[  340] = &ParserBase::PrecompiledExpr_VFVFVFVFFF;
-    m_pPrecompiledEngines[  341] = &ParserBase::PrecompiledExpr_VFVFVFVFVF;
-    m_pPrecompiledEngines[  342] = &ParserBase::PrecompiledExpr_VFVFVFVVFF;
-    m_pPrecompiledEngines[  343] = &ParserBase::PrecompiledExpr_VFVFVFVVVF;
-    m_pPrecompiledEngines[  344] = &ParserBase::PrecompiledExpr_VFVFVVFFFF;
-    m_pPrecompiledEngines[  345] = &ParserBase::PrecompiledExpr_VFVFVVFFVF;
-    m_pPrecompiledEngines[  346] = &ParserBase::PrecompiledExpr_VFVFVVFVFF;
-    m_pPrecompiledEngines[  347] = &ParserBase::PrecompiledExpr_VFVFVVFVVF;
-    m_pPrecompiledEngines[  348] = &ParserBase::PrecompiledExpr_VFVFVVVFFF;
-    m_pPrecompiledEngines[  349] = &ParserBase::PrecompiledExpr_VFVFVVVFVF;
-    m_pPrecompiledEngines[  350] = &ParserBase::PrecompiledExpr_VFVFVVVVFF;
-    m_pPrecompiledEngines[  351] = &ParserBase::PrecompiledExpr_VFVFVVVVVF;
-    m_pPrecompiledEngines[  352] = &ParserBase::PrecompiledExpr_VFVVFFFFFF;
-    m_pPrecompiledEngines[  353] = &ParserBase::PrecompiledExpr_VFVVFFFFVF;
-    m_pPrecompiledEngines[  354] = &ParserBase::PrecompiledExpr_VFVVFFFVFF;
-    m_pPrecompiledEngines[  355] = &ParserBase::PrecompiledExpr_VFVVFFFVVF;
-    m_pPrecompiledEngines[  356] = &ParserBase::PrecompiledExpr_VFVVFFVFFF;
-    m_pPrecompiledEngines[  357] = &ParserBase::PrecompiledExpr_VFVVFFVFVF;
-    m_pPrecompiledEngines[  358] = &ParserBase::PrecompiledExpr_VFVVFFVVFF;
-    m_pPrecompiledEngines[  359] = &ParserBase::PrecompiledExpr_VFVVFFVVVF;
-    m_pPrecompiledEngines[  360] = &ParserBase::PrecompiledExpr_VFVVFVFFFF;
-    m_pPrecompiledEngines[  361] = &ParserBase::PrecompiledExpr_VFVVFVFFVF;
-    m_pPrecompiledEngines[  362] = &ParserBase::PrecompiledExpr_VFVVFVFVFF;
-    m_pPrecompiledEngines[  363] = &ParserBase::PrecompiledExpr_VFVVFVFVVF;
-    m_pPrecompiledEngines[  364] = &ParserBase::PrecompiledExpr_VFVVFVVFFF;
-    m_pPrecompiledEngines[  365] = &ParserBase::PrecompiledExpr_VFVVFVVFVF;
-    m_pPrecompiledEngines[  366] = &ParserBase::PrecompiledExpr_VFVVFVVVFF;
-    m_pPrecompiledEngines[  367] = &ParserBase::PrecompiledExpr_VFVVFVVVVF;
-    m_pPrecompiledEngines[  368] = &ParserBase::PrecompiledExpr_VFVVVFFFFF;
-    m_pPrecompiledEngines[  369] = &ParserBase::PrecompiledExpr_VFVVVFFFVF;
-    m_pPrecompiledEngines[  370] = &ParserBase::PrecompiledExpr_VFVVVFFVFF;
-    m_pPrecompiledEngines[  371] = &ParserBase::PrecompiledExpr_VFVVVFFVVF;
-    m_pPrecompiledEngines[  372] = &ParserBase::PrecompiledExpr_VFVVVFVFFF;
-    m_pPrecompiledEngines[  373] = &ParserBase::PrecompiledExpr_VFVVVFVFVF;
-    m_pPrecompiledEngines[  374] = &ParserBase::PrecompiledExpr_VFVVVFVVFF;
-    m_pPrecompiledEngines[  375] = &ParserBase::PrecompiledExpr_VFVVVFVVVF;
-    m_pPrecompiledEngines[  376] = &ParserBase::PrecompiledExpr_VFVVVVFFFF;
-    m_pPrecompiledEngines[  377] = &ParserBase::PrecompiledExpr_VFVVVVFFVF;
-    m_pPrecompiledEngines[  378] = &ParserBase::PrecompiledExpr_VFVVVVFVFF;
-    m_pPrecompiledEngines[  379] = &ParserBase::PrecompiledExpr_VFVVVVFVVF;
-    m_pPrecompiledEngines[  380] = &ParserBase::PrecompiledExpr_VFVVVVVFFF;
-    m_pPrecompiledEngines[  381] = &ParserBase::PrecompiledExpr_VFVVVVVFVF;
-    m_pPrecompiledEngines[  382] = &ParserBase::PrecompiledExpr_VFVVVVVVFF;
-    m_pPrecompiledEngines[  383] = &ParserBase::PrecompiledExpr_VFVVVVVVVF;
-    m_pPrecompiledEngines[  384] = &ParserBase::PrecompiledExpr_VVFFFFFFFF;
-    m_pPrecompiledEngines[  385] = &ParserBase::PrecompiledExpr_VVFFFFFFVF;
-    m_pPrecompiledEngines[  386] = &ParserBase::PrecompiledExpr_VVFFFFFVFF;
-    m_pPrecompiledEngines[  387] = &ParserBase::PrecompiledExpr_VVFFFFFVVF;
-    m_pPrecompiledEngines[  388] = &ParserBase::PrecompiledExpr_VVFFFFVFFF;
-    m_pPrecompiledEngines[  389] = &ParserBase::PrecompiledExpr_VVFFFFVFVF;
-    m_pPrecompiledEngines[  390] = &ParserBase::PrecompiledExpr_VVFFFFVVFF;
-    m_pPrecompiledEngines[  391] = &ParserBase::PrecompiledExpr_VVFFFFVVVF;
-    m_pPrecompiledEngines[  392] = &ParserBase::PrecompiledExpr_VVFFFVFFFF;
-    m_pPrecompiledEngines[  393] = &ParserBase::PrecompiledExpr_VVFFFVFFVF;
-    m_pPrecompiledEngines[  394] = &ParserBase::PrecompiledExpr_VVFFFVFVFF;
-    m_pPrecompiledEngines[  395] = &ParserBase::PrecompiledExpr_VVFFFVFVVF;
-    m_pPrecompiledEngines[  396] = &ParserBase::PrecompiledExpr_VVFFFVVFFF;
-    m_pPrecompiledEngines[  397] = &ParserBase::PrecompiledExpr_VVFFFVVFVF;
-    m_pPrecompiledEngines[  398] = &ParserBase::PrecompiledExpr_VVFFFVVVFF;
-    m_pPrecompiledEngines[  399] = &ParserBase::PrecompiledExpr_VVFFFVVVVF;
-    m_pPrecompiledEngines[  400] = &ParserBase::PrecompiledExpr_VVFFVFFFFF;
-    m_pPrecompiledEngines[  401] = &ParserBase::PrecompiledExpr_VVFFVFFFVF;
-    m_pPrecompiledEngines[  402] = &ParserBase::PrecompiledExpr_VVFFVFFVFF;
-    m_pPrecompiledEngines[  403] = &ParserBase::PrecompiledExpr_VVFFVFFVVF;
-    m_pPrecompiledEngines[  404] = &ParserBase::PrecompiledExpr_VVFFVFVFFF;
-    m_pPrecompiledEngines[  405] = &ParserBase::PrecompiledExpr_VVFFVFVFVF;
-    m_pPrecompiledEngines[  406] = &ParserBase::PrecompiledExpr_VVFFVFVVFF;
-    m_pPrecompiledEngines[  407] = &ParserBase::PrecompiledExpr_VVFFVFVVVF;
-    m_pPrecompiledEngines[  408] = &ParserBase::PrecompiledExpr_VVFFVVFFFF;
-    m_pPrecompiledEngines[  409] = &ParserBase::PrecompiledExpr_VVFFVVFFVF;
-    m_pPrecompiledEngines[  410] = &ParserBase::PrecompiledExpr_VVFFVVFVFF;
-    m_pPrecompiledEngines[  411] = &ParserBase::PrecompiledExpr_VVFFVVFVVF;
-    m_pPrecompiledEngines[  412] = &ParserBase::PrecompiledExpr_VVFFVVVFFF;
-    m_pPrecompiledEngines[  413] = &ParserBase::PrecompiledExpr_VVFFVVVFVF;
-    m_pPrecompiledEngines[  414] = &ParserBase::PrecompiledExpr_VVFFVVVVFF;
-    m_pPrecompiledEngines[  415] = &ParserBase::PrecompiledExpr_VVFFVVVVVF;
-    m_pPrecompiledEngines[  416] = &ParserBase::PrecompiledExpr_VVFVFFFFFF;
-    m_pPrecompiledEngines[  417] = &ParserBase::PrecompiledExpr_VVFVFFFFVF;
-    m_pPrecompiledEngines[  418] = &ParserBase::PrecompiledExpr_VVFVFFFVFF;
-    m_pPrecompiledEngines[  419] = &ParserBase::PrecompiledExpr_VVFVFFFVVF;
-    m_pPrecompiledEngines[  420] = &ParserBase::PrecompiledExpr_VVFVFFVFFF;
-    m_pPrecompiledEngines[  421] = &ParserBase::PrecompiledExpr_VVFVFFVFVF;
-    m_pPrecompiledEngines[  422] = &ParserBase::PrecompiledExpr_VVFVFFVVFF;
-    m_pPrecompiledEngines[  423] = &ParserBase::PrecompiledExpr_VVFVFFVVVF;
-    m_pPrecompiledEngines[  424] = &ParserBase::PrecompiledExpr_VVFVFVFFFF;
-    m_pPrecompiledEngines[  425] = &ParserBase::PrecompiledExpr_VVFVFVFFVF;
-    m_pPrecompiledEngines[  426] = &ParserBase::PrecompiledExpr_VVFVFVFVFF;
-    m_pPrecompiledEngines[  427] = &ParserBase::PrecompiledExpr_VVFVFVFVVF;
-    m_pPrecompiledEngines[  428] = &ParserBase::PrecompiledExpr_VVFVFVVFFF;
-    m_pPrecompiledEngines[  429] = &ParserBase::PrecompiledExpr_VVFVFVVFVF;
-    m_pPrecompiledEngines[  430] = &ParserBase::PrecompiledExpr_VVFVFVVVFF;
-    m_pPrecompiledEngines[  431] = &ParserBase::PrecompiledExpr_VVFVFVVVVF;
-    m_pPrecompiledEngines[  432] = &ParserBase::PrecompiledExpr_VVFVVFFFFF;
-    m_pPrecompiledEngines[  433] = &ParserBase::PrecompiledExpr_VVFVVFFFVF;
-    m_pPrecompiledEngines[  434] = &ParserBase::PrecompiledExpr_VVFVVFFVFF;
-    m_pPrecompiledEngines[  435] = &ParserBase::PrecompiledExpr_VVFVVFFVVF;
-    m_pPrecompiledEngines[  436] = &ParserBase::PrecompiledExpr_VVFVVFVFFF;
-    m_pPrecompiledEngines[  437] = &ParserBase::PrecompiledExpr_VVFVVFVFVF;
-    m_pPrecompiledEngines[  438] = &ParserBase::PrecompiledExpr_VVFVVFVVFF;
-    m_pPrecompiledEngines[  439] = &ParserBase::PrecompiledExpr_VVFVVFVVVF;
-    m_pPrecompiledEngines[  440] = &ParserBase::PrecompiledExpr_VVFVVVFFFF;
-    m_pPrecompiledEngines[  441] = &ParserBase::PrecompiledExpr_VVFVVVFFVF;
-    m_pPrecompiledEngines[  442] = &ParserBase::PrecompiledExpr_VVFVVVFVFF;
-    m_pPrecompiledEngines[  443] = &ParserBase::PrecompiledExpr_VVFVVVFVVF;
-    m_pPrecompiledEngines[  444] = &ParserBase::PrecompiledExpr_VVFVVVVFFF;
-    m_pPrecompiledEngines[  445] = &ParserBase::PrecompiledExpr_VVFVVVVFVF;
-    m_pPrecompiledEngines[  446] = &ParserBase::PrecompiledExpr_VVFVVVVVFF;
-    m_pPrecompiledEngines[  447] = &ParserBase::PrecompiledExpr_VVFVVVVVVF;
-    m_pPrecompiledEngines[  448] = &ParserBase::PrecompiledExpr_VVVFFFFFFF;
-    m_pPrecompiledEngines[  449] = &ParserBase::PrecompiledExpr_VVVFFFFFVF;
-    m_pPrecompiledEngines[  450] = &ParserBase::PrecompiledExpr_VVVFFFFVFF;
-    m_pPrecompiledEngines[  451] = &ParserBase::PrecompiledExpr_VVVFFFFVVF;
-    m_pPrecompiledEngines[  452] = &ParserBase::PrecompiledExpr_VVVFFFVFFF;
-    m_pPrecompiledEngines[  453] = &ParserBase::PrecompiledExpr_VVVFFFVFVF;
-    m_pPrecompiledEngines[  454] = &ParserBase::PrecompiledExpr_VVVFFFVVFF;
-    m_pPrecompiledEngines[  455] = &ParserBase::PrecompiledExpr_VVVFFFVVVF;
-    m_pPrecompiledEngines[  456] = &ParserBase::PrecompiledExpr_VVVFFVFFFF;
-    m_pPrecompiledEngines[  457] = &ParserBase::PrecompiledExpr_VVVFFVFFVF;
-    m_pPrecompiledEngines[  458] = &ParserBase::PrecompiledExpr_VVVFFVFVFF;
-    m_pPrecompiledEngines[  459] = &ParserBase::PrecompiledExpr_VVVFFVFVVF;
-    m_pPrecompiledEngines[  460] = &ParserBase::PrecompiledExpr_VVVFFVVFFF;
-    m_pPrecompiledEngines[  461] = &ParserBase::PrecompiledExpr_VVVFFVVFVF;
-    m_pPrecompiledEngines[  462] = &ParserBase::PrecompiledExpr_VVVFFVVVFF;
-    m_pPrecompiledEngines[  463] = &ParserBase::PrecompiledExpr_VVVFFVVVVF;
-    m_pPrecompiledEngines[  464] = &ParserBase::PrecompiledExpr_VVVFVFFFFF;
-    m_pPrecompiledEngines[  465] = &ParserBase::PrecompiledExpr_VVVFVFFFVF;
-    m_pPrecompiledEngines[  466] = &ParserBase::PrecompiledExpr_VVVFVFFVFF;
-    m_pPrecompiledEngines[  467] = &ParserBase::PrecompiledExpr_VVVFVFFVVF;
-    m_pPrecompiledEngines[  468] = &ParserBase::PrecompiledExpr_VVVFVFVFFF;
-    m_pPrecompiledEngines[  469] = &ParserBase::PrecompiledExpr_VVVFVFVFVF;
-    m_pPrecompiledEngines[  470] = &ParserBase::PrecompiledExpr_VVVFVFVVFF;
-    m_pPrecompiledEngines[  471] = &ParserBase::PrecompiledExpr_VVVFVFVVVF;
-    m_pPrecompiledEngines[  472] = &ParserBase::PrecompiledExpr_VVVFVVFFFF;
-    m_pPrecompiledEngines[  473] = &ParserBase::PrecompiledExpr_VVVFVVFFVF;
-    m_pPrecompiledEngines[  474] = &ParserBase::PrecompiledExpr_VVVFVVFVFF;
-    m_pPrecompiledEngines[  475] = &ParserBase::PrecompiledExpr_VVVFVVFVVF;
-    m_pPrecompiledEngines[  476] = &ParserBase::PrecompiledExpr_VVVFVVVFFF;
-    m_pPrecompiledEngines[  477] = &ParserBase::PrecompiledExpr_VVVFVVVFVF;
-    m_pPrecompiledEngines[  478] = &ParserBase::PrecompiledExpr_VVVFVVVVFF;
-    m_pPrecompiledEngines[  479] = &ParserBase::PrecompiledExpr_VVVFVVVVVF;
-    m_pPrecompiledEngines[  480] = &ParserBase::PrecompiledExpr_VVVVFFFFFF;
-    m_pPrecompiledEngines[  481] = &ParserBase::PrecompiledExpr_VVVVFFFFVF;
-    m_pPrecompiledEngines[  482] = &ParserBase::PrecompiledExpr_VVVVFFFVFF;
-    m_pPrecompiledEngines[  483] = &ParserBase::PrecompiledExpr_VVVVFFFVVF;
-    m_pPrecompiledEngines[  484] = &ParserBase::PrecompiledExpr_VVVVFFVFFF;
-    m_pPrecompiledEngines[  485] = &ParserBase::PrecompiledExpr_VVVVFFVFVF;
-    m_pPrecompiledEngines[  486] = &ParserBase::PrecompiledExpr_VVVVFFVVFF;
-    m_pPrecompiledEngines[  487] = &ParserBase::PrecompiledExpr_VVVVFFVVVF;
-    m_pPrecompiledEngines[  488] = &ParserBase::PrecompiledExpr_VVVVFVFFFF;
-    m_pPrecompiledEngines[  489] = &ParserBase::PrecompiledExpr_VVVVFVFFVF;
-    m_pPrecompiledEngines[  490] = &ParserBase::PrecompiledExpr_VVVVFVFVFF;
-    m_pPrecompiledEngines[  491] = &ParserBase::PrecompiledExpr_VVVVFVFVVF;
-    m_pPrecompiledEngines[  492] = &ParserBase::PrecompiledExpr_VVVVFVVFFF;
-    m_pPrecompiledEngines[  493] = &ParserBase::PrecompiledExpr_VVVVFVVFVF;
-    m_pPrecompiledEngines[  494] = &ParserBase::PrecompiledExpr_VVVVFVVVFF;
-    m_pPrecompiledEngines[  495] = &ParserBase::PrecompiledExpr_VVVVFVVVVF;
-    m_pPrecompiledEngines[  496] = &ParserBase::PrecompiledExpr_VVVVVFFFFF;
-    m_pPrecompiledEngines[  497] = &ParserBase::PrecompiledExpr_VVVVVFFFVF;
-    m_pPrecompiledEngines[  498] = &ParserBase::PrecompiledExpr_VVVVVFFVFF;
-    m_pPrecompiledEngines[  499] = &ParserBase::PrecompiledExpr_VVVVVFFVVF;
-    m_pPrecompiledEngines[  500] = &ParserBase::PrecompiledExpr_VVVVVFVFFF;
-    m_pPrecompiledEngines[  501] = &ParserBase::PrecompiledExpr_VVVVVFVFVF;
-    m_pPrecompiledEngines[  502] = &ParserBase::PrecompiledExpr_VVVVVFVVFF;
-    m_pPrecompiledEngines[  503] = &ParserBase::PrecompiledExpr_VVVVVFVVVF;
-    m_pPrecompiledEngines[  504] = &ParserBase::PrecompiledExpr_VVVVVVFFFF;
-    m_pPrecompiledEngines[  505] = &ParserBase::PrecompiledExpr_VVVVVVFFVF;
-    m_pPrecompiledEngines[  506] = &ParserBase::PrecompiledExpr_VVVVVVFVFF;
-    m_pPrecompiledEngines[  507] = &ParserBase::PrecompiledExpr_VVVVVVFVVF;
-    m_pPrecompiledEngines[  508] = &ParserBase::PrecompiledExpr_VVVVVVVFFF;
-    m_pPrecompiledEngines[  509] = &ParserBase::PrecompiledExpr_VVVVVVVFVF;
-    m_pPrecompiledEngines[  510] = &ParserBase::PrecompiledExpr_VVVVVVVVFF;
-    m_pPrecompiledEngines[  511] = &ParserBase::PrecompiledExpr_VVVVVVVVVF;
-    m_pPrecompiledEngines[  512] = &ParserBase::PrecompiledExpr_VFFFFFFFFFF;
-    m_pPrecompiledEngines[  513] = &ParserBase::PrecompiledExpr_VFFFFFFFFVF;
-    m_pPrecompiledEngines[  514] = &ParserBase::PrecompiledExpr_VFFFFFFFVFF;
-    m_pPrecompiledEngines[  515] = &ParserBase::PrecompiledExpr_VFFFFFFFVVF;
-    m_pPrecompiledEngines[  516] = &ParserBase::PrecompiledExpr_VFFFFFFVFFF;
-    m_pPrecompiledEngines[  517] = &ParserBase::PrecompiledExpr_VFFFFFFVFVF;
-    m_pPrecompiledEngines[  518] = &ParserBase::PrecompiledExpr_VFFFFFFVVFF;
-    m_pPrecompiledEngines[  519] = &ParserBase::PrecompiledExpr_VFFFFFFVVVF;
-    m_pPrecompiledEngines[  520] = &ParserBase::PrecompiledExpr_VFFFFFVFFFF;
-    m_pPrecompiledEngines[  521] = &ParserBase::PrecompiledExpr_VFFFFFVFFVF;
-    m_pPrecompiledEngines[  522] = &ParserBase::PrecompiledExpr_VFFFFFVFVFF;
-    m_pPrecompiledEngines[  523] = &ParserBase::PrecompiledExpr_VFFFFFVFVVF;
-    m_pPrecompiledEngines[  524] = &ParserBase::PrecompiledExpr_VFFFFFVVFFF;
-    m_pPrecompiledEngines[  525] = &ParserBase::PrecompiledExpr_VFFFFFVVFVF;
-    m_pPrecompiledEngines[  526] = &ParserBase::PrecompiledExpr_VFFFFFVVVFF;
-    m_pPrecompiledEngines[  527] = &ParserBase::PrecompiledExpr_VFFFFFVVVVF;
-    m_pPrecompiledEngines[  528] = &ParserBase::PrecompiledExpr_VFFFFVFFFFF;
-    m_pPrecompiledEngines[  529] = &ParserBase::PrecompiledExpr_VFFFFVFFFVF;
-    m_pPrecompiledEngines[  530] = &ParserBase::PrecompiledExpr_VFFFFVFFVFF;
-    m_pPrecompiledEngines[  531] = &ParserBase::PrecompiledExpr_VFFFFVFFVVF;
-    m_pPrecompiledEngines[  532] = &ParserBase::PrecompiledExpr_VFFFFVFVFFF;
-    m_pPrecompiledEngines[  533] = &ParserBase::PrecompiledExpr_VFFFFVFVFVF;
-    m_pPrecompiledEngines[  534] = &ParserBase::PrecompiledExpr_VFFFFVFVVFF;
-    m_pPrecompiledEngines[  535] = &ParserBase::PrecompiledExpr_VFFFFVFVVVF;
-    m_pPrecompiledEngines[  536] = &ParserBase::PrecompiledExpr_VFFFFVVFFFF;
-    m_pPrecompiledEngines[  537] = &ParserBase::PrecompiledExpr_VFFFFVVFFVF;
-    m_pPrecompiledEngines[  538] = &ParserBase::PrecompiledExpr_VFFFFVVFVFF;
-    m_pPrecompiledEngines[  539] = &ParserBase::PrecompiledExpr_VFFFFVVFVVF;
-    m_pPrecompiledEngines[  540] = &ParserBase::PrecompiledExpr_VFFFFVVVFFF;
-    m_pPrecompiledEngines[  541] = &ParserBase::PrecompiledExpr_VFFFFVVVFVF;
-    m_pPrecompiledEngines[  542] = &ParserBase::PrecompiledExpr_VFFFFVVVVFF;
-    m_pPrecompiledEngines[  543] = &ParserBase::PrecompiledExpr_VFFFFVVVVVF;
-    m_pPrecompiledEngines[  544] = &ParserBase::PrecompiledExpr_VFFFVFFFFFF;
-    m_pPrecompiledEngines[  545] = &ParserBase::PrecompiledExpr_VFFFVFFFFVF;
-    m_pPrecompiledEngines[  546] = &ParserBase::PrecompiledExpr_VFFFVFFFVFF;
-    m_pPrecompiledEngines[  547] = &ParserBase::PrecompiledExpr_VFFFVFFFVVF;
-    m_pPrecompiledEngines[  548] = &ParserBase::PrecompiledExpr_VFFFVFFVFFF;
-    m_pPrecompiledEngines[  549] = &ParserBase::PrecompiledExpr_VFFFVFFVFVF;
-    m_pPrecompiledEngines[  550] = &ParserBase::PrecompiledExpr_VFFFVFFVVFF;
-    m_pPrecompiledEngines[  551] = &ParserBase::PrecompiledExpr_VFFFVFFVVVF;
-    m_pPrecompiledEngines[  552] = &ParserBase::PrecompiledExpr_VFFFVFVFFFF;
-    m_pPrecompiledEngines[  553] = &ParserBase::PrecompiledExpr_VFFFVFVFFVF;
-    m_pPrecompiledEngines[  554] = &ParserBase::PrecompiledExpr_VFFFVFVFVFF;
-    m_pPrecompiledEngines[  555] = &ParserBase::PrecompiledExpr_VFFFVFVFVVF;
-    m_pPrecompiledEngines[  556] = &ParserBase::PrecompiledExpr_VFFFVFVVFFF;
-    m_pPrecompiledEngines[  557] = &ParserBase::PrecompiledExpr_VFFFVFVVFVF;
-    m_pPrecompiledEngines[  558] = &ParserBase::PrecompiledExpr_VFFFVFVVVFF;
-    m_pPrecompiledEngines[  559] = &ParserBase::PrecompiledExpr_VFFFVFVVVVF;
-    m_pPrecompiledEngines[  560] = &ParserBase::PrecompiledExpr_VFFFVVFFFFF;
-    m_pPrecompiledEngines[  561] = &ParserBase::PrecompiledExpr_VFFFVVFFFVF;
-    m_pPrecompiledEngines[  562] = &ParserBase::PrecompiledExpr_VFFFVVFFVFF;
-    m_pPrecompiledEngines[  563] = &ParserBase::PrecompiledExpr_VFFFVVFFVVF;
-    m_pPrecompiledEngines[  564] = &ParserBase::PrecompiledExpr_VFFFVVFVFFF;
-    m_pPrecompiledEngines[  565] = &ParserBase::PrecompiledExpr_VFFFVVFVFVF;
-    m_pPrecompiledEngines[  566] = &ParserBase::PrecompiledExpr_VFFFVVFVVFF;
-    m_pPrecompiledEngines[  567] = &ParserBase::PrecompiledExpr_VFFFVVFVVVF;
-    m_pPrecompiledEngines[  568] = &ParserBase::PrecompiledExpr_VFFFVVVFFFF;
-    m_pPrecompiledEngines[  569] = &ParserBase::PrecompiledExpr_VFFFVVVFFVF;
-    m_pPrecompiledEngines[  570] = &ParserBase::PrecompiledExpr_VFFFVVVFVFF;
-    m_pPrecompiledEngines[  571] = &ParserBase::PrecompiledExpr_VFFFVVVFVVF;
-    m_pPrecompiledEngines[  572] = &ParserBase::PrecompiledExpr_VFFFVVVVFFF;
-    m_pPrecompiledEngines[  573] = &ParserBase::PrecompiledExpr_VFFFVVVVFVF;
-    m_pPrecompiledEngines[  574] = &ParserBase::PrecompiledExpr_VFFFVVVVVFF;
-    m_pPrecompiledEngines[  575] = &ParserBase::PrecompiledExpr_VFFFVVVVVVF;
-    m_pPrecompiledEngines[  576] = &ParserBase::PrecompiledExpr_VFFVFFFFFFF;
-    m_pPrecompiledEngines[  577] = &ParserBase::PrecompiledExpr_VFFVFFFFFVF;
-    m_pPrecompiledEngines[  578] = &ParserBase::PrecompiledExpr_VFFVFFFFVFF;
-    m_pPrecompiledEngines[  579] = &ParserBase::PrecompiledExpr_VFFVFFFFVVF;
-    m_pPrecompiledEngines[  580] = &ParserBase::PrecompiledExpr_VFFVFFFVFFF;
-    m_pPrecompiledEngines[  581] = &ParserBase::PrecompiledExpr_VFFVFFFVFVF;
-    m_pPrecompiledEngines[  582] = &ParserBase::PrecompiledExpr_VFFVFFFVVFF;
-    m_pPrecompiledEngines[  583] = &ParserBase::PrecompiledExpr_VFFVFFFVVVF;
-    m_pPrecompiledEngines[  584] = &ParserBase::PrecompiledExpr_VFFVFFVFFFF;
-    m_pPrecompiledEngines[  585] = &ParserBase::PrecompiledExpr_VFFVFFVFFVF;
-    m_pPrecompiledEngines[  586] = &ParserBase::PrecompiledExpr_VFFVFFVFVFF;
-    m_pPrecompiledEngines[  587] = &ParserBase::PrecompiledExpr_VFFVFFVFVVF;
-    m_pPrecompiledEngines[  588] = &ParserBase::PrecompiledExpr_VFFVFFVVFFF;
-    m_pPrecompiledEngines[  589] = &ParserBase::PrecompiledExpr_VFFVFFVVFVF;
-    m_pPrecompiledEngines[  590] = &ParserBase::PrecompiledExpr_VFFVFFVVVFF;
-    m_pPrecompiledEngines[  591] = &ParserBase::PrecompiledExpr_VFFVFFVVVVF;
-    m_pPrecompiledEngines[  592] = &ParserBase::PrecompiledExpr_VFFVFVFFFFF;
-    m_pPrecompiledEngines[  593] = &ParserBase::PrecompiledExpr_VFFVFVFFFVF;
-    m_pPrecompiledEngines[  594] = &ParserBase::PrecompiledExpr_VFFVFVFFVFF;
-    m_pPrecompiledEngines[  595] = &ParserBase::PrecompiledExpr_VFFVFVFFVVF;
-    m_pPrecompiledEngines[  596] = &ParserBase::PrecompiledExpr_VFFVFVFVFFF;
-    m_pPrecompiledEngines[  597] = &ParserBase::PrecompiledExpr_VFFVFVFVFVF;
-    m_pPrecompiledEngines[  598] = &ParserBase::PrecompiledExpr_VFFVFVFVVFF;
-    m_pPrecompiledEngines[  599] = &ParserBase::PrecompiledExpr_VFFVFVFVVVF;
-    m_pPrecompiledEngines[  600] = &ParserBase::PrecompiledExpr_VFFVFVVFFFF;
-    m_pPrecompiledEngines[  601] = &ParserBase::PrecompiledExpr_VFFVFVVFFVF;
-    m_pPrecompiledEngines[  602] = &ParserBase::PrecompiledExpr_VFFVFVVFVFF;
-    m_pPrecompiledEngines[  603] = &ParserBase::PrecompiledExpr_VFFVFVVFVVF;
-    m_pPrecompiledEngines[  604] = &ParserBase::PrecompiledExpr_VFFVFVVVFFF;
-    m_pPrecompiledEngines[  605] = &ParserBase::PrecompiledExpr_VFFVFVVVFVF;
-    m_pPrecompiledEngines[  606] = &ParserBase::PrecompiledExpr_VFFVFVVVVFF;
-    m_pPrecompiledEngines[  607] = &ParserBase::PrecompiledExpr_VFFVFVVVVVF;
-    m_pPrecompiledEngines[  608] = &ParserBase::PrecompiledExpr_VFFVVFFFFFF;
-    m_pPrecompiledEngines[  609] = &ParserBase::PrecompiledExpr_VFFVVFFFFVF;
-    m_pPrecompiledEngines[  610] = &ParserBase::PrecompiledExpr_VFFVVFFFVFF;
-    m_pPrecompiledEngines[  611] = &ParserBase::PrecompiledExpr_VFFVVFFFVVF;
-    m_pPrecompiledEngines[  612] = &ParserBase::PrecompiledExpr_VFFVVFFVFFF;
-    m_pPrecompiledEngines[  613] = &ParserBase::PrecompiledExpr_VFFVVFFVFVF;
-    m_pPrecompiledEngines[  614] = &ParserBase::PrecompiledExpr_VFFVVFFVVFF;
-    m_pPrecompiledEngines[  615] = &ParserBase::PrecompiledExpr_VFFVVFFVVVF;
-    m_pPrecompiledEngines[  616] = &ParserBase::PrecompiledExpr_VFFVVFVFFFF;
-    m_pPrecompiledEngines[  617] = &ParserBase::PrecompiledExpr_VFFVVFVFFVF;
-    m_pPrecompiledEngines[  618] = &ParserBase::PrecompiledExpr_VFFVVFVFVFF;
-    m_pPrecompiledEngines[  619] = &ParserBase::PrecompiledExpr_VFFVVFVFVVF;
-    m_pPrecompiledEngines[  620] = &ParserBase::PrecompiledExpr_VFFVVFVVFFF;
-    m_pPrecompiledEngines[  621] = &ParserBase::PrecompiledExpr_VFFVVFVVFVF;
-    m_pPrecompiledEngines[  622] = &ParserBase::PrecompiledExpr_VFFVVFVVVFF;
-    m_pPrecompiledEngines[  623] = &ParserBase::PrecompiledExpr_VFFVVFVVVVF;
-    m_pPrecompiledEngines[  624] = &ParserBase::PrecompiledExpr_VFFVVVFFFFF;
-    m_pPrecompiledEngines[  625] = &ParserBase::PrecompiledExpr_VFFVVVFFFVF;
-    m_pPrecompiledEngines[  626] = &ParserBase::PrecompiledExpr_VFFVVVFFVFF;
-    m_pPrecompiledEngines[  627] = &ParserBase::PrecompiledExpr_VFFVVVFFVVF;
-    m_pPrecompiledEngines[  628] = &ParserBase::PrecompiledExpr_VFFVVVFVFFF;
-    m_pPrecompiledEngines[  629] = &ParserBase::PrecompiledExpr_VFFVVVFVFVF;
-    m_pPrecompiledEngines[  630] = &ParserBase::PrecompiledExpr_VFFVVVFVVFF;
-    m_pPrecompiledEngines[  631] = &ParserBase::PrecompiledExpr_VFFVVVFVVVF;
-    m_pPrecompiledEngines[  632] = &ParserBase::PrecompiledExpr_VFFVVVVFFFF;
-    m_pPrecompiledEngines[  633] = &ParserBase::PrecompiledExpr_VFFVVVVFFVF;
-    m_pPrecompiledEngines[  634] = &ParserBase::PrecompiledExpr_VFFVVVVFVFF;
-    m_pPrecompiledEngines[  635] = &ParserBase::PrecompiledExpr_VFFVVVVFVVF;
-    m_pPrecompiledEngines[  636] = &ParserBase::PrecompiledExpr_VFFVVVVVFFF;
-    m_pPrecompiledEngines[  637] = &ParserBase::PrecompiledExpr_VFFVVVVVFVF;
-    m_pPrecompiledEngines[  638] = &ParserBase::PrecompiledExpr_VFFVVVVVVFF;
-    m_pPrecompiledEngines[  639] = &ParserBase::PrecompiledExpr_VFFVVVVVVVF;
-    m_pPrecompiledEngines[  640] = &ParserBase::PrecompiledExpr_VFVFFFFFFFF;
-    m_pPrecompiledEngines[  641] = &ParserBase::PrecompiledExpr_VFVFFFFFFVF;
-    m_pPrecompiledEngines[  642] = &ParserBase::PrecompiledExpr_VFVFFFFFVFF;
-    m_pPrecompiledEngines[  643] = &ParserBase::PrecompiledExpr_VFVFFFFFVVF;
-    m_pPrecompiledEngines[  644] = &ParserBase::PrecompiledExpr_VFVFFFFVFFF;
-    m_pPrecompiledEngines[  645] = &ParserBase::PrecompiledExpr_VFVFFFFVFVF;
-    m_pPrecompiledEngines[  646] = &ParserBase::PrecompiledExpr_VFVFFFFVVFF;
-    m_pPrecompiledEngines[  647] = &ParserBase::PrecompiledExpr_VFVFFFFVVVF;
-    m_pPrecompiledEngines[  648] = &ParserBase::PrecompiledExpr_VFVFFFVFFFF;
-    m_pPrecompiledEngines[  649] = &ParserBase::PrecompiledExpr_VFVFFFVFFVF;
-    m_pPrecompiledEngines[  650] = &ParserBase::PrecompiledExpr_VFVFFFVFVFF;
-    m_pPrecompiledEngines[  651] = &ParserBase::PrecompiledExpr_VFVFFFVFVVF;
-    m_pPrecompiledEngines[  652] = &ParserBase::PrecompiledExpr_VFVFFFVVFFF;
-    m_pPrecompiledEngines[  653] = &ParserBase::PrecompiledExpr_VFVFFFVVFVF;
-    m_pPrecompiledEngines[  654] = &ParserBase::PrecompiledExpr_VFVFFFVVVFF;
-    m_pPrecompiledEngines[  655] = &ParserBase::PrecompiledExpr_VFVFFFVVVVF;
-    m_pPrecompiledEngines[  656] = &ParserBase::PrecompiledExpr_VFVFFVFFFFF;
-    m_pPrecompiledEngines[  657] = &ParserBase::PrecompiledExpr_VFVFFVFFFVF;
-    m_pPrecompiledEngines[  658] = &ParserBase::PrecompiledExpr_VFVFFVFFVFF;
-    m_pPrecompiledEngines[  659] = &ParserBase::PrecompiledExpr_VFVFFVFFVVF;
-    m_pPrecompiledEngines[  660] = &ParserBase::PrecompiledExpr_VFVFFVFVFFF;
-    m_pPrecompiledEngines[  661] = &ParserBase::PrecompiledExpr_VFVFFVFVFVF;
-    m_pPrecompiledEngines[  662] = &ParserBase::PrecompiledExpr_VFVFFVFVVFF;
-    m_pPrecompiledEngines[  663] = &ParserBase::PrecompiledExpr_VFVFFVFVVVF;
-    m_pPrecompiledEngines[  664] = &ParserBase::PrecompiledExpr_VFVFFVVFFFF;
-    m_pPrecompiledEngines[  665] = &ParserBase::PrecompiledExpr_VFVFFVVFFVF;
-    m_pPrecompiledEngines[  666] = &ParserBase::PrecompiledExpr_VFVFFVVFVFF;
-    m_pPrecompiledEngines[  667] = &ParserBase::PrecompiledExpr_VFVFFVVFVVF;
-    m_pPrecompiledEngines[  668] = &ParserBase::PrecompiledExpr_VFVFFVVVFFF;
-    m_pPrecompiledEngines[  669] = &ParserBase::PrecompiledExpr_VFVFFVVVFVF;
-    m_pPrecompiledEngines[  670] = &ParserBase::PrecompiledExpr_VFVFFVVVVFF;
-    m_pPrecompiledEngines[  671] = &ParserBase::PrecompiledExpr_VFVFFVVVVVF;
-    m_pPrecompiledEngines[  672] = &ParserBase::PrecompiledExpr_VFVFVFFFFFF;
-    m_pPrecompiledEngines[  673] = &ParserBase::PrecompiledExpr_VFVFVFFFFVF;
-    m_pPrecompiledEngines[  674] = &ParserBase::PrecompiledExpr_VFVFVFFFVFF;
-    m_pPrecompiledEngines[  675] = &ParserBase::PrecompiledExpr_VFVFVFFFVVF;
-    m_pPrecompiledEngines[  676] = &ParserBase::PrecompiledExpr_VFVFVFFVFFF;
-    m_pPrecompiledEngines[  677] = &ParserBase::PrecompiledExpr_VFVFVFFVFVF;
-    m_pPrecompiledEngines[  678] = &ParserBase::PrecompiledExpr_VFVFVFFVVFF;
-    m_pPrecompiledEngines[  679] = &ParserBase::PrecompiledExpr_VFVFVFFVVVF;
-    m_pPrecompiledEngines[  680] = &ParserBase::PrecompiledExpr_VFVFVFVFFFF;
-    m_pPrecompiledEngines[  681] = &ParserBase::PrecompiledExpr_VFVFVFVFFVF;
-    m_pPrecompiledEngines[  682] = &ParserBase::PrecompiledExpr_VFVFVFVFVFF;
-    m_pPrecompiledEngines[  683] = &ParserBase::PrecompiledExpr_VFVFVFVFVVF;
-    m_pPrecompiledEngines[  684] = &ParserBase::PrecompiledExpr_VFVFVFVVFFF;
-    m_pPrecompiledEngines[  685] = &ParserBase::PrecompiledExpr_VFVFVFVVFVF;
-    m_pPrecompiledEngines[  686] = &ParserBase::PrecompiledExpr_VFVFVFVVVFF;
-    m_pPrecompiledEngines[  687] = &ParserBase::PrecompiledExpr_VFVFVFVVVVF;
-    m_pPrecompiledEngines[  688] = &ParserBase::PrecompiledExpr_VFVFVVFFFFF;
-    m_pPrecompiledEngines[  689] = &ParserBase::PrecompiledExpr_VFVFVVFFFVF;
-    m_pPrecompiledEngines[  690] = &ParserBase::PrecompiledExpr_VFVFVVFFVFF;
-    m_pPrecompiledEngines[  691] = &ParserBase::PrecompiledExpr_VFVFVVFFVVF;
-    m_pPrecompiledEngines[  692] = &ParserBase::PrecompiledExpr_VFVFVVFVFFF;
-    m_pPrecompiledEngines[  693] = &ParserBase::PrecompiledExpr_VFVFVVFVFVF;
-    m_pPrecompiledEngines[  694] = &ParserBase::PrecompiledExpr_VFVFVVFVVFF;
-    m_pPrecompiledEngines[  695] = &ParserBase::PrecompiledExpr_VFVFVVFVVVF;
-    m_pPrecompiledEngines[  696] = &ParserBase::PrecompiledExpr_VFVFVVVFFFF;
-    m_pPrecompiledEngines[  697] = &ParserBase::PrecompiledExpr_VFVFVVVFFVF;
-    m_pPrecompiledEngines[  698] = &ParserBase::PrecompiledExpr_VFVFVVVFVFF;
-    m_pPrecompiledEngines[  699] = &ParserBase::PrecompiledExpr_VFVFVVVFVVF;
-    m_pPrecompiledEngines[  700] = &ParserBase::PrecompiledExpr_VFVFVVVVFFF;
-    m_pPrecompiledEngines[  701] = &ParserBase::PrecompiledExpr_VFVFVVVVFVF;
-    m_pPrecompiledEngines[  702] = &ParserBase::PrecompiledExpr_VFVFVVVVVFF;
-    m_pPrecompiledEngines[  703] = &ParserBase::PrecompiledExpr_VFVFVVVVVVF;
-    m_pPrecompiledEngines[  704] = &ParserBase::PrecompiledExpr_VFVVFFFFFFF;
-    m_pPrecompiledEngines[  705] = &ParserBase::PrecompiledExpr_VFVVFFFFFVF;
-    m_pPrecompiledEngines[  706] = &ParserBase::PrecompiledExpr_VFVVFFFFVFF;
-    m_pPrecompiledEngines[  707] = &ParserBase::PrecompiledExpr_VFVVFFFFVVF;
-    m_pPrecompiledEngines[  708] = &ParserBase::PrecompiledExpr_VFVVFFFVFFF;
-    m_pPrecompiledEngines[  709] = &ParserBase::PrecompiledExpr_VFVVFFFVFVF;
-    m_pPrecompiledEngines[  710] = &ParserBase::PrecompiledExpr_VFVVFFFVVFF;
-    m_pPrecompiledEngines[  711] = &ParserBase::PrecompiledExpr_VFVVFFFVVVF;
-    m_pPrecompiledEngines[  712] = &ParserBase::PrecompiledExpr_VFVVFFVFFFF;
-    m_pPrecompiledEngines[  713] = &ParserBase::PrecompiledExpr_VFVVFFVFFVF;
-    m_pPrecompiledEngines[  714] = &ParserBase::PrecompiledExpr_VFVVFFVFVFF;
-    m_pPrecompiledEngines[  715] = &ParserBase::PrecompiledExpr_VFVVFFVFVVF;
-    m_pPrecompiledEngines[  716] = &ParserBase::PrecompiledExpr_VFVVFFVVFFF;
-    m_pPrecompiledEngines[  717] = &ParserBase::PrecompiledExpr_VFVVFFVVFVF;
-    m_pPrecompiledEngines[  718] = &ParserBase::PrecompiledExpr_VFVVFFVVVFF;
-    m_pPrecompiledEngines[  719] = &ParserBase::PrecompiledExpr_VFVVFFVVVVF;
-    m_pPrecompiledEngines[  720] = &ParserBase::PrecompiledExpr_VFVVFVFFFFF;
-    m_pPrecompiledEngines[  721] = &ParserBase::PrecompiledExpr_VFVVFVFFFVF;
-    m_pPrecompiledEngines[  722] = &ParserBase::PrecompiledExpr_VFVVFVFFVFF;
-    m_pPrecompiledEngines[  723] = &ParserBase::PrecompiledExpr_VFVVFVFFVVF;
-    m_pPrecompiledEngines[  724] = &ParserBase::PrecompiledExpr_VFVVFVFVFFF;
-    m_pPrecompiledEngines[  725] = &ParserBase::PrecompiledExpr_VFVVFVFVFVF;
-    m_pPrecompiledEngines[  726] = &ParserBase::PrecompiledExpr_VFVVFVFVVFF;
-    m_pPrecompiledEngines[  727] = &ParserBase::PrecompiledExpr_VFVVFVFVVVF;
-    m_pPrecompiledEngines[  728] = &ParserBase::PrecompiledExpr_VFVVFVVFFFF;
-    m_pPrecompiledEngines[  729] = &ParserBase::PrecompiledExpr_VFVVFVVFFVF;
-    m_pPrecompiledEngines[  730] = &ParserBase::PrecompiledExpr_VFVVFVVFVFF;
-    m_pPrecompiledEngines[  731] = &ParserBase::PrecompiledExpr_VFVVFVVFVVF;
-    m_pPrecompiledEngines[  732] = &ParserBase::PrecompiledExpr_VFVVFVVVFFF;
-    m_pPrecompiledEngines[  733] = &ParserBase::PrecompiledExpr_VFVVFVVVFVF;
-    m_pPrecompiledEngines[  734] = &ParserBase::PrecompiledExpr_VFVVFVVVVFF;
-    m_pPrecompiledEngines[  735] = &ParserBase::PrecompiledExpr_VFVVFVVVVVF;
-    m_pPrecompiledEngines[  736] = &ParserBase::PrecompiledExpr_VFVVVFFFFFF;
-    m_pPrecompiledEngines[  737] = &ParserBase::PrecompiledExpr_VFVVVFFFFVF;
-    m_pPrecompiledEngines[  738] = &ParserBase::PrecompiledExpr_VFVVVFFFVFF;
-    m_pPrecompiledEngines[  739] = &ParserBase::PrecompiledExpr_VFVVVFFFVVF;
-    m_pPrecompiledEngines[  740] = &ParserBase::PrecompiledExpr_VFVVVFFVFFF;
-    m_pPrecompiledEngines[  741] = &ParserBase::PrecompiledExpr_VFVVVFFVFVF;
-    m_pPrecompiledEngines[  742] = &ParserBase::PrecompiledExpr_VFVVVFFVVFF;
-    m_pPrecompiledEngines[  743] = &ParserBase::PrecompiledExpr_VFVVVFFVVVF;
-    m_pPrecompiledEngines[  744] = &ParserBase::PrecompiledExpr_VFVVVFVFFFF;
-    m_pPrecompiledEngines[  745] = &ParserBase::PrecompiledExpr_VFVVVFVFFVF;
-    m_pPrecompiledEngines[  746] = &ParserBase::PrecompiledExpr_VFVVVFVFVFF;
-    m_pPrecompiledEngines[  747] = &ParserBase::PrecompiledExpr_VFVVVFVFVVF;
-    m_pPrecompiledEngines[  748] = &ParserBase::PrecompiledExpr_VFVVVFVVFFF;
-    m_pPrecompiledEngines[  749] = &ParserBase::PrecompiledExpr_VFVVVFVVFVF;
-    m_pPrecompiledEngines[  750] = &ParserBase::PrecompiledExpr_VFVVVFVVVFF;
-    m_pPrecompiledEngines[  751] = &ParserBase::PrecompiledExpr_VFVVVFVVVVF;
-    m_pPrecompiledEngines[  752] = &ParserBase::PrecompiledExpr_VFVVVVFFFFF;
-    m_pPrecompiledEngines[  753] = &ParserBase::PrecompiledExpr_VFVVVVFFFVF;
-    m_pPrecompiledEngines[  754] = &ParserBase::PrecompiledExpr_VFVVVVFFVFF;
-    m_pPrecompiledEngines[  755] = &ParserBase::PrecompiledExpr_VFVVVVFFVVF;
-    m_pPrecompiledEngines[  756] = &ParserBase::PrecompiledExpr_VFVVVVFVFFF;
-    m_pPrecompiledEngines[  757] = &ParserBase::PrecompiledExpr_VFVVVVFVFVF;
-    m_pPrecompiledEngines[  758] = &ParserBase::PrecompiledExpr_VFVVVVFVVFF;
-    m_pPrecompiledEngines[  759] = &ParserBase::PrecompiledExpr_VFVVVVFVVVF;
-    m_pPrecompiledEngines[  760] = &ParserBase::PrecompiledExpr_VFVVVVVFFFF;
-    m_pPrecompiledEngines[  761] = &ParserBase::PrecompiledExpr_VFVVVVVFFVF;
-    m_pPrecompiledEngines[  762] = &ParserBase::PrecompiledExpr_VFVVVVVFVFF;
-    m_pPrecompiledEngines[  763] = &ParserBase::PrecompiledExpr_VFVVVVVFVVF;
-    m_pPrecompiledEngines[  764] = &ParserBase::PrecompiledExpr_VFVVVVVVFFF;
-    m_pPrecompiledEngines[  765] = &ParserBase::PrecompiledExpr_VFVVVVVVFVF;
-    m_pPrecompiledEngines[  766] = &ParserBase::PrecompiledExpr_VFVVVVVVVFF;
-    m_pPrecompiledEngines[  767] = &ParserBase::PrecompiledExpr_VFVVVVVVVVF;
-    m_pPrecompiledEngines[  768] = &ParserBase::PrecompiledExpr_VVFFFFFFFFF;
-    m_pPrecompiledEngines[  769] = &ParserBase::PrecompiledExpr_VVFFFFFFFVF;
-    m_pPrecompiledEngines[  770] = &ParserBase::PrecompiledExpr_VVFFFFFFVFF;
-    m_pPrecompiledEngines[  771] = &ParserBase::PrecompiledExpr_VVFFFFFFVVF;
-    m_pPrecompiledEngines[  772] = &ParserBase::PrecompiledExpr_VVFFFFFVFFF;
-    m_pPrecompiledEngines[  773] = &ParserBase::PrecompiledExpr_VVFFFFFVFVF;
-    m_pPrecompiledEngines[  774] = &ParserBase::PrecompiledExpr_VVFFFFFVVFF;
-    m_pPrecompiledEngines[  775] = &ParserBase::PrecompiledExpr_VVFFFFFVVVF;
-    m_pPrecompiledEngines[  776] = &ParserBase::PrecompiledExpr_VVFFFFVFFFF;
-    m_pPrecompiledEngines[  777] = &ParserBase::PrecompiledExpr_VVFFFFVFFVF;
-    m_pPrecompiledEngines[  778] = &ParserBase::PrecompiledExpr_VVFFFFVFVFF;
-    m_pPrecompiledEngines[  779] = &ParserBase::PrecompiledExpr_VVFFFFVFVVF;
-    m_pPrecompiledEngines[  780] = &ParserBase::PrecompiledExpr_VVFFFFVVFFF;
-    m_pPrecompiledEngines[  781] = &ParserBase::PrecompiledExpr_VVFFFFVVFVF;
-    m_pPrecompiledEngines[  782] = &ParserBase::PrecompiledExpr_VVFFFFVVVFF;
-    m_pPrecompiledEngines[  783] = &ParserBase::PrecompiledExpr_VVFFFFVVVVF;
-    m_pPrecompiledEngines[  784] = &ParserBase::PrecompiledExpr_VVFFFVFFFFF;
-    m_pPrecompiledEngines[  785] = &ParserBase::PrecompiledExpr_VVFFFVFFFVF;
-    m_pPrecompiledEngines[  786] = &ParserBase::PrecompiledExpr_VVFFFVFFVFF;
-    m_pPrecompiledEngines[  787] = &ParserBase::PrecompiledExpr_VVFFFVFFVVF;
-    m_pPrecompiledEngines[  788] = &ParserBase::PrecompiledExpr_VVFFFVFVFFF;
-    m_pPrecompiledEngines[  789] = &ParserBase::PrecompiledExpr_VVFFFVFVFVF;
-    m_pPrecompiledEngines[  790] = &ParserBase::PrecompiledExpr_VVFFFVFVVFF;
-    m_pPrecompiledEngines[  791] = &ParserBase::PrecompiledExpr_VVFFFVFVVVF;
-    m_pPrecompiledEngines[  792] = &ParserBase::PrecompiledExpr_VVFFFVVFFFF;
-    m_pPrecompiledEngines[  793] = &ParserBase::PrecompiledExpr_VVFFFVVFFVF;
-    m_pPrecompiledEngines[  794] = &ParserBase::PrecompiledExpr_VVFFFVVFVFF;
-    m_pPrecompiledEngines[  795] = &ParserBase::PrecompiledExpr_VVFFFVVFVVF;
-    m_pPrecompiledEngines[  796] = &ParserBase::PrecompiledExpr_VVFFFVVVFFF;
-    m_pPrecompiledEngines[  797] = &ParserBase::PrecompiledExpr_VVFFFVVVFVF;
-    m_pPrecompiledEngines[  798] = &ParserBase::PrecompiledExpr_VVFFFVVVVFF;
-    m_pPrecompiledEngines[  799] = &ParserBase::PrecompiledExpr_VVFFFVVVVVF;
-    m_pPrecompiledEngines[  800] = &ParserBase::PrecompiledExpr_VVFFVFFFFFF;
-    m_pPrecompiledEngines[  801] = &ParserBase::PrecompiledExpr_VVFFVFFFFVF;
-    m_pPrecompiledEngines[  802] = &ParserBase::PrecompiledExpr_VVFFVFFFVFF;
-    m_pPrecompiledEngines[  803] = &ParserBase::PrecompiledExpr_VVFFVFFFVVF;
-    m_pPrecompiledEngines[  804] = &ParserBase::PrecompiledExpr_VVFFVFFVFFF;
-    m_pPrecompiledEngines[  805] = &ParserBase::PrecompiledExpr_VVFFVFFVFVF;
-    m_pPrecompiledEngines[  806] = &ParserBase::PrecompiledExpr_VVFFVFFVVFF;
-    m_pPrecompiledEngines[  807] = &ParserBase::PrecompiledExpr_VVFFVFFVVVF;
-    m_pPrecompiledEngines[  808] = &ParserBase::PrecompiledExpr_VVFFVFVFFFF;
-    m_pPrecompiledEngines[  809] = &ParserBase::PrecompiledExpr_VVFFVFVFFVF;
-    m_pPrecompiledEngines[  810] = &ParserBase::PrecompiledExpr_VVFFVFVFVFF;
-    m_pPrecompiledEngines[  811] = &ParserBase::PrecompiledExpr_VVFFVFVFVVF;
-    m_pPrecompiledEngines[  812] = &ParserBase::PrecompiledExpr_VVFFVFVVFFF;
-    m_pPrecompiledEngines[  813] = &ParserBase::PrecompiledExpr_VVFFVFVVFVF;
-    m_pPrecompiledEngines[  814] = &ParserBase::PrecompiledExpr_VVFFVFVVVFF;
-    m_pPrecompiledEngines[  815] = &ParserBase::PrecompiledExpr_VVFFVFVVVVF;
-    m_pPrecompiledEngines[  816] = &ParserBase::PrecompiledExpr_VVFFVVFFFFF;
-    m_pPrecompiledEngines[  817] = &ParserBase::PrecompiledExpr_VVFFVVFFFVF;
-    m_pPrecompiledEngines[  818] = &ParserBase::PrecompiledExpr_VVFFVVFFVFF;
-    m_pPrecompiledEngines[  819] = &ParserBase::PrecompiledExpr_VVFFVVFFVVF;
-    m_pPrecompiledEngines[  820] = &ParserBase::PrecompiledExpr_VVFFVVFVFFF;
-    m_pPrecompiledEngines[  821] = &ParserBase::PrecompiledExpr_VVFFVVFVFVF;
-    m_pPrecompiledEngines[  822] = &ParserBase::PrecompiledExpr_VVFFVVFVVFF;
-    m_pPrecompiledEngines[  823] = &ParserBase::PrecompiledExpr_VVFFVVFVVVF;
-    m_pPrecompiledEngines[  824] = &ParserBase::PrecompiledExpr_VVFFVVVFFFF;
-    m_pPrecompiledEngines[  825] = &ParserBase::PrecompiledExpr_VVFFVVVFFVF;
-    m_pPrecompiledEngines[  826] = &ParserBase::PrecompiledExpr_VVFFVVVFVFF;
-    m_pPrecompiledEngines[  827] = &ParserBase::PrecompiledExpr_VVFFVVVFVVF;
-    m_pPrecompiledEngines[  828] = &ParserBase::PrecompiledExpr_VVFFVVVVFFF;
-    m_pPrecompiledEngines[  829] = &ParserBase::PrecompiledExpr_VVFFVVVVFVF;
-    m_pPrecompiledEngines[  830] = &ParserBase::PrecompiledExpr_VVFFVVVVVFF;
-    m_pPrecompiledEngines[  831] = &ParserBase::PrecompiledExpr_VVFFVVVVVVF;
-    m_pPrecompiledEngines[  832] = &ParserBase::PrecompiledExpr_VVFVFFFFFFF;
-    m_pPrecompiledEngines[  833] = &ParserBase::PrecompiledExpr_VVFVFFFFFVF;
-    m_pPrecompiledEngines[  834] = &ParserBase::PrecompiledExpr_VVFVFFFFVFF;
-    m_pPrecompiledEngines[  835] = &ParserBase::PrecompiledExpr_VVFVFFFFVVF;
-    m_pPrecompiledEngines[  836] = &ParserBase::PrecompiledExpr_VVFVFFFVFFF;
-    m_pPrecompiledEngines[  837] = &ParserBase::PrecompiledExpr_VVFVFFFVFVF;
-    m_pPrecompiledEngines[  838] = &ParserBase::PrecompiledExpr_VVFVFFFVVFF;
-    m_pPrecompiledEngines[  839] = &ParserBase::PrecompiledExpr_VVFVFFFVVVF;
-    m_pPrecompiledEngines[  840] = &ParserBase::PrecompiledExpr_VVFVFFVFFFF;
-    m_pPrecompiledEngines[  841] = &ParserBase::PrecompiledExpr_VVFVFFVFFVF;
-    m_pPrecompiledEngines[  842] = &ParserBase::PrecompiledExpr_VVFVFFVFVFF;
-    m_pPrecompiledEngines[  843] = &ParserBase::PrecompiledExpr_VVFVFFVFVVF;
-    m_pPrecompiledEngines[  844] = &ParserBase::PrecompiledExpr_VVFVFFVVFFF;
-    m_pPrecompiledEngines[  845] = &ParserBase::PrecompiledExpr_VVFVFFVVFVF;
-    m_pPrecompiledEngines[  846] = &ParserBase::PrecompiledExpr_VVFVFFVVVFF;
-    m_pPrecompiledEngines[  847] = &ParserBase::PrecompiledExpr_VVFVFFVVVVF;
-    m_pPrecompiledEngines[  848] = &ParserBase::PrecompiledExpr_VVFVFVFFFFF;
-    m_pPrecompiledEngines[  849] = &ParserBase::PrecompiledExpr_VVFVFVFFFVF;
-    m_pPrecompiledEngines[  850] = &ParserBase::PrecompiledExpr_VVFVFVFFVFF;
-    m_pPrecompiledEngines[  851] = &ParserBase::PrecompiledExpr_VVFVFVFFVVF;
-    m_pPrecompiledEngines[  852] = &ParserBase::PrecompiledExpr_VVFVFVFVFFF;
-    m_pPrecompiledEngines[  853] = &ParserBase::PrecompiledExpr_VVFVFVFVFVF;
-    m_pPrecompiledEngines[  854] = &ParserBase::PrecompiledExpr_VVFVFVFVVFF;
-    m_pPrecompiledEngines[  855] = &ParserBase::PrecompiledExpr_VVFVFVFVVVF;
-    m_pPrecompiledEngines[  856] = &ParserBase::PrecompiledExpr_VVFVFVVFFFF;
-    m_pPrecompiledEngines[  857] = &ParserBase::PrecompiledExpr_VVFVFVVFFVF;
-    m_pPrecompiledEngines[  858] = &ParserBase::PrecompiledExpr_VVFVFVVFVFF;
-    m_pPrecompiledEngines[  859] = &ParserBase::PrecompiledExpr_VVFVFVVFVVF;
-    m_pPrecompiledEngines[  860] = &ParserBase::PrecompiledExpr_VVFVFVVVFFF;
-    m_pPrecompiledEngines[  861] = &ParserBase::PrecompiledExpr_VVFVFVVVFVF;
-    m_pPrecompiledEngines[  862] = &ParserBase::PrecompiledExpr_VVFVFVVVVFF;
-    m_pPrecompiledEngines[  863] = &ParserBase::PrecompiledExpr_VVFVFVVVVVF;
-    m_pPrecompiledEngines[  864] = &ParserBase::PrecompiledExpr_VVFVVFFFFFF;
-    m_pPrecompiledEngines[  865] = &ParserBase::PrecompiledExpr_VVFVVFFFFVF;
-    m_pPrecompiledEngines[  866] = &ParserBase::PrecompiledExpr_VVFVVFFFVFF;
-    m_pPrecompiledEngines[  867] = &ParserBase::PrecompiledExpr_VVFVVFFFVVF;
-    m_pPrecompiledEngines[  868] = &ParserBase::PrecompiledExpr_VVFVVFFVFFF;
-    m_pPrecompiledEngines[  869] = &ParserBase::PrecompiledExpr_VVFVVFFVFVF;
-    m_pPrecompiledEngines[  870] = &ParserBase::PrecompiledExpr_VVFVVFFVVFF;
-    m_pPrecompiledEngines[  871] = &ParserBase::PrecompiledExpr_VVFVVFFVVVF;
-    m_pPrecompiledEngines[  872] = &ParserBase::PrecompiledExpr_VVFVVFVFFFF;
-    m_pPrecompiledEngines[  873] = &ParserBase::PrecompiledExpr_VVFVVFVFFVF;
-    m_pPrecompiledEngines[  874] = &ParserBase::PrecompiledExpr_VVFVVFVFVFF;
-    m_pPrecompiledEngines[  875] = &ParserBase::PrecompiledExpr_VVFVVFVFVVF;
-    m_pPrecompiledEngines[  876] = &ParserBase::PrecompiledExpr_VVFVVFVVFFF;
-    m_pPrecompiledEngines[  877] = &ParserBase::PrecompiledExpr_VVFVVFVVFVF;
-    m_pPrecompiledEngines[  878] = &ParserBase::PrecompiledExpr_VVFVVFVVVFF;
-    m_pPrecompiledEngines[  879] = &ParserBase::PrecompiledExpr_VVFVVFVVVVF;
-    m_pPrecompiledEngines[  880] = &ParserBase::PrecompiledExpr_VVFVVVFFFFF;
-    m_pPrecompiledEngines[  881] = &ParserBase::PrecompiledExpr_VVFVVVFFFVF;
-    m_pPrecompiledEngines[  882] = &ParserBase::PrecompiledExpr_VVFVVVFFVFF;
-    m_pPrecompiledEngines[  883] = &ParserBase::PrecompiledExpr_VVFVVVFFVVF;
-    m_pPrecompiledEngines[  884] = &ParserBase::PrecompiledExpr_VVFVVVFVFFF;
-    m_pPrecompiledEngines[  885] = &ParserBase::PrecompiledExpr_VVFVVVFVFVF;
-    m_pPrecompiledEngines[  886] = &ParserBase::PrecompiledExpr_VVFVVVFVVFF;
-    m_pPrecompiledEngines[  887] = &ParserBase::PrecompiledExpr_VVFVVVFVVVF;
-    m_pPrecompiledEngines[  888] = &ParserBase::PrecompiledExpr_VVFVVVVFFFF;
-    m_pPrecompiledEngines[  889] = &ParserBase::PrecompiledExpr_VVFVVVVFFVF;
-    m_pPrecompiledEngines[  890] = &ParserBase::PrecompiledExpr_VVFVVVVFVFF;
-    m_pPrecompiledEngines[  891] = &ParserBase::PrecompiledExpr_VVFVVVVFVVF;
-    m_pPrecompiledEngines[  892] = &ParserBase::PrecompiledExpr_VVFVVVVVFFF;
-    m_pPrecompiledEngines[  893] = &ParserBase::PrecompiledExpr_VVFVVVVVFVF;
-    m_pPrecompiledEngines[  894] = &ParserBase::PrecompiledExpr_VVFVVVVVVFF;
-    m_pPrecompiledEngines[  895] = &ParserBase::PrecompiledExpr_VVFVVVVVVVF;
-    m_pPrecompiledEngines[  896] = &ParserBase::PrecompiledExpr_VVVFFFFFFFF;
-    m_pPrecompiledEngines[  897] = &ParserBase::PrecompiledExpr_VVVFFFFFFVF;
-    m_pPrecompiledEngines[  898] = &ParserBase::PrecompiledExpr_VVVFFFFFVFF;
-    m_pPrecompiledEngines[  899] = &ParserBase::PrecompiledExpr_VVVFFFFFVVF;
-    m_pPrecompiledEngines[  900] = &ParserBase::PrecompiledExpr_VVVFFFFVFFF;
-    m_pPrecompiledEngines[  901] = &ParserBase::PrecompiledExpr_VVVFFFFVFVF;
-    m_pPrecompiledEngines[  902] = &ParserBase::PrecompiledExpr_VVVFFFFVVFF;
-    m_pPrecompiledEngines[  903] = &ParserBase::PrecompiledExpr_VVVFFFFVVVF;
-    m_pPrecompiledEngines[  904] = &ParserBase::PrecompiledExpr_VVVFFFVFFFF;
-    m_pPrecompiledEngines[  905] = &ParserBase::PrecompiledExpr_VVVFFFVFFVF;
-    m_pPrecompiledEngines[  906] = &ParserBase::PrecompiledExpr_VVVFFFVFVFF;
-    m_pPrecompiledEngines[  907] = &ParserBase::PrecompiledExpr_VVVFFFVFVVF;
-    m_pPrecompiledEngines[  908] = &ParserBase::PrecompiledExpr_VVVFFFVVFFF;
-    m_pPrecompiledEngines[  909] = &ParserBase::PrecompiledExpr_VVVFFFVVFVF;
-    m_pPrecompiledEngines[  910] = &ParserBase::PrecompiledExpr_VVVFFFVVVFF;
-    m_pPrecompiledEngines[  911] = &ParserBase::PrecompiledExpr_VVVFFFVVVVF;
-    m_pPrecompiledEngines[  912] = &ParserBase::PrecompiledExpr_VVVFFVFFFFF;
-    m_pPrecompiledEngines[  913] = &ParserBase::PrecompiledExpr_VVVFFVFFFVF;
-    m_pPrecompiledEngines[  914] = &ParserBase::PrecompiledExpr_VVVFFVFFVFF;
-    m_pPrecompiledEngines[  915] = &ParserBase::PrecompiledExpr_VVVFFVFFVVF;
-    m_pPrecompiledEngines[  916] = &ParserBase::PrecompiledExpr_VVVFFVFVFFF;
-    m_pPrecompiledEngines[  917] = &ParserBase::PrecompiledExpr_VVVFFVFVFVF;
-    m_pPrecompiledEngines[  918] = &ParserBase::PrecompiledExpr_VVVFFVFVVFF;
-    m_pPrecompiledEngines[  919] = &ParserBase::PrecompiledExpr_VVVFFVFVVVF;
-    m_pPrecompiledEngines[  920] = &ParserBase::PrecompiledExpr_VVVFFVVFFFF;
-    m_pPrecompiledEngines[  921] = &ParserBase::PrecompiledExpr_VVVFFVVFFVF;
-    m_pPrecompiledEngines[  922] = &ParserBase::PrecompiledExpr_VVVFFVVFVFF;
-    m_pPrecompiledEngines[  923] = &ParserBase::PrecompiledExpr_VVVFFVVFVVF;
-    m_pPrecompiledEngines[  924] = &ParserBase::PrecompiledExpr_VVVFFVVVFFF;
-    m_pPrecompiledEngines[  925] = &ParserBase::PrecompiledExpr_VVVFFVVVFVF;
-    m_pPrecompiledEngines[  926] = &ParserBase::PrecompiledExpr_VVVFFVVVVFF;
-    m_pPrecompiledEngines[  927] = &ParserBase::PrecompiledExpr_VVVFFVVVVVF;
-    m_pPrecompiledEngines[  928] = &ParserBase::PrecompiledExpr_VVVFVFFFFFF;
-    m_pPrecompiledEngines[  929] = &ParserBase::PrecompiledExpr_VVVFVFFFFVF;
-    m_pPrecompiledEngines[  930] = &ParserBase::PrecompiledExpr_VVVFVFFFVFF;
-    m_pPrecompiledEngines[  931] = &ParserBase::PrecompiledExpr_VVVFVFFFVVF;
-    m_pPrecompiledEngines[  932] = &ParserBase::PrecompiledExpr_VVVFVFFVFFF;
-    m_pPrecompiledEngines[  933] = &ParserBase::PrecompiledExpr_VVVFVFFVFVF;
-    m_pPrecompiledEngines[  934] = &ParserBase::PrecompiledExpr_VVVFVFFVVFF;
-    m_pPrecompiledEngines[  935] = &ParserBase::PrecompiledExpr_VVVFVFFVVVF;
-    m_pPrecompiledEngines[  936] = &ParserBase::PrecompiledExpr_VVVFVFVFFFF;
-    m_pPrecompiledEngines[  937] = &ParserBase::PrecompiledExpr_VVVFVFVFFVF;
-    m_pPrecompiledEngines[  938] = &ParserBase::PrecompiledExpr_VVVFVFVFVFF;
-    m_pPrecompiledEngines[  939] = &ParserBase::PrecompiledExpr_VVVFVFVFVVF;
-    m_pPrecompiledEngines[  940] = &ParserBase::PrecompiledExpr_VVVFVFVVFFF;
-    m_pPrecompiledEngines[  941] = &ParserBase::PrecompiledExpr_VVVFVFVVFVF;
-    m_pPrecompiledEngines[  942] = &ParserBase::PrecompiledExpr_VVVFVFVVVFF;
-    m_pPrecompiledEngines[  943] = &ParserBase::PrecompiledExpr_VVVFVFVVVVF;
-    m_pPrecompiledEngines[  944] = &ParserBase::PrecompiledExpr_VVVFVVFFFFF;
-    m_pPrecompiledEngines[  945] = &ParserBase::PrecompiledExpr_VVVFVVFFFVF;
-    m_pPrecompiledEngines[  946] = &ParserBase::PrecompiledExpr_VVVFVVFFVFF;
-    m_pPrecompiledEngines[  947] = &ParserBase::PrecompiledExpr_VVVFVVFFVVF;
-    m_pPrecompiledEngines[  948] = &ParserBase::PrecompiledExpr_VVVFVVFVFFF;
-    m_pPrecompiledEngines[  949] = &ParserBase::PrecompiledExpr_VVVFVVFVFVF;
-    m_pPrecompiledEngines[  950] = &ParserBase::PrecompiledExpr_VVVFVVFVVFF;
-    m_pPrecompiledEngines[  951] = &ParserBase::PrecompiledExpr_VVVFVVFVVVF;
-    m_pPrecompiledEngines[  952] = &ParserBase::PrecompiledExpr_VVVFVVVFFFF;
-    m_pPrecompiledEngines[  953] = &ParserBase::PrecompiledExpr_VVVFVVVFFVF;
-    m_pPrecompiledEngines[  954] = &ParserBase::PrecompiledExpr_VVVFVVVFVFF;
-    m_pPrecompiledEngines[  955] = &ParserBase::PrecompiledExpr_VVVFVVVFVVF;
-    m_pPrecompiledEngines[  956] = &ParserBase::PrecompiledExpr_VVVFVVVVFFF;
-    m_pPrecompiledEngines[  957] = &ParserBase::PrecompiledExpr_VVVFVVVVFVF;
-    m_pPrecompiledEngines[  958] = &ParserBase::PrecompiledExpr_VVVFVVVVVFF;
-    m_pPrecompiledEngines[  959] = &ParserBase::PrecompiledExpr_VVVFVVVVVVF;
-    m_pPrecompiledEngines[  960] = &ParserBase::PrecompiledExpr_VVVVFFFFFFF;
-    m_pPrecompiledEngines[  961] = &ParserBase::PrecompiledExpr_VVVVFFFFFVF;
-    m_pPrecompiledEngines[  962] = &ParserBase::PrecompiledExpr_VVVVFFFFVFF;
-    m_pPrecompiledEngines[  963] = &ParserBase::PrecompiledExpr_VVVVFFFFVVF;
-    m_pPrecompiledEngines[  964] = &ParserBase::PrecompiledExpr_VVVVFFFVFFF;
-    m_pPrecompiledEngines[  965] = &ParserBase::PrecompiledExpr_VVVVFFFVFVF;
-    m_pPrecompiledEngines[  966] = &ParserBase::PrecompiledExpr_VVVVFFFVVFF;
-    m_pPrecompiledEngines[  967] = &ParserBase::PrecompiledExpr_VVVVFFFVVVF;
-    m_pPrecompiledEngines[  968] = &ParserBase::PrecompiledExpr_VVVVFFVFFFF;
-    m_pPrecompiledEngines[  969] = &ParserBase::PrecompiledExpr_VVVVFFVFFVF;
-    m_pPrecompiledEngines[  970] = &ParserBase::PrecompiledExpr_VVVVFFVFVFF;
-    m_pPrecompiledEngines[  971] = &ParserBase::PrecompiledExpr_VVVVFFVFVVF;
-    m_pPrecompiledEngines[  972] = &ParserBase::PrecompiledExpr_VVVVFFVVFFF;
-    m_pPrecompiledEngines[  973] = &ParserBase::PrecompiledExpr_VVVVFFVVFVF;
-    m_pPrecompiledEngines[  974] = &ParserBase::PrecompiledExpr_VVVVFFVVVFF;
-    m_pPrecompiledEngines[  975] = &ParserBase::PrecompiledExpr_VVVVFFVVVVF;
-    m_pPrecompiledEngines[  976] = &ParserBase::PrecompiledExpr_VVVVFVFFFFF;
-    m_pPrecompiledEngines[  977] = &ParserBase::PrecompiledExpr_VVVVFVFFFVF;
-    m_pPrecompiledEngines[  978] = &ParserBase::PrecompiledExpr_VVVVFVFFVFF;
-    m_pPrecompiledEngines[  979] = &ParserBase::PrecompiledExpr_VVVVFVFFVVF;
-    m_pPrecompiledEngines[  980] = &ParserBase::PrecompiledExpr_VVVVFVFVFFF;
-    m_pPrecompiledEngines[  981] = &ParserBase::PrecompiledExpr_VVVVFVFVFVF;
-    m_pPrecompiledEngines[  982] = &ParserBase::PrecompiledExpr_VVVVFVFVVFF;
-    m_pPrecompiledEngines[  983] = &ParserBase::PrecompiledExpr_VVVVFVFVVVF;
-    m_pPrecompiledEngines[  984] = &ParserBase::PrecompiledExpr_VVVVFVVFFFF;
-    m_pPrecompiledEngines[  985] = &ParserBase::PrecompiledExpr_VVVVFVVFFVF;
-    m_pPrecompiledEngines[  986] = &ParserBase::PrecompiledExpr_VVVVFVVFVFF;
-    m_pPrecompiledEngines[  987] = &ParserBase::PrecompiledExpr_VVVVFVVFVVF;
-    m_pPrecompiledEngines[  988] = &ParserBase::PrecompiledExpr_VVVVFVVVFFF;
-    m_pPrecompiledEngines[  989] = &ParserBase::PrecompiledExpr_VVVVFVVVFVF;
-    m_pPrecompiledEngines[  990] = &ParserBase::PrecompiledExpr_VVVVFVVVVFF;
-    m_pPrecompiledEngines[  991] = &ParserBase::PrecompiledExpr_VVVVFVVVVVF;
-    m_pPrecompiledEngines[  992] = &ParserBase::PrecompiledExpr_VVVVVFFFFFF;
-    m_pPrecompiledEngines[  993] = &ParserBase::PrecompiledExpr_VVVVVFFFFVF;
-    m_pPrecompiledEngines[  994] = &ParserBase::PrecompiledExpr_VVVVVFFFVFF;
-    m_pPrecompiledEngines[  995] = &ParserBase::PrecompiledExpr_VVVVVFFFVVF;
-    m_pPrecompiledEngines[  996] = &ParserBase::PrecompiledExpr_VVVVVFFVFFF;
-    m_pPrecompiledEngines[  997] = &ParserBase::PrecompiledExpr_VVVVVFFVFVF;
-    m_pPrecompiledEngines[  998] = &ParserBase::PrecompiledExpr_VVVVVFFVVFF;
-    m_pPrecompiledEngines[  999] = &ParserBase::PrecompiledExpr_VVVVVFFVVVF;
-    m_pPrecompiledEngines[ 1000] = &ParserBase::PrecompiledExpr_VVVVVFVFFFF;
-    m_pPrecompiledEngines[ 1001] = &ParserBase::PrecompiledExpr_VVVVVFVFFVF;
-    m_pPrecompiledEngines[ 1002] = &ParserBase::PrecompiledExpr_VVVVVFVFVFF;
-    m_pPrecompiledEngines[ 1003] = &ParserBase::PrecompiledExpr_VVVVVFVFVVF;
-    m_pPrecompiledEngines[ 1004] = &ParserBase::PrecompiledExpr_VVVVVFVVFFF;
-    m_pPrecompiledEngines[ 1005] = &ParserBase::PrecompiledExpr_VVVVVFVVFVF;
-    m_pPrecompiledEngines[ 1006] = &ParserBase::PrecompiledExpr_VVVVVFVVVFF;
-    m_pPrecompiledEngines[ 1007] = &ParserBase::PrecompiledExpr_VVVVVFVVVVF;
-    m_pPrecompiledEngines[ 1008] = &ParserBase::PrecompiledExpr_VVVVVVFFFFF;
-    m_pPrecompiledEngines[ 1009] = &ParserBase::PrecompiledExpr_VVVVVVFFFVF;
-    m_pPrecompiledEngines[ 1010] = &ParserBase::PrecompiledExpr_VVVVVVFFVFF;
-    m_pPrecompiledEngines[ 1011] = &ParserBase::PrecompiledExpr_VVVVVVFFVVF;
-    m_pPrecompiledEngines[ 1012] = &ParserBase::PrecompiledExpr_VVVVVVFVFFF;
-    m_pPrecompiledEngines[ 1013] = &ParserBase::PrecompiledExpr_VVVVVVFVFVF;
-    m_pPrecompiledEngines[ 1014] = &ParserBase::PrecompiledExpr_VVVVVVFVVFF;
-    m_pPrecompiledEngines[ 1015] = &ParserBase::PrecompiledExpr_VVVVVVFVVVF;
-    m_pPrecompiledEngines[ 1016] = &ParserBase::PrecompiledExpr_VVVVVVVFFFF;
-    m_pPrecompiledEngines[ 1017] = &ParserBase::PrecompiledExpr_VVVVVVVFFVF;
-    m_pPrecompiledEngines[ 1018] = &ParserBase::PrecompiledExpr_VVVVVVVFVFF;
-    m_pPrecompiledEngines[ 1019] = &ParserBase::PrecompiledExpr_VVVVVVVFVVF;
-    m_pPrecompiledEngines[ 1020] = &ParserBase::PrecompiledExpr_VVVVVVVVFFF;
-    m_pPrecompiledEngines[ 1021] = &ParserBase::PrecompiledExpr_VVVVVVVVFVF;
-    m_pPrecompiledEngines[ 1022] = &ParserBase::PrecompiledExpr_VVVVVVVVVFF;
-    m_pPrecompiledEngines[ 1023] = &ParserBase::PrecompiledExpr_VVVVVVVVVVF;
-  }
+    template<int NDepth, int NWeight> struct Next
+    {
+      static const bool valid = NDepth >= NArgs && NWeight + NArgs - 1 <= MUP_SPECIALIZED_MAX_OPS;
+      static const int depth  = NDepth - NArgs + 1;
+      static const int weight = NWeight + NArgs - 1;
+    };
+
+    template<typename TInstr>
+    static MUP_INLINE void Exec(const TInstr&, TValue *a_pTop)
+    {
+      InlineOp<TValue, NOp>::Apply(a_pTop - NArgs + 1);
+    }
+  };
+
+  template<typename TValue> struct InlineOp<TValue, ioADD>   : InlineFun<TValue, ioADD, 2> { static MUP_INLINE void Apply(TValue *a) { a[0] += a[1]; } };
+  template<typename TValue> struct InlineOp<TValue, ioSUB>   : InlineFun<TValue, ioSUB, 2> { static MUP_INLINE void Apply(TValue *a) { a[0] -= a[1]; } };
+  template<typename TValue> struct InlineOp<TValue, ioMUL>   : InlineFun<TValue, ioMUL, 2> { static MUP_INLINE void Apply(TValue *a) { a[0] *= a[1]; } };
+  template<typename TValue> struct InlineOp<TValue, ioDIV>   : InlineFun<TValue, ioDIV, 2> { static MUP_INLINE void Apply(TValue *a) { a[0] /= a[1]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_AA>: InlineFun<TValue, ioFUN_AA, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] += a[1] + a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_AS>: InlineFun<TValue, ioFUN_AS, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] -= a[1] + a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_MA>: InlineFun<TValue, ioFUN_MA, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] += a[1] * a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_AM>: InlineFun<TValue, ioFUN_AM, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] *= a[1] + a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_MM>: InlineFun<TValue, ioFUN_MM, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] *= a[1] * a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_DD>: InlineFun<TValue, ioFUN_DD, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] /= a[1] / a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_MD>: InlineFun<TValue, ioFUN_MD, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] /= a[1] * a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_DM>: InlineFun<TValue, ioFUN_DM, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] *= a[1] / a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_DA>: InlineFun<TValue, ioFUN_DA, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] += a[1] / a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_AD>: InlineFun<TValue, ioFUN_AD, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] /= a[1] + a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_DS>: InlineFun<TValue, ioFUN_DS, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] -= a[1] / a[2]; } };
+  template<typename TValue> struct InlineOp<TValue, ioFUN_SD>: InlineFun<TValue, ioFUN_SD, 3> { static MUP_INLINE void Apply(TValue *a) { a[0] /= a[1] - a[2]; } };
+
+  //-----------------------------------------------------------------------------------------------
+  /** \brief Evaluation of a token sequence with the stack depth NDepth in front of it. */
+  template<typename TValue, typename TInstr, int NDepth, int... NOps>
+  struct SpecializedShape
+  {
+    static MUP_INLINE void Exec(const TInstr*, TValue*)
+    {}
+  };
+
+  //-----------------------------------------------------------------------------------------------
+  template<typename TValue, typename TInstr, int NDepth, int NOp, int... NOps>
+  struct SpecializedShape<TValue, TInstr, NDepth, NOp, NOps...>
+  {
+    typedef InlineOp<TValue, NOp> op_type;
+
+    static MUP_INLINE void Exec(const TInstr *a_pRPN, TValue *a_pStack)
+    {
+      op_type::Exec(*a_pRPN, a_pStack + NDepth);
+      SpecializedShape<TValue, TInstr, op_type::template Next<NDepth, 0>::depth, NOps...>::Exec(a_pRPN + 1, a_pStack);
+    }
+  };
+
+MUP_NAMESPACE_END
+
+#endif
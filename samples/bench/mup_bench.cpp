@@ -0,0 +1,477 @@
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+
+#include "muParserTest.h"
+#include "perf_counters.h"
+
+using namespace std;
+using namespace mp;
+
+/** \file
+    \brief Benchmark of the parser, writes its results as JSON.
+
+  The corpus consists of the valid expressions of the ParserTester equation tests and a
+  number of long generated expressions. For every expression the program measures
+
+    - the compile time, SetExpr followed by the first Eval,
+    - the steady state Eval time of the unoptimized bytecode (ParseCmdCode),
+    - the steady state Eval time of the engine chosen by the optimizer,
+    - the heap memory held by the compiled expression.
+
+  In addition it measures the construction and copy cost of Parser<double>. With --perf the
+  compile and Eval measurements also report hardware counters per call, cycles, 
+  instructions, branch misses and L1 data cache read misses.
+
+  Usage: mup_bench [--quick] [--perf] [--out <file>]
+*/
+
+//---------------------------------------------------------------------------
+// Heap usage of the program, counted by the global allocation functions.
+// Every block is prefixed with its size in order to track the live bytes.
+static size_t g_nAllocs = 0;
+static size_t g_nAllocBytes = 0;
+static long long g_nLiveBytes = 0;
+static const size_t c_nHeader = 16;
+
+void* operator new(size_t n)
+{
+	char *p = (char*)malloc(n + c_nHeader);
+	if (p==nullptr)
+		throw bad_alloc();
+
+	*(size_t*)p = n;
+	++g_nAllocs;
+	g_nAllocBytes += n;
+	g_nLiveBytes += (long long)n;
+	return p + c_nHeader;
+}
+
+void operator delete(void *p) noexcept
+{
+	if (p==nullptr)
+		return;
+
+	char *pBlock = (char*)p - c_nHeader;
+	g_nLiveBytes -= (long long)*(size_t*)pBlock;
+	free(pBlock);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+	operator delete(p);
+}
+
+//---------------------------------------------------------------------------
+static volatile double g_fSink = 0;
+static double g_fMinNs = 5e6;   ///< Minimum duration of a single measurement
+static PerfCounters *g_pPerf = nullptr;
+
+//---------------------------------------------------------------------------
+/** \brief Returns the time per call of a_Fun in nanoseconds.
+    \param a_fCounters Optional array receiving the hardware counters per call, -1 for
+                       counters that are not available.
+
+  The number of calls is doubled until the measurement takes at least g_fMinNs.
+*/
+template<typename TFun>
+double Measure(TFun a_Fun, double *a_fCounters = nullptr)
+{
+	PerfCounters *pPerf = (a_fCounters) ? g_pPerf : nullptr;
+	for (long nLoops = 1; ; nLoops *= 2)
+	{
+		if (pPerf)
+			pPerf->Start();
+
+		auto t0 = chrono::steady_clock::now();
+		for (long i=0; i<nLoops; ++i)
+			a_Fun();
+
+		double fNs = chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+		if (pPerf)
+			pPerf->Stop(a_fCounters);
+
+		if (fNs>=g_fMinNs || nLoops>=(1L<<30))
+		{
+			for (int i=0; pPerf && i<PerfCounters::pcCOUNT; ++i)
+			{
+				if (a_fCounters[i]>=0)
+					a_fCounters[i] /= nLoops;
+			}
+
+			return fNs / nLoops;
+		}
+	}
+}
+
+//---------------------------------------------------------------------------
+string JsonString(const string &a_sVal)
+{
+	ostringstream ss;
+	ss << '"';
+	for (size_t i=0; i<a_sVal.size(); ++i)
+	{
+		unsigned char c = (unsigned char)a_sVal[i];
+		if (c=='"' || c=='\\')
+			ss << '\\' << c;
+		else if (c<0x20)
+		{
+			char sBuf[8];
+			snprintf(sBuf, sizeof(sBuf), "\\u%04x", c);
+			ss << sBuf;
+		}
+		else
+			ss << c;
+	}
+
+	ss << '"';
+	return ss.str();
+}
+
+//---------------------------------------------------------------------------
+/** \brief Returns a JSON object with the hardware counters, unavailable ones are null. */
+string JsonCounters(const double *a_fVal)
+{
+	ostringstream ss;
+	ss.precision(6);
+	ss << "{";
+	for (int i=0; i<PerfCounters::pcCOUNT; ++i)
+	{
+		ss << ((i==0) ? " \"" : ", \"") << PerfCounters::GetName(i) << "\": ";
+		if (a_fVal[i]<0)
+			ss << "null";
+		else
+			ss << a_fVal[i];
+	}
+
+	ss << " }";
+	return ss.str();
+}
+
+//---------------------------------------------------------------------------
+/** \brief Returns the expressions of the ParserTester equation tests. */
+vector<string> GetTesterCorpus()
+{
+	vector<string> vLog;
+
+	// The tester reports its progress on cout, the JSON output must not contain it
+	ostringstream ssNull;
+	streambuf *pBuf = cout.rdbuf(ssNull.rdbuf());
+
+	Test::ParserTester<double, string> pt;
+	pt.SetEqnLog(&vLog);
+	pt.Run();
+
+	cout.rdbuf(pBuf);
+
+	// Remove duplicates and expressions the equation parser does not accept
+	vector<string> vCorpus;
+	set<string> setSeen;
+	for (size_t i=0; i<vLog.size(); ++i)
+	{
+		if (!setSeen.insert(vLog[i]).second)
+			continue;
+
+		try
+		{
+			double vVar[] = { 1, 2, 3, -2 };
+			Parser<double> p;
+			Test::ParserTester<double, string>::InitEqnParser(p, vVar);
+			p.SetExpr(vLog[i]);
+			p.Eval();
+			vCorpus.push_back(vLog[i]);
+		}
+		catch(ParserError<string>&)
+		{}
+	}
+
+	return vCorpus;
+}
+
+//---------------------------------------------------------------------------
+/** \brief Returns long expressions made of the variables a, b, c and d. */
+vector<string> GetGeneratedCorpus()
+{
+	const char *szVar[] = { "a", "b", "c", "d" };
+	const char *szOprt[] = { "+", "*", "-", "/" };
+	const char *szFun[] = { "sin", "cos", "sqrt", "exp" };
+	vector<string> vCorpus;
+
+	// Long chains of binary operators
+	for (int n=8; n<=512; n*=4)
+	{
+		ostringstream ss;
+		ss << "a";
+		for (int i=1; i<n; ++i)
+			ss << szOprt[i%4] << szVar[i%4] << "*" << (i%7 + 1.5);
+
+		vCorpus.push_back(ss.str());
+	}
+
+	// Deeply nested parentheses
+	for (int n=16; n<=64; n*=4)
+	{
+		string sExpr;
+		for (int i=0; i<n; ++i)
+			sExpr += string("(") + szVar[i%4] + szOprt[i%4];
+
+		sExpr += "1" + string(n, ')');
+		vCorpus.push_back(sExpr);
+	}
+
+	// Nested function calls
+	for (int n=16; n<=64; n*=4)
+	{
+		string sExpr;
+		for (int i=0; i<n; ++i)
+			sExpr += string(szFun[i%4]) + "(";
+
+		sExpr += "a/100" + string(n, ')');
+		vCorpus.push_back(sExpr);
+	}
+
+	// Sums of callbacks with several arguments
+	{
+		ostringstream ss;
+		ss << "min(a,b)";
+		for (int i=1; i<64; ++i)
+			ss << "+max(" << szVar[i%4] << "," << szVar[(i+1)%4] << "*" << i << ")";
+
+		vCorpus.push_back(ss.str());
+	}
+
+	return vCorpus;
+}
+
+//---------------------------------------------------------------------------
+/** \brief Timing of an engine, summed over all expressions it evaluates. */
+struct SEngineStat
+{
+	int Count = 0;
+	double EvalNs = 0;
+	double LogSpeedup = 0;    ///< Sum of log(ParseCmdCode time / engine time)
+	double EvalCounters[PerfCounters::pcCOUNT] = {};
+	double CmdCounters[PerfCounters::pcCOUNT] = {};  ///< Counters of ParseCmdCode for the same expressions
+};
+
+//---------------------------------------------------------------------------
+void BenchCorpus(ostream &a_Out, const vector<string> &a_vCorpus, const char *a_szSource, bool &a_bFirst, map<string, SEngineStat> &a_Stat)
+{
+	for (size_t i=0; i<a_vCorpus.size(); ++i)
+	{
+		const string &sExpr = a_vCorpus[i];
+		double vVar[] = { 1, 2, 3, -2 };
+
+		// Unoptimized bytecode
+		Parser<double> p;
+		Test::ParserTester<double, string>::InitEqnParser(p, vVar);
+		p.EnableOptimizer(false);
+		p.SetExpr(sExpr);
+		p.Eval();
+		double fCmdCounters[PerfCounters::pcCOUNT];
+		double fCmdNs = Measure([&]{ g_fSink = p.Eval(); }, fCmdCounters);
+
+		// Optimized bytecode, the symbol tables are built by compiling a trivial expression first
+		Parser<double> q;
+		Test::ParserTester<double, string>::InitEqnParser(q, vVar);
+		q.SetExpr("0");
+		q.Eval();
+
+		long long nLive = g_nLiveBytes;
+		q.SetExpr(sExpr);
+		q.Eval();
+		long long nHeapBytes = g_nLiveBytes - nLive;
+
+		double fEvalCounters[PerfCounters::pcCOUNT], fCompileCounters[PerfCounters::pcCOUNT];
+		double fEvalNs = Measure([&]{ g_fSink = q.Eval(); }, fEvalCounters);
+		double fCompileNs = Measure([&]{ q.SetExpr(sExpr); g_fSink = q.Eval(); }, fCompileCounters);
+		string sEngine = q.GetEngineName();
+
+		SEngineStat &stat = a_Stat[sEngine];
+		stat.Count += 1;
+		stat.EvalNs += fEvalNs;
+		stat.LogSpeedup += log(fCmdNs / fEvalNs);
+		for (int c=0; c<PerfCounters::pcCOUNT; ++c)
+		{
+			stat.EvalCounters[c] += fEvalCounters[c];
+			stat.CmdCounters[c] += fCmdCounters[c];
+		}
+
+		a_Out << (a_bFirst ? "\n" : ",\n")
+		      << "    { \"source\": \"" << a_szSource << "\""
+		      << ", \"expr\": " << JsonString(sExpr)
+		      << ", \"compile_ns\": " << fCompileNs
+		      << ", \"eval_cmdcode_ns\": " << fCmdNs
+		      << ", \"engine\": \"" << sEngine << "\""
+		      << ", \"eval_ns\": " << fEvalNs
+		      << ", \"heap_bytes\": " << nHeapBytes;
+
+		if (g_pPerf)
+		{
+			a_Out << ", \"perf\": { \"compile\": " << JsonCounters(fCompileCounters)
+			      << ", \"eval_cmdcode\": " << JsonCounters(fCmdCounters)
+			      << ", \"eval\": " << JsonCounters(fEvalCounters) << " }";
+		}
+
+		a_Out << " }";
+		a_bFirst = false;
+	}
+}
+
+//---------------------------------------------------------------------------
+void BenchConstruction(ostream &a_Out)
+{
+	double a = 1, b = 2;
+	Parser<double> proto;
+	proto.DefineVar("a", &a);
+	proto.DefineVar("b", &b);
+	proto.SetExpr("a*b+a");
+	proto.Eval();
+
+	size_t nAllocs = g_nAllocs, nBytes = g_nAllocBytes;
+	{
+		Parser<double> p;
+	}
+	size_t nCtorAllocs = g_nAllocs - nAllocs, nCtorBytes = g_nAllocBytes - nBytes;
+
+	nAllocs = g_nAllocs;
+	nBytes = g_nAllocBytes;
+	{
+		Parser<double> p(proto);
+	}
+	size_t nCopyAllocs = g_nAllocs - nAllocs, nCopyBytes = g_nAllocBytes - nBytes;
+
+	double fCtorNs = Measure([&]{ Parser<double> p; g_fSink = p.GetNumResults(); });
+	double fCopyNs = Measure([&]{ Parser<double> p(proto); g_fSink = p.GetNumResults(); });
+	double fCopyEvalNs = Measure([&]{ Parser<double> p(proto); g_fSink = p.Eval(); });
+	double fAssignNs = Measure([&]{ Parser<double> p; p = proto; g_fSink = p.GetNumResults(); });
+
+	a_Out << "  \"construction\": {\n"
+	      << "    \"sizeof_parser\": " << sizeof(Parser<double>) << ",\n"
+	      << "    \"ctor_ns\": " << fCtorNs << ",\n"
+	      << "    \"ctor_allocs\": " << nCtorAllocs << ",\n"
+	      << "    \"ctor_heap_bytes\": " << nCtorBytes << ",\n"
+	      << "    \"copy_ns\": " << fCopyNs << ",\n"
+	      << "    \"copy_allocs\": " << nCopyAllocs << ",\n"
+	      << "    \"copy_heap_bytes\": " << nCopyBytes << ",\n"
+	      << "    \"copy_eval_ns\": " << fCopyEvalNs << ",\n"
+	      << "    \"assign_ns\": " << fAssignNs << "\n"
+	      << "  },\n";
+}
+
+//---------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+	string sOutFile;
+	bool bPerf = false;
+	for (int i=1; i<argc; ++i)
+	{
+		if (strcmp(argv[i], "--quick")==0)
+			g_fMinNs = 2e5;
+		else if (strcmp(argv[i], "--perf")==0)
+			bPerf = true;
+		else if (strcmp(argv[i], "--out")==0 && i+1<argc)
+			sOutFile = argv[++i];
+		else
+		{
+			cerr << "Usage: " << argv[0] << " [--quick] [--perf] [--out <file>]\n";
+			return 1;
+		}
+	}
+
+	// Without permission for perf_event_open the counters are reported as unavailable
+	PerfCounters perf;
+	if (bPerf && perf.IsAvailable())
+		g_pPerf = &perf;
+	else if (bPerf)
+		cerr << "Hardware counters are not available, see /proc/sys/kernel/perf_event_paranoid\n";
+
+	try
+	{
+		ostringstream ss;
+		ss.precision(6);
+
+#if defined(MUP_JIT_SUPPORTED)
+		const bool bJit = true;
+#else
+		const bool bJit = false;
+#endif
+
+		ss << "{\n"
+		   << "  \"version\": " << JsonString(Parser<double>().GetVersion(pviFULL)) << ",\n"
+		   << "  \"config\": {"
+		   << " \"jit\": " << (bJit ? "true" : "false")
+		   << ", \"precompiled_max_len\": " << MUP_PRECOMPILED_MAX_LEN
+		   << ", \"specialized_max_ops\": " << MUP_SPECIALIZED_MAX_OPS
+		   << ", \"bulk_size\": " << MUP_BULK_SIZE
+		   << ", \"min_measure_ns\": " << g_fMinNs
+		   << ", \"perf_counters\": " << ((g_pPerf) ? "true" : "false") << " },\n";
+
+		BenchConstruction(ss);
+
+		map<string, SEngineStat> stat;
+		bool bFirst = true;
+		ss << "  \"expressions\": [";
+		BenchCorpus(ss, GetTesterCorpus(), "tester", bFirst, stat);
+		BenchCorpus(ss, GetGeneratedCorpus(), "generated", bFirst, stat);
+		ss << "\n  ],\n";
+
+		ss << "  \"engines\": [";
+		for (auto it = stat.begin(); it!=stat.end(); ++it)
+		{
+			ss << ((it==stat.begin()) ? "\n" : ",\n")
+			   << "    { \"engine\": \"" << it->first << "\""
+			   << ", \"expressions\": " << it->second.Count
+			   << ", \"mean_eval_ns\": " << it->second.EvalNs / it->second.Count
+			   << ", \"speedup_vs_cmdcode\": " << exp(it->second.LogSpeedup / it->second.Count);
+
+			if (g_pPerf)
+			{
+				// Mean counters per Eval, null if a counter is not available
+				double fEval[PerfCounters::pcCOUNT], fCmd[PerfCounters::pcCOUNT];
+				for (int c=0; c<PerfCounters::pcCOUNT; ++c)
+				{
+					fEval[c] = (g_pPerf->IsAvailable(c)) ? it->second.EvalCounters[c] / it->second.Count : -1;
+					fCmd[c] = (g_pPerf->IsAvailable(c)) ? it->second.CmdCounters[c] / it->second.Count : -1;
+				}
+
+				ss << ", \"perf_eval\": " << JsonCounters(fEval)
+				   << ", \"perf_eval_cmdcode\": " << JsonCounters(fCmd);
+			}
+
+			ss << " }";
+		}
+		ss << "\n  ]\n}\n";
+
+		if (sOutFile.empty())
+		{
+			cout << ss.str();
+		}
+		else
+		{
+			ofstream file(sOutFile.c_str());
+			file << ss.str();
+			if (!file)
+			{
+				cerr << "Can't write " << sOutFile << "\n";
+				return 1;
+			}
+		}
+	}
+	catch(ParserError<string> &e)
+	{
+		cerr << e.GetExpr() << ": " << e.GetMsg() << "\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,171 @@
+#ifndef MU_PARSER_PERF_COUNTERS_H
+#define MU_PARSER_PERF_COUNTERS_H
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+/** \file
+    \brief Hardware performance counters of the calling thread, read with perf_event_open.
+
+  The counters are only available on Linux and only if the kernel permits it, see
+  /proc/sys/kernel/perf_event_paranoid. Counters the CPU does not support are reported as
+  unavailable, the remaining ones still work.
+*/
+
+//---------------------------------------------------------------------------
+/** \brief Group of the hardware counters measured by the benchmark. */
+class PerfCounters
+{
+public:
+
+	enum ECounter
+	{
+		pcCYCLES = 0,
+		pcINSTRUCTIONS,
+		pcBRANCH_MISSES,
+		pcL1D_MISSES,
+		pcCOUNT
+	};
+
+	//-----------------------------------------------------------------------
+	PerfCounters()
+		:m_nLeader(-1)
+	{
+		for (int i=0; i<pcCOUNT; ++i)
+		{
+			m_nFd[i] = -1;
+			m_nSlot[i] = -1;
+		}
+
+#if defined(__linux__)
+		const std::uint32_t nType[pcCOUNT] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE };
+		const std::uint64_t nConfig[pcCOUNT] =
+		{
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_BRANCH_MISSES,
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+		};
+
+		// All counters form a single group so they are scheduled on the PMU together
+		int nSlots = 0;
+		for (int i=0; i<pcCOUNT; ++i)
+		{
+			perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = nType[i];
+			attr.config = nConfig[i];
+			attr.disabled = (m_nLeader<0) ? 1 : 0;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, m_nLeader, 0);
+			if (fd<0)
+				continue;
+
+			if (m_nLeader<0)
+				m_nLeader = fd;
+
+			m_nFd[i] = fd;
+			m_nSlot[i] = nSlots++;
+		}
+#endif
+	}
+
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+
+	//-----------------------------------------------------------------------
+	~PerfCounters()
+	{
+#if defined(__linux__)
+		for (int i=0; i<pcCOUNT; ++i)
+		{
+			if (m_nFd[i]>=0)
+				close(m_nFd[i]);
+		}
+#endif
+	}
+
+	//-----------------------------------------------------------------------
+	static const char* GetName(int a_iCounter)
+	{
+		static const char *szName[pcCOUNT] = { "cycles", "instructions", "branch_misses", "l1d_misses" };
+		return szName[a_iCounter];
+	}
+
+	//-----------------------------------------------------------------------
+	/** \brief Returns true if at least one counter could be opened. */
+	bool IsAvailable() const
+	{
+		return m_nLeader>=0;
+	}
+
+	//-----------------------------------------------------------------------
+	bool IsAvailable(int a_iCounter) const
+	{
+		return m_nFd[a_iCounter]>=0;
+	}
+
+	//-----------------------------------------------------------------------
+	/** \brief Reset the counters and start counting. */
+	void Start()
+	{
+#if defined(__linux__)
+		if (m_nLeader<0)
+			return;
+
+		ioctl(m_nLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(m_nLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+	}
+
+	//-----------------------------------------------------------------------
+	/** \brief Stop counting and read the counters.
+	    \param a_fVal Receives pcCOUNT values, -1 for unavailable counters.
+
+	  If the kernel had to multiplex the counters the values are scaled to the time the
+	  group was enabled.
+	*/
+	void Stop(double *a_fVal)
+	{
+		for (int i=0; i<pcCOUNT; ++i)
+			a_fVal[i] = -1;
+
+#if defined(__linux__)
+		if (m_nLeader<0)
+			return;
+
+		ioctl(m_nLeader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+		// nr, time_enabled, time_running, value[nr]
+		std::uint64_t nBuf[3 + pcCOUNT];
+		if (read(m_nLeader, nBuf, sizeof(nBuf)) < (ssize_t)(3 * sizeof(std::uint64_t)) || nBuf[2]==0)
+			return;
+
+		const double fScale = (double)nBuf[1] / (double)nBuf[2];
+		for (int i=0; i<pcCOUNT; ++i)
+		{
+			if (m_nSlot[i]>=0 && (std::uint64_t)m_nSlot[i]<nBuf[0])
+				a_fVal[i] = (double)nBuf[3 + m_nSlot[i]] * fScale;
+		}
+#endif
+	}
+
+private:
+
+	int m_nLeader;          ///< File descriptor of the group leader, -1 if no counter is available
+	int m_nFd[pcCOUNT];     ///< File descriptors of the counters, -1 if unavailable
+	int m_nSlot[pcCOUNT];   ///< Position of the counters in the group read buffer
+};
+
+#endif
@@ -0,0 +1,33 @@
+#include <string>
+
+#include "muParserTest.h"
+
+using namespace std;
+using namespace mp;
+
+/** \file
+    \brief Runs the parser test suite, the exit code is the number of failed tests.
+*/
+
+//---------------------------------------------------------------------------
+int main(int, char**)
+{
+	int iStat = 0;
+
+	{
+		Test::ParserTester<double, string> pt;
+		iStat += pt.Run();
+	}
+
+	{
+		Test::ParserTester<double, wstring> pt;
+		iStat += pt.Run();
+	}
+
+	{
+		Test::ParserTester<float, string> pt;
+		iStat += pt.Run();
+	}
+
+	return (iStat==0) ? 0 : 1;
+}